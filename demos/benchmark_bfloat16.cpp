@@ -0,0 +1,128 @@
+/**
+ * @file benchmark_bfloat16.cpp
+ * @brief Throughput benchmark for float32 <-> bfloat16 conversions
+ *
+ * Compares, at L1-, L2- and DRAM-resident working set sizes:
+ * 1. Hand-rolled truncation (bits >> 16, no rounding, no checks)
+ * 2. Scalar numeric_cast<bfloat16> loop
+ * 3. float_to_bfloat16_n (vectorized round-to-nearest-even, no checks)
+ * 4. try_float_to_bfloat16_n (vectorized, range validated)
+ * 5. bfloat16_to_float_n (vectorized widening)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON to use the AVX2 kernels.
+ *
+ * Usage: ./benchmark_bfloat16 [number_of_runs]
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../include/ncast/ncast_bfloat16.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ELEMENTS_PER_MEASUREMENT = 32 * 1024 * 1024;  // Elements converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t elements;
+};
+
+// float + bfloat16 = 6 bytes per element
+const WorkingSet WORKING_SETS[] = {
+    { "L1 (2K elements, 12 KB)", 2 * 1024 },
+    { "L2 (64K elements, 384 KB)", 64 * 1024 },
+    { "DRAM (16M elements, 96 MB)", 16 * 1024 * 1024 }
+};
+
+std::vector<float> generate_test_data(size_t count) {
+    std::vector<float> data(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+void truncate_to_bfloat16(const float* src, size_t count, bfloat16* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &src[i], sizeof(bits));
+        dst[i] = bfloat16::from_bits(static_cast<std::uint16_t>(bits >> 16));
+    }
+}
+
+void numeric_cast_to_bfloat16(const float* src, size_t count, bfloat16* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = numeric_cast<bfloat16>(src[i]);
+    }
+}
+
+void run_working_set(const WorkingSet& ws, int num_runs) {
+    std::vector<float> src = generate_test_data(ws.elements);
+    std::vector<bfloat16> dst(ws.elements);
+    std::vector<float> back(ws.elements);
+    size_t repeats = std::max<size_t>(1, ELEMENTS_PER_MEASUREMENT / ws.elements);
+
+    print_throughput_header(ws.name);
+
+    BenchmarkStats stats = measure_kernel("truncation (bits >> 16)", [&]() {
+        truncate_to_bfloat16(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0].bits());
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, 6.0);
+
+    stats = measure_kernel("numeric_cast<bfloat16> loop", [&]() {
+        numeric_cast_to_bfloat16(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0].bits());
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, 6.0);
+
+    stats = measure_kernel("float_to_bfloat16_n", [&]() {
+        float_to_bfloat16_n(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0].bits());
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, 6.0);
+
+    stats = measure_kernel("try_float_to_bfloat16_n", [&]() {
+        bulk_result r = try_float_to_bfloat16_n(src.data(), src.size(), dst.data());
+        benchmark_keep(r.index);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, 6.0);
+
+    stats = measure_kernel("bfloat16_to_float_n", [&]() {
+        bfloat16_to_float_n(dst.data(), dst.size(), back.data());
+        benchmark_keep(back[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, 6.0);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast bfloat16 Conversion Benchmark" << std::endl;
+    std::cout << "===================================" << std::endl;
+    std::cout << "Elements per run: " << ELEMENTS_PER_MEASUREMENT << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << "SIMD: " << (NCAST_HAS_AVX2 ? "AVX2" : (NCAST_HAS_SSE2 ? "SSE2" : "none (scalar)")) << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_working_set(ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file benchmark_buffer.cpp
+ * @brief Producer pushing values one at a time: per-value numeric_cast versus buffered bulk casts
+ *
+ * A producer emits 64K readings one by one into a std::vector<int32>
+ * (cache-resident, so the per-value cost is measured rather than DRAM bandwidth):
+ * 1. std::back_inserter with static_cast (unchecked)
+ * 2. std::back_inserter with numeric_cast per value
+ * 3. cast_output_buffer over std::back_inserter (batches of 256, bulk validation)
+ * 4. cast_output_buffer over a pointer into a pre-sized vector
+ *
+ * Readings are int64 and double; the double -> int32 check (NaN, infinity,
+ * range) is where per-value validation costs most.
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for AVX2 code generation.
+ *
+ * Usage: ./benchmark_buffer [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_buffer.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t VALUES = 64 * 1024;
+const size_t REPEATS = 256;
+const int DEFAULT_RUNS = 3;
+
+template<typename From>
+std::vector<From> generate_readings(size_t count) {
+    std::vector<From> data(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<std::int64_t> dis(-1000000, 1000000);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = static_cast<From>(dis(gen));
+    }
+    return data;
+}
+
+template<typename From>
+void run_source(const char* name, int num_runs) {
+    // The producer reads its values from memory; the consumer side is what is measured
+    std::vector<From> readings = generate_readings<From>(VALUES);
+    std::vector<std::int32_t> out;
+    out.reserve(VALUES);
+    const double bytes_per_element = static_cast<double>(sizeof(From) + sizeof(std::int32_t));
+
+    std::ostringstream title;
+    title << name << " -> int32, 64K values pushed one at a time";
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("back_inserter + static_cast", [&]() {
+        out.clear();
+        std::back_insert_iterator<std::vector<std::int32_t> > sink(out);
+        for (size_t i = 0; i < readings.size(); ++i) {
+            *sink++ = static_cast<std::int32_t>(readings[i]);
+        }
+        benchmark_keep(out.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("back_inserter + numeric_cast", [&]() {
+        out.clear();
+        std::back_insert_iterator<std::vector<std::int32_t> > sink(out);
+        for (size_t i = 0; i < readings.size(); ++i) {
+            *sink++ = numeric_cast<std::int32_t>(readings[i]);
+        }
+        benchmark_keep(out.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("cast_output_buffer (back_inserter)", [&]() {
+        out.clear();
+        auto buffer = make_cast_output_buffer<std::int32_t, From>(std::back_inserter(out));
+        for (size_t i = 0; i < readings.size(); ++i) {
+            buffer.push(readings[i]);
+        }
+        buffer.flush();
+        benchmark_keep(out.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("cast_output_buffer (pointer)", [&]() {
+        out.resize(VALUES);
+        auto buffer = make_cast_output_buffer<std::int32_t, From>(out.data());
+        for (size_t i = 0; i < readings.size(); ++i) {
+            buffer.push(readings[i]);
+        }
+        buffer.flush();
+        benchmark_keep(out.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Buffered Output Benchmark (producer -> vector<int32>)" << std::endl;
+    std::cout << "===========================================================" << std::endl;
+    std::cout << "Values per pass: " << VALUES << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    run_source<std::int64_t>("int64", num_runs);
+    run_source<double>("double", num_runs);
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
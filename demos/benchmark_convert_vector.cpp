@@ -0,0 +1,124 @@
+/**
+ * @file benchmark_convert_vector.cpp
+ * @brief Same-width sign changes of whole vectors (int32 <-> uint32, int64 <-> uint64)
+ *
+ * Each pass converts a vector to the other signedness and back, so every
+ * method consumes and produces vectors the way an application would:
+ * 1. new vector + numeric_cast per element
+ * 2. new vector + numeric_cast_n (vectorized range check)
+ * 3. convert_vector (sign-bit OR-reduction, then a bit copy into one allocation)
+ * 4. narrow_in_place on the vector (sign-bit OR-reduction only, storage reused)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for AVX2 code generation.
+ *
+ * Usage: ./benchmark_convert_vector [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+#include "../include/ncast/ncast_narrow.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t VALUES = 1024 * 1024;
+const size_t REPEATS = 16;
+const int DEFAULT_RUNS = 3;
+
+template<typename Signed>
+std::vector<Signed> generate_ids(size_t count) {
+    std::vector<Signed> data(count);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<Signed> dis(0, std::numeric_limits<Signed>::max());
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+template<typename To, typename From>
+std::vector<To> convert_loop(const std::vector<From>& values) {
+    std::vector<To> converted(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        converted[i] = numeric_cast<To>(values[i]);
+    }
+    return converted;
+}
+
+template<typename To, typename From>
+std::vector<To> convert_bulk(const std::vector<From>& values) {
+    std::vector<To> converted(values.size());
+    numeric_cast_n(values.data(), values.size(), converted.data());
+    return converted;
+}
+
+template<typename Signed>
+void run_pair(const char* name, int num_runs) {
+    typedef typename std::make_unsigned<Signed>::type Unsigned;
+    std::vector<Signed> ids = generate_ids<Signed>(VALUES);
+    // Two conversions per pass, each reading and writing one element
+    const double bytes_per_element = 4.0 * sizeof(Signed);
+
+    std::ostringstream title;
+    title << name << ", 1M values converted to the other signedness and back";
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("new vector + numeric_cast", [&]() {
+        std::vector<Unsigned> keys = convert_loop<Unsigned>(ids);
+        ids = convert_loop<Signed>(keys);
+        benchmark_keep(ids.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("new vector + numeric_cast_n", [&]() {
+        std::vector<Unsigned> keys = convert_bulk<Unsigned>(ids);
+        ids = convert_bulk<Signed>(keys);
+        benchmark_keep(ids.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("convert_vector", [&]() {
+        std::vector<Unsigned> keys = convert_vector<Unsigned>(std::move(ids));
+        ids = convert_vector<Signed>(std::move(keys));
+        benchmark_keep(ids.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("narrow_in_place (storage reused)", [&]() {
+        narrowed_vector<Unsigned, Signed> keys = narrow_in_place<Unsigned>(std::move(ids));
+        benchmark_keep(keys[VALUES / 2]);
+        ids = keys.release();
+        benchmark_keep(ids.back());
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Vector Sign Change Benchmark" << std::endl;
+    std::cout << "==================================" << std::endl;
+    std::cout << "Values per vector: " << VALUES << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    run_pair<std::int32_t>("int32 <-> uint32", num_runs);
+    run_pair<std::int64_t>("int64 <-> uint64", num_runs);
+
+    std::cout << "GB/s counts two conversions per pass (read + write each); narrow_in_place" << std::endl;
+    std::cout << "validates one direction per pass and writes nothing, so its GB/s is nominal." << std::endl;
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,318 @@
+/**
+ * @file benchmark_csv.cpp
+ * @brief Memory-mapped CSV ingestion into typed, range-checked columns
+ *
+ * Maps a CSV file into memory and parses six numeric columns (uint32 IDs,
+ * int64 millisecond timestamps, uint16 sensor numbers, int16 levels, float
+ * temperatures, double prices) into typed column buffers, collecting the
+ * failing fields per row:
+ * 1. strtoll / strtoull / strtod + numeric_cast, row by row, errors caught
+ *    as cast_exception (the usual hand-written loader)
+ * 2. csv_columns into wide columns (int64 / double): parsing without
+ *    narrowing, the cost floor
+ * 3. csv_columns into the narrow column types, on 1 thread and on a
+ *    thread_pool (parse_cast: the range check is fused into parsing)
+ *
+ * Without a file argument a CSV of 1M rows with about 0.1% bad fields
+ * (out-of-range levels, "n/a" temperatures) is generated in the current
+ * directory and removed afterwards.
+ *
+ * Usage: ./benchmark_csv [number_of_runs] [file.csv]
+ * A file given on the command line must have a header line and the six
+ * numeric columns first, in the order above.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../include/ncast/ncast_csv.h"
+#include "benchmark_utils.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BENCHMARK_HAS_MMAP 1
+#else
+#define BENCHMARK_HAS_MMAP 0
+#endif
+
+using namespace ncast;
+
+// Configuration
+const size_t GENERATED_ROWS = 1024 * 1024;
+const size_t REPEATS = 1;
+const int DEFAULT_RUNS = 3;
+
+/**
+ * @brief Read-only view of a whole file: mmap where available, otherwise a copy in memory
+ */
+class mapped_text {
+private:
+    const char* data_;
+    size_t size_;
+    std::string copy_;
+
+    mapped_text(const mapped_text&);
+    mapped_text& operator=(const mapped_text&);
+
+public:
+    explicit mapped_text(const std::string& path) : data_(nullptr), size_(0) {
+#if BENCHMARK_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat info;
+        if (fd >= 0 && ::fstat(fd, &info) == 0 && info.st_size > 0) {
+            size_ = static_cast<size_t>(info.st_size);
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(mapping);
+            } else {
+                size_ = 0;
+            }
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+#else
+        std::ifstream file(path.c_str(), std::ios::binary);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        copy_ = contents.str();
+        data_ = copy_.data();
+        size_ = copy_.size();
+#endif
+    }
+
+    ~mapped_text() {
+#if BENCHMARK_HAS_MMAP
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool ok() const { return data_ != nullptr; }
+};
+
+// Sensor readings with about 1 bad field in 1000 rows
+bool generate_csv(const std::string& path, size_t rows) {
+    std::ofstream file(path.c_str(), std::ios::binary);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    file << "id,timestamp,sensor,level,temperature,price,label\n";
+    char line[160];
+    for (size_t row = 0; row < rows; ++row) {
+        const unsigned bad = static_cast<unsigned>(gen() % 2000u);
+        char level[16];
+        char temperature[16];
+        std::snprintf(level, sizeof(level), "%d", bad == 0 ? 40000 : static_cast<int>(gen() % 60001u) - 30000);
+        std::snprintf(temperature, sizeof(temperature), bad == 1 ? "n/a" : "%.2f",
+                      static_cast<double>(gen() % 10000u) / 100.0 - 40.0);
+        std::snprintf(line, sizeof(line), "%u,%lld,%u,%s,%s,%.4f,site-%u\n", static_cast<unsigned>(row),
+                      1700000000000LL + static_cast<long long>(row) * 250, static_cast<unsigned>(gen() % 65536u),
+                      level, temperature, static_cast<double>(gen() % 100000000u) / 10000.0,
+                      static_cast<unsigned>(row % 500u));
+        file << line;
+    }
+    return static_cast<bool>(file);
+}
+
+// Typed columns of the six numeric fields
+struct narrow_columns {
+    std::vector<std::uint32_t> ids;
+    std::vector<std::int64_t> timestamps;
+    std::vector<std::uint16_t> sensors;
+    std::vector<std::int16_t> levels;
+    std::vector<float> temperatures;
+    std::vector<double> prices;
+};
+
+struct wide_columns {
+    std::vector<std::int64_t> ids;
+    std::vector<std::int64_t> timestamps;
+    std::vector<std::int64_t> sensors;
+    std::vector<std::int64_t> levels;
+    std::vector<double> temperatures;
+    std::vector<double> prices;
+};
+
+// Hand-written loader: strtoll / strtod, then numeric_cast; a bad field becomes an error record
+template<typename T>
+void load_field(const char*& p, const char* line_end, size_t row, size_t column, std::vector<T>& values,
+                std::vector<csv_field_error>& errors) {
+    char* end = const_cast<char*>(p);
+    T value = T();
+    try {
+        if (std::is_floating_point<T>::value) {
+            double wide = std::strtod(p, &end);
+            value = numeric_cast<T>(wide);
+        } else if (std::is_signed<T>::value) {
+            long long wide = std::strtoll(p, &end, 10);
+            value = numeric_cast<T>(wide);
+        } else {
+            unsigned long long wide = std::strtoull(p, &end, 10);
+            value = numeric_cast<T>(wide);
+        }
+        if (end == p || (end != line_end && *end != ',')) {
+            throw cast_exception("invalid field", cast_error::invalid_format);
+        }
+    } catch (const cast_exception& e) {
+        csv_field_error failure = { row, column, e.getError() };
+        errors.push_back(failure);
+        value = T();
+    }
+    values.push_back(value);
+    const char* comma = static_cast<const char*>(std::memchr(p, ',', static_cast<size_t>(line_end - p)));
+    p = comma ? comma + 1 : line_end;
+}
+
+size_t load_strtoll(const char* text, size_t size, narrow_columns& columns) {
+    columns = narrow_columns();
+    std::vector<csv_field_error> errors;
+    const char* p = static_cast<const char*>(std::memchr(text, '\n', size)) + 1;
+    const char* end = text + size;
+    for (size_t row = 0; p < end; ++row) {
+        const char* line_end = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        line_end = line_end ? line_end : end;
+        load_field(p, line_end, row, 0, columns.ids, errors);
+        load_field(p, line_end, row, 1, columns.timestamps, errors);
+        load_field(p, line_end, row, 2, columns.sensors, errors);
+        load_field(p, line_end, row, 3, columns.levels, errors);
+        load_field(p, line_end, row, 4, columns.temperatures, errors);
+        load_field(p, line_end, row, 5, columns.prices, errors);
+        p = line_end + 1;
+    }
+    return errors.size();
+}
+
+const char* error_name(cast_error error) {
+    switch (error) {
+    case cast_error::positive_overflow: return "positive_overflow";
+    case cast_error::negative_overflow: return "negative_overflow";
+    case cast_error::negative_to_unsigned: return "negative_to_unsigned";
+    case cast_error::underflow: return "underflow";
+    case cast_error::invalid_format: return "invalid_format";
+    default: return "other";
+    }
+}
+
+template<typename Columns>
+csv_columns bind_columns(Columns& columns) {
+    csv_columns bindings(',', true);
+    bindings.add(0, columns.ids).add(1, columns.timestamps).add(2, columns.sensors)
+            .add(3, columns.levels).add(4, columns.temperatures).add(5, columns.prices);
+    return bindings;
+}
+
+void print_rows_per_second(const BenchmarkStats& stats, size_t rows) {
+    double seconds = stats.median / 1000.0 / static_cast<double>(REPEATS);
+    std::cout << "  " << std::setw(32) << std::left << stats.name << std::right << std::setw(10)
+              << std::fixed << std::setprecision(2) << static_cast<double>(rows) / seconds / 1e6
+              << " M rows/s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::string path = argc > 2 ? argv[2] : "benchmark_csv_data.csv";
+    const bool generated = argc <= 2;
+    if (generated && !generate_csv(path, GENERATED_ROWS)) {
+        std::cerr << "Error: cannot write " << path << std::endl;
+        return 1;
+    }
+
+    int status = 0;
+    {
+        mapped_text text(path);
+        if (!text.ok()) {
+            std::cerr << "Error: cannot map " << path << std::endl;
+            status = 1;
+        } else {
+            const unsigned threads = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 2;
+            thread_pool pool(threads);
+            narrow_columns narrow;
+            wide_columns wide;
+            csv_columns narrow_bindings = bind_columns(narrow);
+            csv_columns wide_bindings = bind_columns(wide);
+
+            csv_result result = narrow_bindings.parse(text.data(), text.size(), pool);
+            const size_t rows = result.rows;
+            const double bytes_per_row = static_cast<double>(text.size()) / static_cast<double>(rows);
+
+            std::cout << "ncast CSV Ingestion Benchmark" << std::endl;
+            std::cout << "=============================" << std::endl;
+            std::cout << "Number of runs: " << num_runs << std::endl;
+            std::cout << "File: " << path << (BENCHMARK_HAS_MMAP ? " (memory-mapped)" : " (read into memory)")
+                      << std::endl;
+            std::cout << "Rows: " << rows << ", failed fields: " << result.errors.size();
+            if (!result.errors.empty()) {
+                const csv_field_error& first = result.errors.front();
+                std::cout << " (first: row " << first.row << ", column " << first.column << ", "
+                          << error_name(first.error) << ")";
+            }
+            std::cout << std::endl << std::endl;
+
+            std::ostringstream title;
+            title << "6 numeric columns, " << rows / 1024 << "K rows, " << text.size() / (1024 * 1024) << " MB";
+            print_throughput_header(title.str());
+
+            std::vector<BenchmarkStats> all;
+            size_t strtoll_errors = 0;
+            all.push_back(measure_kernel("strtoll / strtod + numeric_cast", [&]() {
+                strtoll_errors = load_strtoll(text.data(), text.size(), narrow);
+                benchmark_keep(strtoll_errors);
+            }, num_runs, REPEATS));
+            all.push_back(measure_kernel("csv_columns, wide (no narrowing)", [&]() {
+                benchmark_keep(wide_bindings.parse(text.data(), text.size()).errors.size());
+            }, num_runs, REPEATS));
+            size_t narrow_errors = 0;
+            all.push_back(measure_kernel("csv_columns, narrow", [&]() {
+                narrow_errors = narrow_bindings.parse(text.data(), text.size()).errors.size();
+                benchmark_keep(narrow_errors);
+            }, num_runs, REPEATS));
+            std::ostringstream parallel_name;
+            parallel_name << "csv_columns, narrow, " << threads << " threads";
+            all.push_back(measure_kernel(parallel_name.str(), [&]() {
+                benchmark_keep(narrow_bindings.parse(text.data(), text.size(), pool).errors.size());
+            }, num_runs, REPEATS));
+
+            for (size_t i = 0; i < all.size(); ++i) {
+                print_throughput_row(all[i], rows, REPEATS, bytes_per_row);
+            }
+            std::cout << std::endl;
+            for (size_t i = 0; i < all.size(); ++i) {
+                print_rows_per_second(all[i], rows);
+            }
+            std::cout << std::endl;
+
+            if (strtoll_errors != narrow_errors) {
+                std::cerr << "Error: loaders disagree (" << strtoll_errors << " vs " << narrow_errors
+                          << " failed fields)" << std::endl;
+                status = 1;
+            }
+            std::cout << "ns/elem is per row; GB/s counts CSV bytes." << std::endl;
+        }
+    }
+
+    if (generated) {
+        std::remove(path.c_str());
+    }
+    if (status == 0) {
+        std::cout << "Benchmark completed successfully!" << std::endl;
+    }
+    return status;
+}
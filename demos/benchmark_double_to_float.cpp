@@ -0,0 +1,136 @@
+/**
+ * @file benchmark_double_to_float.cpp
+ * @brief double -> float narrowing of feature vectors with overflow / underflow checks
+ *
+ * Compares, at L2- and DRAM-resident sizes:
+ * 1. static_cast loop (no validation)
+ * 2. Scalar numeric_cast loop (overflow only, per element)
+ * 3. Block-wise range check, then conversion (the generic bulk kernel)
+ * 4. try_numeric_cast_n (one pass: narrow, vector compares, store)
+ * 5. try_numeric_cast_n with underflow, NaN and infinity checks
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for the AVX2 / AVX-512 kernels.
+ *
+ * Usage: ./benchmark_double_to_float [number_of_runs]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_bulk.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t BYTES_PER_MEASUREMENT = 256 * 1024 * 1024;  // Source bytes converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t values;
+};
+
+const WorkingSet WORKING_SETS[] = {
+    { "L2 (32K values)", 32 * 1024 },
+    { "DRAM (16M values)", 16 * 1024 * 1024 }
+};
+
+// The generic kernel: vectorized range check of each block, then a conversion loop
+size_t check_then_convert_blocks(const double* src, size_t count, float* dst) {
+    for (size_t base = 0; base < count; base += detail::bulk_block_size) {
+        size_t n = count - base < detail::bulk_block_size ? count - base : detail::bulk_block_size;
+        if (!detail::block_fits<float>(src + base, n)) {
+            return base + detail::find_first_failure<float>(src + base, n);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            dst[base + i] = static_cast<float>(src[base + i]);
+        }
+    }
+    return count;
+}
+
+// Normalized feature values: well inside float's normal range
+std::vector<double> generate_features(size_t count) {
+    std::vector<double> data(count);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    std::normal_distribution<double> dis(0.0, 1.0);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+void run_working_set(const WorkingSet& ws, int num_runs) {
+    const size_t count = ws.values;
+    std::vector<double> src = generate_features(count);
+    std::vector<float> dst(count);
+    size_t repeats = std::max<size_t>(1, BYTES_PER_MEASUREMENT / (count * sizeof(double)));
+    const double bytes_per_element = static_cast<double>(sizeof(double) + sizeof(float));
+
+    std::ostringstream title;
+    title << "double -> float, " << ws.name;
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("static_cast loop (unchecked)", [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = static_cast<float>(src[i]);
+        }
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("numeric_cast loop", [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = numeric_cast<float>(src[i]);
+        }
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("check then convert blocks", [&]() {
+        benchmark_keep(check_then_convert_blocks(src.data(), count, dst.data()));
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("try_numeric_cast_n (one pass)", [&]() {
+        benchmark_keep(try_numeric_cast_n(src.data(), count, dst.data()).index);
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    const float_checks storage_checks = float_checks::reject_underflow | float_checks::reject_nan |
+                                        float_checks::reject_infinity;
+    stats = measure_kernel("underflow | nan | infinity", [&]() {
+        benchmark_keep(try_numeric_cast_n(src.data(), count, dst.data(), storage_checks).index);
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast double -> float Narrowing Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "AVX-512: " << (NCAST_HAS_AVX512 ? "yes" : "no")
+              << ", AVX2: " << (NCAST_HAS_AVX2 ? "yes" : "no") << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_working_set(ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
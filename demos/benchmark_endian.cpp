@@ -0,0 +1,120 @@
+/**
+ * @file benchmark_endian.cpp
+ * @brief Throughput benchmark for narrowing big-endian wire fields to host integers
+ *
+ * Converts packed big-endian int64 fields to int32 and int16, comparing:
+ * 1. Three passes: memcpy into an int64 buffer, byte swap in place, numeric_cast_n
+ * 2. Loop of memcpy + byte swap + numeric_cast per field
+ * 3. try_load_be_cast_n (swap, check and narrow in one pass)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON to use the SSSE3 kernel.
+ *
+ * Usage: ./benchmark_endian [number_of_runs]
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../include/ncast/ncast_endian.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ELEMENTS_PER_MEASUREMENT = 32 * 1024 * 1024;  // Fields converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t elements;
+};
+
+const WorkingSet WORKING_SETS[] = {
+    { "L2 (16K fields, 128 KB)", 16 * 1024 },
+    { "DRAM (8M fields, 64 MB)", 8 * 1024 * 1024 }
+};
+
+// be64toh on a little-endian host; the portable shift form compiles to bswap
+inline std::uint64_t swap_bytes(std::uint64_t v) {
+    return (v >> 56) | ((v >> 40) & 0xff00u) | ((v >> 24) & 0xff0000u) | ((v >> 8) & 0xff000000u)
+         | ((v & 0xff000000u) << 8) | ((v & 0xff0000u) << 24) | ((v & 0xff00u) << 40) | (v << 56);
+}
+
+// Big-endian int64 fields that fit To
+template<typename To>
+std::vector<unsigned char> generate_wire(size_t count) {
+    std::vector<unsigned char> bytes(count * 8);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<long long> dis(std::numeric_limits<To>::min(), std::numeric_limits<To>::max());
+    for (size_t i = 0; i < count; ++i) {
+        std::uint64_t bits = swap_bytes(static_cast<std::uint64_t>(dis(gen)));
+        std::memcpy(&bytes[i * 8], &bits, 8);
+    }
+    return bytes;
+}
+
+template<typename To>
+void run_working_set(const WorkingSet& ws, const char* target, int num_runs) {
+    std::vector<unsigned char> wire = generate_wire<To>(ws.elements);
+    std::vector<std::int64_t> host(ws.elements);
+    std::vector<To> out(ws.elements);
+    size_t repeats = std::max<size_t>(1, ELEMENTS_PER_MEASUREMENT / ws.elements);
+
+    print_throughput_header(std::string(ws.name) + ", int64 -> " + target);
+
+    // Bytes counted: 8 read + sizeof(To) written per field
+    const double bytes_per_element = static_cast<double>(8 + sizeof(To));
+
+    BenchmarkStats stats = measure_kernel("memcpy + swap pass + numeric_cast_n", [&]() {
+        std::memcpy(host.data(), wire.data(), wire.size());
+        for (size_t i = 0; i < host.size(); ++i) {
+            host[i] = static_cast<std::int64_t>(swap_bytes(static_cast<std::uint64_t>(host[i])));
+        }
+        numeric_cast_n(host.data(), host.size(), out.data());
+        benchmark_keep(out[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("memcpy + swap + numeric_cast loop", [&]() {
+        for (size_t i = 0; i < out.size(); ++i) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &wire[i * 8], 8);
+            out[i] = numeric_cast<To>(static_cast<std::int64_t>(swap_bytes(bits)));
+        }
+        benchmark_keep(out[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("try_load_be_cast_n", [&]() {
+        bulk_result r = try_load_be_cast_n<To, std::int64_t>(wire.data(), out.size(), out.data());
+        benchmark_keep(r.index);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Big-Endian Wire Field Benchmark (int64 -> int32 / int16)" << std::endl;
+    std::cout << "===============================================================" << std::endl;
+    std::cout << "Fields per run: " << ELEMENTS_PER_MEASUREMENT << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << "SIMD: " << (NCAST_HAS_SSSE3 ? "SSSE3" : (NCAST_HAS_SSE2 ? "SSE2" : "none (scalar)")) << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_working_set<std::int32_t>(ws, "int32", num_runs);
+        run_working_set<std::int16_t>(ws, "int16", num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file benchmark_exact.cpp
+ * @brief Integer IDs to float / double with an exactness check
+ *
+ * Compares, on L2-resident ID columns (int32 -> float, int64 -> double):
+ * 1. static_cast loop (rounds silently)
+ * 2. Scalar round-trip check per element (static_cast back and compare)
+ * 3. try_numeric_cast_n without checks (numeric_cast rules: rounding allowed)
+ * 4. try_numeric_cast_n with float_checks::exact (vectorized abs / shift / compare)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for AVX2 / AVX-512 code generation.
+ *
+ * Usage: ./benchmark_exact [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_bulk.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t VALUES = 32 * 1024;
+const size_t REPEATS = 2048;
+const int DEFAULT_RUNS = 3;
+
+// IDs below the significand limit, so every element is exact and every method does full work
+template<typename Int, typename Float>
+std::vector<Int> generate_ids(size_t count) {
+    std::vector<Int> data(count);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    const Int limit = static_cast<Int>(Int(1) << std::numeric_limits<Float>::digits);
+    std::uniform_int_distribution<Int> dis(-limit, limit);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+template<typename Float, typename Int>
+size_t round_trip_loop(const Int* src, size_t count, Float* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        Float converted = static_cast<Float>(src[i]);
+        if (static_cast<long double>(converted) != static_cast<long double>(src[i])) {
+            return i;
+        }
+        dst[i] = converted;
+    }
+    return count;
+}
+
+template<typename Int, typename Float>
+void run_pair(const char* name, int num_runs) {
+    std::vector<Int> ids = generate_ids<Int, Float>(VALUES);
+    std::vector<Float> out(VALUES);
+    const double bytes_per_element = static_cast<double>(sizeof(Int) + sizeof(Float));
+
+    std::ostringstream title;
+    title << name << ", " << VALUES / 1024 << "K IDs";
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("static_cast loop (unchecked)", [&]() {
+        for (size_t i = 0; i < VALUES; ++i) {
+            out[i] = static_cast<Float>(ids[i]);
+        }
+        benchmark_keep(out[VALUES / 2]);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("scalar round-trip check", [&]() {
+        benchmark_keep(round_trip_loop(ids.data(), VALUES, out.data()));
+        benchmark_keep(out[VALUES / 2]);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("try_numeric_cast_n (rounding)", [&]() {
+        benchmark_keep(try_numeric_cast_n(ids.data(), VALUES, out.data()).index);
+        benchmark_keep(out[VALUES / 2]);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("try_numeric_cast_n (exact)", [&]() {
+        benchmark_keep(try_numeric_cast_n(ids.data(), VALUES, out.data(), float_checks::exact).index);
+        benchmark_keep(out[VALUES / 2]);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Exact Integer -> Floating-Point Benchmark" << std::endl;
+    std::cout << "===============================================" << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    run_pair<std::int32_t, float>("int32 -> float", num_runs);
+    run_pair<std::int64_t, double>("int64 -> double", num_runs);
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
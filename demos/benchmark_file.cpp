@@ -0,0 +1,315 @@
+/**
+ * @file benchmark_file.cpp
+ * @brief Streaming narrowing of binary column files: throughput and peak memory
+ *
+ * Benchmark mode converts a generated int64 column file into an int32 file:
+ * 1. read the whole file into a vector, numeric_cast_n, write the result
+ * 2. try_numeric_cast_file (windows mapped one at a time, stop at the first failure)
+ * 3. convert_file_with_failures (same windows, every failure reported and replaced)
+ * Each method runs in its own child process (POSIX) so that its peak
+ * resident set size can be reported separately. A second file with a few
+ * out-of-range values shows the failing offsets each mode reports.
+ *
+ * Tool mode converts any column file:
+ *   ./benchmark_file convert <from> <to> <input> <output> [--every]
+ * with types i8, u8, i16, u16, i32, u32, i64, u64, f32 and f64. Without
+ * --every it stops at the first failing element; with it, failing elements
+ * are written as 0 and every failing offset is printed.
+ *
+ * Usage: ./benchmark_file [number_of_runs] [size_in_MB]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/ncast/ncast_file.h"
+#include "benchmark_utils.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define BENCHMARK_HAS_FORK 1
+#else
+#define BENCHMARK_HAS_FORK 0
+#endif
+
+using namespace ncast;
+
+// Configuration
+const size_t DEFAULT_MB = 512;
+const int DEFAULT_RUNS = 3;
+const char* INPUT_PATH = "benchmark_file_input.i64";
+const char* BAD_INPUT_PATH = "benchmark_file_bad.i64";
+const char* OUTPUT_PATH = "benchmark_file_output.i32";
+
+struct Method {
+    const char* name;
+    int id;
+};
+
+const Method METHODS[] = {
+    { "read all + numeric_cast_n + write", 0 },
+    { "try_numeric_cast_file", 1 },
+    { "convert_file_with_failures", 2 }
+};
+
+// int64 values that fit int32, written in 1 MB blocks; bad lists indexes set out of range
+bool generate_column(const char* path, size_t count, const std::vector<size_t>& bad) {
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    std::vector<std::int64_t> block(128 * 1024);
+    std::uint64_t state = 88172645463325252ull;
+    size_t next_bad = 0;
+    bool ok = true;
+    for (size_t base = 0; base < count && ok; base += block.size()) {
+        size_t n = count - base < block.size() ? count - base : block.size();
+        for (size_t i = 0; i < n; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            block[i] = static_cast<std::int32_t>(state >> 32);
+        }
+        for (; next_bad < bad.size() && bad[next_bad] < base + n; ++next_bad) {
+            block[bad[next_bad] - base] = 5000000000LL;
+        }
+        ok = std::fwrite(block.data(), sizeof(std::int64_t), n, file) == n;
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+// Runs one conversion of the input file and returns the time in ms
+double run_once(int method) {
+    BenchmarkTimer timer;
+    timer.start();
+    if (method == 0) {
+        std::FILE* in = std::fopen(INPUT_PATH, "rb");
+        std::fseek(in, 0, SEEK_END);
+        size_t count = static_cast<size_t>(std::ftell(in)) / sizeof(std::int64_t);
+        std::rewind(in);
+        std::vector<std::int64_t> src(count);
+        benchmark_keep(std::fread(src.data(), sizeof(std::int64_t), count, in));
+        std::fclose(in);
+        std::vector<std::int32_t> dst(count);
+        numeric_cast_n(src.data(), count, dst.data());
+        std::FILE* out = std::fopen(OUTPUT_PATH, "wb");
+        benchmark_keep(std::fwrite(dst.data(), sizeof(std::int32_t), count, out));
+        std::fclose(out);
+    } else if (method == 1) {
+        benchmark_keep(try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT_PATH, OUTPUT_PATH).count);
+    } else {
+        benchmark_keep(convert_file_with_failures<std::int32_t, std::int64_t>(INPUT_PATH, OUTPUT_PATH,
+            [](std::uint64_t, cast_error) {}).count);
+    }
+    return timer.stop();
+}
+
+BenchmarkStats measure_method(const Method& method, int num_runs) {
+    BenchmarkStats stats;
+    stats.name = method.name;
+    run_once(method.id);    // Warm-up: brings the input into the page cache
+    for (int run = 0; run < num_runs; ++run) {
+        stats.times.push_back(run_once(method.id));
+    }
+    stats.calculate_stats();
+    return stats;
+}
+
+void print_row(const BenchmarkStats& stats, size_t count, double peak_mb) {
+    double seconds = stats.median / 1000.0;
+    double gb_per_s = seconds > 0.0 ? static_cast<double>(count) * 12.0 / seconds / 1e9 : 0.0;
+    std::cout << std::setw(36) << std::left << stats.name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(2) << stats.median
+              << std::setw(10) << std::setprecision(2) << gb_per_s;
+    if (peak_mb > 0.0) {
+        std::cout << std::setw(12) << std::setprecision(0) << peak_mb;
+    } else {
+        std::cout << std::setw(12) << "n/a";
+    }
+    std::cout << std::endl;
+}
+
+// ---------------------------------------------------------------------------
+// Tool mode
+// ---------------------------------------------------------------------------
+
+template<typename ToType, typename FromType>
+int convert_file(const char* input, const char* output, bool every) {
+    BenchmarkTimer timer;
+    timer.start();
+    file_cast_result r;
+    if (every) {
+        r = convert_file_with_failures<ToType, FromType>(input, output, [](std::uint64_t index, cast_error error) {
+            std::cout << "element " << index << " (byte offset " << index * sizeof(FromType) << "): "
+                      << detail::cast_error_message(error) << std::endl;
+        });
+    } else {
+        r = try_numeric_cast_file<ToType, FromType>(input, output);
+    }
+    double seconds = timer.stop() / 1000.0;
+
+    std::cout << r.count << " elements, " << r.failures << " failed";
+    if (!r.ok()) {
+        std::cout << "; first at element " << r.first_index << " (byte offset " << r.first_index * sizeof(FromType)
+                  << "): " << detail::cast_error_message(r.first_error);
+    }
+    std::cout << std::endl;
+    const double bytes = static_cast<double>(r.count) * static_cast<double>(sizeof(FromType) + sizeof(ToType));
+    std::cout << std::fixed << std::setprecision(2) << seconds * 1000.0 << " ms, "
+              << (seconds > 0.0 ? bytes / seconds / 1e9 : 0.0) << " GB/s" << std::endl;
+    return r.ok() ? 0 : 2;
+}
+
+template<typename FromType>
+int convert_from(const std::string& to, const char* input, const char* output, bool every) {
+    if (to == "i8") return convert_file<std::int8_t, FromType>(input, output, every);
+    if (to == "u8") return convert_file<std::uint8_t, FromType>(input, output, every);
+    if (to == "i16") return convert_file<std::int16_t, FromType>(input, output, every);
+    if (to == "u16") return convert_file<std::uint16_t, FromType>(input, output, every);
+    if (to == "i32") return convert_file<std::int32_t, FromType>(input, output, every);
+    if (to == "u32") return convert_file<std::uint32_t, FromType>(input, output, every);
+    if (to == "i64") return convert_file<std::int64_t, FromType>(input, output, every);
+    if (to == "u64") return convert_file<std::uint64_t, FromType>(input, output, every);
+    if (to == "f32") return convert_file<float, FromType>(input, output, every);
+    if (to == "f64") return convert_file<double, FromType>(input, output, every);
+    std::cerr << "Error: unknown target type " << to << std::endl;
+    return 1;
+}
+
+int run_tool(int argc, char* argv[]) {
+    if (argc < 6 || (argc == 7 && std::strcmp(argv[6], "--every") != 0) || argc > 7) {
+        std::cerr << "Usage: " << argv[0] << " convert <from> <to> <input> <output> [--every]" << std::endl;
+        return 1;
+    }
+    const std::string from = argv[2];
+    const bool every = argc == 7;
+    try {
+        if (from == "i8") return convert_from<std::int8_t>(argv[3], argv[4], argv[5], every);
+        if (from == "u8") return convert_from<std::uint8_t>(argv[3], argv[4], argv[5], every);
+        if (from == "i16") return convert_from<std::int16_t>(argv[3], argv[4], argv[5], every);
+        if (from == "u16") return convert_from<std::uint16_t>(argv[3], argv[4], argv[5], every);
+        if (from == "i32") return convert_from<std::int32_t>(argv[3], argv[4], argv[5], every);
+        if (from == "u32") return convert_from<std::uint32_t>(argv[3], argv[4], argv[5], every);
+        if (from == "i64") return convert_from<std::int64_t>(argv[3], argv[4], argv[5], every);
+        if (from == "u64") return convert_from<std::uint64_t>(argv[3], argv[4], argv[5], every);
+        if (from == "f32") return convert_from<float>(argv[3], argv[4], argv[5], every);
+        if (from == "f64") return convert_from<double>(argv[3], argv[4], argv[5], every);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cerr << "Error: unknown source type " << from << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "convert") == 0) {
+        return run_tool(argc, argv);
+    }
+
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+    size_t megabytes = DEFAULT_MB;
+    if (argc > 2) {
+        int requested = std::atoi(argv[2]);
+        if (requested <= 0) {
+            std::cerr << "Error: File size must be positive" << std::endl;
+            return 1;
+        }
+        megabytes = static_cast<size_t>(requested);
+    }
+    const size_t count = megabytes * 1024 * 1024 / sizeof(std::int64_t);
+    if (!generate_column(INPUT_PATH, count, std::vector<size_t>())) {
+        std::cerr << "Error: cannot write " << INPUT_PATH << std::endl;
+        return 1;
+    }
+
+    std::cout << "ncast File Narrowing Benchmark (int64 -> int32)" << std::endl;
+    std::cout << "===============================================" << std::endl;
+    std::cout << "Input: " << megabytes << " MB, " << count << " elements; window: "
+              << detail::file_window_bytes / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    std::cout << std::setw(36) << std::left << "Method" << std::right
+              << std::setw(12) << "Median ms"
+              << std::setw(10) << "GB/s"
+              << std::setw(12) << "Peak MB" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+
+    int status = 0;
+    for (const Method& method : METHODS) {
+#if BENCHMARK_HAS_FORK
+        std::cout.flush();
+        pid_t child = fork();
+        if (child < 0) {
+            std::cerr << "Error: fork failed" << std::endl;
+            status = 1;
+            break;
+        }
+        if (child == 0) {
+            BenchmarkStats stats = measure_method(method, num_runs);
+            struct rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+            double peak_mb = static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+#else
+            double peak_mb = static_cast<double>(usage.ru_maxrss) / 1024.0;             // kilobytes
+#endif
+            print_row(stats, count, peak_mb);
+            std::cout.flush();
+            _exit(0);
+        }
+        int child_status = 0;
+        waitpid(child, &child_status, 0);
+        if (!WIFEXITED(child_status) || WEXITSTATUS(child_status) != 0) {
+            std::cerr << "Error: " << method.name << " failed" << std::endl;
+            status = 1;
+            break;
+        }
+#else
+        print_row(measure_method(method, num_runs), count, 0.0);
+#endif
+    }
+    std::cout << std::endl;
+
+    // Failing offsets: three out-of-range values in the first 64 MB
+    std::vector<size_t> bad;
+    bad.push_back(1000003);
+    bad.push_back(2097152);
+    bad.push_back(7777777);
+    const size_t bad_count = 8 * 1024 * 1024;
+    if (status == 0 && generate_column(BAD_INPUT_PATH, bad_count, bad)) {
+        file_cast_result first = try_numeric_cast_file<std::int32_t, std::int64_t>(BAD_INPUT_PATH, OUTPUT_PATH);
+        std::cout << "First-failure mode: stopped at element " << first.first_index << " (byte offset "
+                  << first.first_index * sizeof(std::int64_t) << "), "
+                  << detail::cast_error_message(first.first_error) << std::endl;
+        std::cout << "Every-failure mode:";
+        file_cast_result every = convert_file_with_failures<std::int32_t, std::int64_t>(BAD_INPUT_PATH, OUTPUT_PATH,
+            [](std::uint64_t index, cast_error) { std::cout << " " << index; });
+        std::cout << " (" << every.failures << " of " << every.count << " elements)" << std::endl;
+        if (first.first_index != bad[0] || every.failures != bad.size()) {
+            std::cerr << "Error: unexpected failing offsets" << std::endl;
+            status = 1;
+        }
+        std::cout << std::endl;
+    }
+
+    std::remove(INPUT_PATH);
+    std::remove(BAD_INPUT_PATH);
+    std::remove(OUTPUT_PATH);
+    if (status == 0) {
+        std::cout << "GB/s counts 12 bytes (read + written) per element." << std::endl;
+        std::cout << "Benchmark completed successfully!" << std::endl;
+    }
+    return status;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file benchmark_inplace.cpp
+ * @brief Throughput and peak memory of narrowing a large uint64 vector to uint32
+ *
+ * Compares:
+ * 1. numeric_cast loop into a second std::vector<uint32_t>
+ * 2. convert_if_fits into a second std::vector<uint32_t>
+ * 3. narrow_in_place: validates and compacts inside the original storage
+ *
+ * Each method runs in its own child process (POSIX) so that its peak
+ * resident set size can be reported separately.
+ *
+ * Usage: ./benchmark_inplace [number_of_runs] [elements_in_millions]
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "../include/ncast/ncast_narrow.h"
+#include "benchmark_utils.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define BENCHMARK_HAS_FORK 1
+#else
+#define BENCHMARK_HAS_FORK 0
+#endif
+
+using namespace ncast;
+
+// Configuration
+const size_t DEFAULT_MILLIONS = 32;  // 256 MB of uint64
+const int DEFAULT_RUNS = 3;
+
+struct Method {
+    const char* name;
+    int id;
+};
+
+const Method METHODS[] = {
+    { "numeric_cast loop (copy)", 0 },
+    { "convert_if_fits (copy)", 1 },
+    { "narrow_in_place", 2 }
+};
+
+void fill(std::vector<std::uint64_t>& data, size_t count) {
+    data.resize(count);
+    std::uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = state >> 32;  // fits uint32
+    }
+}
+
+// Runs one narrowing of a freshly filled vector and returns the narrowing time in ms
+double run_once(int method, size_t count) {
+    std::vector<std::uint64_t> src;
+    fill(src, count);
+    BenchmarkTimer timer;
+    double elapsed = 0.0;
+
+    if (method == 0) {
+        timer.start();
+        std::vector<std::uint32_t> dst(src.size());
+        for (size_t i = 0; i < src.size(); ++i) {
+            dst[i] = numeric_cast<std::uint32_t>(src[i]);
+        }
+        elapsed = timer.stop();
+        benchmark_keep(dst[count / 2]);
+    } else if (method == 1) {
+        timer.start();
+        std::vector<std::uint32_t> dst(src.size());
+        bool converted = convert_if_fits(src.data(), src.size(), dst.data());
+        elapsed = timer.stop();
+        benchmark_keep(converted);
+        benchmark_keep(dst[count / 2]);
+    } else {
+        timer.start();
+        narrowed_vector<std::uint32_t, std::uint64_t> dst = narrow_in_place<std::uint32_t>(std::move(src));
+        elapsed = timer.stop();
+        benchmark_keep(dst[count / 2]);
+    }
+    return elapsed;
+}
+
+void print_row(const BenchmarkStats& stats, size_t count, double peak_mb, double source_mb) {
+    double seconds = stats.median / 1000.0;
+    double gb_per_s = seconds > 0.0 ? static_cast<double>(count) * 12.0 / seconds / 1e9 : 0.0;
+    std::cout << std::setw(30) << std::left << stats.name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(2) << stats.median
+              << std::setw(10) << std::setprecision(2) << gb_per_s;
+    if (peak_mb > 0.0) {
+        std::cout << std::setw(12) << std::setprecision(0) << peak_mb
+                  << std::setw(12) << std::setprecision(0) << (peak_mb - source_mb);
+    } else {
+        std::cout << std::setw(12) << "n/a" << std::setw(12) << "n/a";
+    }
+    std::cout << std::endl;
+}
+
+BenchmarkStats measure_method(const Method& method, size_t count, int num_runs) {
+    BenchmarkStats stats;
+    stats.name = method.name;
+    for (int run = 0; run < num_runs; ++run) {
+        stats.times.push_back(run_once(method.id, count));
+    }
+    stats.calculate_stats();
+    return stats;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+    size_t millions = DEFAULT_MILLIONS;
+    if (argc > 2) {
+        int requested = std::atoi(argv[2]);
+        if (requested <= 0) {
+            std::cerr << "Error: Element count must be positive" << std::endl;
+            return 1;
+        }
+        millions = static_cast<size_t>(requested);
+    }
+    const size_t count = millions * 1000000;
+    const double source_mb = static_cast<double>(count) * 8.0 / (1024.0 * 1024.0);
+
+    std::cout << "ncast In-place Narrowing Benchmark (uint64 -> uint32)" << std::endl;
+    std::cout << "====================================================" << std::endl;
+    std::cout << "Elements: " << count << " (" << std::fixed << std::setprecision(0) << source_mb << " MB source)" << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    std::cout << std::setw(30) << std::left << "Method" << std::right
+              << std::setw(12) << "Median ms"
+              << std::setw(10) << "GB/s"
+              << std::setw(12) << "Peak MB"
+              << std::setw(12) << "Extra MB" << std::endl;
+    std::cout << std::string(76, '-') << std::endl;
+
+    for (const Method& method : METHODS) {
+#if BENCHMARK_HAS_FORK
+        std::cout.flush();
+        pid_t child = fork();
+        if (child < 0) {
+            std::cerr << "Error: fork failed" << std::endl;
+            return 1;
+        }
+        if (child == 0) {
+            BenchmarkStats stats = measure_method(method, count, num_runs);
+            struct rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+            double peak_mb = static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+#else
+            double peak_mb = static_cast<double>(usage.ru_maxrss) / 1024.0;             // kilobytes
+#endif
+            print_row(stats, count, peak_mb, source_mb);
+            std::cout.flush();
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cerr << "Error: " << method.name << " failed" << std::endl;
+            return 1;
+        }
+#else
+        print_row(measure_method(method, count, num_runs), count, 0.0, source_mb);
+#endif
+    }
+
+    std::cout << std::endl;
+    std::cout << "GB/s counts 8 bytes read + 4 bytes written per element." << std::endl;
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file benchmark_iterator.cpp
+ * @brief Lazy checked conversion versus materializing a converted copy
+ *
+ * Sums an int64 column as int32 values with:
+ * 1. std::accumulate with static_cast in the operation (unchecked)
+ * 2. numeric_cast_n into a temporary vector, then std::accumulate
+ * 3. std::accumulate over checked_cast_iterator (throw_policy)
+ * 4. std::accumulate over checked_cast_iterator with replace_policy<> (saturate)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for AVX2 code generation.
+ *
+ * Usage: ./benchmark_iterator [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../include/ncast/ncast_iterator.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ELEMENTS_PER_MEASUREMENT = 16 * 1024 * 1024;  // Elements summed per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t elements;
+};
+
+const WorkingSet WORKING_SETS[] = {
+    { "L2 (32K elements, 256 KB)", 32 * 1024 },
+    { "DRAM (8M elements, 64 MB)", 8 * 1024 * 1024 }
+};
+
+std::vector<std::int64_t> generate_column(size_t count) {
+    std::vector<std::int64_t> data(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<std::int64_t> dis(-1000000, 1000000);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+void run_working_set(const WorkingSet& ws, int num_runs) {
+    std::vector<std::int64_t> column = generate_column(ws.elements);
+    std::vector<std::int32_t> copy;
+    size_t repeats = std::max<size_t>(1, ELEMENTS_PER_MEASUREMENT / ws.elements);
+    const double bytes_per_element = static_cast<double>(sizeof(std::int64_t));
+
+    print_throughput_header(ws.name);
+
+    BenchmarkStats stats = measure_kernel("accumulate static_cast (unchecked)", [&]() {
+        long long total = std::accumulate(column.begin(), column.end(), 0LL, [](long long sum, std::int64_t v) {
+            return sum + static_cast<std::int32_t>(v);
+        });
+        benchmark_keep(total);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("numeric_cast_n copy + accumulate", [&]() {
+        copy.resize(column.size());
+        numeric_cast_n(column.data(), column.size(), copy.data());
+        long long total = std::accumulate(copy.begin(), copy.end(), 0LL);
+        benchmark_keep(total);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("checked_cast_iterator (throw)", [&]() {
+        long long total = std::accumulate(make_checked_cast_iterator<std::int32_t>(column.begin()),
+                                          make_checked_cast_iterator<std::int32_t>(column.end()), 0LL);
+        benchmark_keep(total);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("checked_cast_iterator (saturate)", [&]() {
+        long long total = std::accumulate(make_checked_cast_iterator<std::int32_t, replace_policy<> >(column.begin()),
+                                          make_checked_cast_iterator<std::int32_t, replace_policy<> >(column.end()), 0LL);
+        benchmark_keep(total);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Lazy Conversion Iterator Benchmark (sum of int64 as int32)" << std::endl;
+    std::cout << "================================================================" << std::endl;
+    std::cout << "Elements per run: " << ELEMENTS_PER_MEASUREMENT << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_working_set(ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
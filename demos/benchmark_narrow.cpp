@@ -0,0 +1,178 @@
+/**
+ * @file benchmark_narrow.cpp
+ * @brief Benchmark for narrowest-type selection of int64 columns
+ *
+ * Uses skewed, realistic column contents (mostly small values with rare
+ * outliers) and compares:
+ * 1. std::minmax_element + manual type selection (scalar baseline)
+ * 2. narrowest_integral_type (vectorized min/max scan + fits_in)
+ * 3. std::minmax_element + numeric_cast copy loop into the selected type
+ * 4. narrow_to_fit (scan + static_cast copy into a narrowed_buffer)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON to use the AVX2 scan kernel.
+ *
+ * Usage: ./benchmark_narrow [number_of_runs]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_narrow.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t COLUMN_SIZE = 4 * 1024 * 1024;  // 32 MB of int64 per column
+const int DEFAULT_RUNS = 5;
+
+struct Column {
+    const char* name;
+    std::vector<std::int64_t> values;
+};
+
+// Event counts: geometric distribution, a few rare large bursts
+std::vector<std::int64_t> generate_counts(std::mt19937_64& gen) {
+    std::geometric_distribution<int> small(0.3);
+    std::uniform_int_distribution<int> burst(1000, 60000);
+    std::uniform_int_distribution<int> percent(0, 9999);
+    std::vector<std::int64_t> data(COLUMN_SIZE);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = percent(gen) == 0 ? burst(gen) : small(gen);
+    }
+    return data;
+}
+
+// Foreign keys with -1 as "missing" sentinel, Zipf-like skew towards small ids
+std::vector<std::int64_t> generate_keys(std::mt19937_64& gen) {
+    std::exponential_distribution<double> skew(1.0 / 20000.0);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<std::int64_t> data(COLUMN_SIZE);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = percent(gen) == 0 ? -1 : static_cast<std::int64_t>(skew(gen));
+    }
+    return data;
+}
+
+// HTTP status-like codes: a handful of values dominate
+std::vector<std::int64_t> generate_codes(std::mt19937_64& gen) {
+    const std::int64_t codes[] = { 200, 200, 200, 200, 200, 200, 204, 201, 204, 200, 200, 200, 200, 200, 200, 200 };
+    std::uniform_int_distribution<int> pick(0, 15);
+    std::vector<std::int64_t> data(COLUMN_SIZE);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = codes[pick(gen)];
+    }
+    return data;
+}
+
+// Millisecond timestamps: need the full 64-bit range
+std::vector<std::int64_t> generate_timestamps(std::mt19937_64& gen) {
+    std::uniform_int_distribution<int> step(0, 50);
+    std::vector<std::int64_t> data(COLUMN_SIZE);
+    std::int64_t t = 1700000000000LL;
+    for (size_t i = 0; i < data.size(); ++i) {
+        t += step(gen);
+        data[i] = t;
+    }
+    return data;
+}
+
+integral_type select_type_scalar(const std::vector<std::int64_t>& data) {
+    if (data.empty()) {
+        return integral_type::uint8;
+    }
+    auto extremes = std::minmax_element(data.begin(), data.end());
+    std::int64_t lo = *extremes.first;
+    std::int64_t hi = *extremes.second;
+    if (lo < 0) {
+        if (lo >= -128 && hi <= 127) return integral_type::int8;
+        if (lo >= -32768 && hi <= 32767) return integral_type::int16;
+        if (lo >= -2147483647LL - 1 && hi <= 2147483647LL) return integral_type::int32;
+        return integral_type::int64;
+    }
+    if (hi <= 255) return integral_type::uint8;
+    if (hi <= 65535) return integral_type::uint16;
+    if (hi <= 4294967295LL) return integral_type::uint32;
+    return integral_type::uint64;
+}
+
+// Baseline narrowing: scalar scan, then numeric_cast every element
+struct numeric_cast_copy {
+    const std::vector<std::int64_t>* src;
+
+    template<typename T>
+    void operator()(T* dst, std::size_t count) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = numeric_cast<T>((*src)[i]);
+        }
+    }
+};
+
+void run_column(const Column& column, int num_runs) {
+    const std::vector<std::int64_t>& data = column.values;
+    integral_type selected = narrowest_integral_type(data.data(), data.size());
+    std::ostringstream title;
+    title << column.name << " -> " << integral_type_name(selected) << ", "
+          << 8 / integral_type_size(selected) << "x smaller";
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("minmax_element + select", [&]() {
+        benchmark_keep(static_cast<int>(select_type_scalar(data)));
+    }, num_runs, 1);
+    print_throughput_row(stats, data.size(), 1, 8.0);
+
+    stats = measure_kernel("narrowest_integral_type", [&]() {
+        benchmark_keep(static_cast<int>(narrowest_integral_type(data.data(), data.size())));
+    }, num_runs, 1);
+    print_throughput_row(stats, data.size(), 1, 8.0);
+
+    double narrow_bytes = 8.0 + static_cast<double>(integral_type_size(selected));
+    stats = measure_kernel("minmax + numeric_cast copy", [&]() {
+        narrowed_buffer out(select_type_scalar(data), data.size());
+        numeric_cast_copy copy = { &data };
+        out.visit(copy);
+        benchmark_keep(out.size_bytes());
+    }, num_runs, 1);
+    print_throughput_row(stats, data.size(), 1, narrow_bytes);
+
+    stats = measure_kernel("narrow_to_fit", [&]() {
+        narrowed_buffer out = narrow_to_fit(data.data(), data.size());
+        benchmark_keep(out.size_bytes());
+    }, num_runs, 1);
+    print_throughput_row(stats, data.size(), 1, narrow_bytes);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Narrowest Type Selection Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Elements per column: " << COLUMN_SIZE << " (int64)" << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << "SIMD: " << (NCAST_HAS_AVX2 ? "AVX2" : "none (scalar)") << std::endl;
+    std::cout << std::endl;
+
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    Column columns[] = {
+        { "event counts (geometric, rare bursts)", generate_counts(gen) },
+        { "foreign keys (skewed, -1 sentinel)", generate_keys(gen) },
+        { "status codes (few distinct values)", generate_codes(gen) },
+        { "timestamps (epoch ms)", generate_timestamps(gen) }
+    };
+
+    for (const Column& column : columns) {
+        run_column(column, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
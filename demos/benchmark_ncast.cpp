@@ -26,8 +26,8 @@
 #include <numeric>
 #include "../include/ncast/ncast.h"
 #include "benchmark_ncast_no_validation.h"
+#include "benchmark_utils.h"
 
-using namespace std::chrono;
 using namespace ncast;
 
 // Configuration
@@ -35,63 +35,6 @@ const size_t ITERATIONS = 50000000;  // 50 million iterations for ~5 seconds per
 const size_t WARMUP_ITERATIONS = 5000000;  // 5 million iterations for warm-up
 const int DEFAULT_RUNS = 5;  // Default number of benchmark runs
 
-struct BenchmarkStats {
-    std::string name;
-    std::vector<double> times;
-    double average;
-    double median;
-    double std_dev;
-    double min_time;
-    double max_time;
-    
-    void calculate_stats() {
-        if (times.empty()) return;
-        
-        // Sort for median calculation
-        std::vector<double> sorted_times = times;
-        std::sort(sorted_times.begin(), sorted_times.end());
-        
-        // Calculate average
-        average = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
-        
-        // Calculate median
-        size_t n = sorted_times.size();
-        if (n % 2 == 0) {
-            median = (sorted_times[n/2 - 1] + sorted_times[n/2]) / 2.0;
-        } else {
-            median = sorted_times[n/2];
-        }
-        
-        // Calculate standard deviation
-        double sum_sq_diff = 0.0;
-        for (double time : times) {
-            double diff = time - average;
-            sum_sq_diff += diff * diff;
-        }
-        std_dev = std::sqrt(sum_sq_diff / static_cast<double>(times.size()));
-        
-        // Min and max
-        min_time = *std::min_element(times.begin(), times.end());
-        max_time = *std::max_element(times.begin(), times.end());
-    }
-};
-
-class BenchmarkTimer {
-private:
-    high_resolution_clock::time_point start_time;
-    
-public:
-    void start() {
-        start_time = high_resolution_clock::now();
-    }
-    
-    double stop() {
-        auto end_time = high_resolution_clock::now();
-        auto duration = duration_cast<microseconds>(end_time - start_time);
-        return static_cast<double>(duration.count()) / 1000.0; // Return milliseconds
-    }
-};
-
 // Heavy computation function using static_cast
 double heavy_computation_static_cast(const std::vector<long>& data) {
     double result = 0.0;
@@ -0,0 +1,234 @@
+/**
+ * @file benchmark_parse.cpp
+ * @brief Parsing decimal text columns into integer types
+ *
+ * Compares, for comma-separated int16, int32 and uint64 columns, for
+ * fixed-width columns (13-digit millisecond timestamps, 8-digit IDs) and
+ * for float and double columns and for hexadecimal hash columns:
+ * 1. strtoll / strtoull / strtod + numeric_cast (parse wide, then range-check)
+ * 2. std::from_chars (C++17 builds)
+ * 3. parse_cast (integers: 8-digit SWAR words in the target width, one
+ *    bound check; floating point: correctly rounded straight into the target;
+ *    hexadecimal: 16 digits per SSSE3 block, overflow from the digit count)
+ *
+ * Usage: ./benchmark_parse [number_of_runs]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include "../include/ncast/ncast_parse.h"
+#include "benchmark_utils.h"
+#if NCAST_HAS_CPP17
+#include <charconv>
+#endif
+
+using namespace ncast;
+
+// Configuration
+const size_t VALUES = 1024 * 1024;
+const size_t REPEATS = 4;
+const int DEFAULT_RUNS = 3;
+
+// Comma-separated column of values of T drawn from all bit patterns
+template<typename T>
+std::string generate_column(size_t count) {
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    std::ostringstream text;
+    for (size_t i = 0; i < count; ++i) {
+        text << +static_cast<T>(gen()) << ',';
+    }
+    return text.str();
+}
+
+// Comma-separated column of values with exactly digits digits
+template<typename T>
+std::string generate_fixed_width_column(size_t count, int digits) {
+    std::mt19937_64 gen(42);
+    std::uint64_t low = 1;
+    for (int i = 1; i < digits; ++i) {
+        low *= 10u;
+    }
+    std::uniform_int_distribution<std::uint64_t> dist(low, low * 10u - 1u);
+    std::ostringstream text;
+    for (size_t i = 0; i < count; ++i) {
+        text << static_cast<T>(dist(gen)) << ',';
+    }
+    return text.str();
+}
+
+// Comma-separated column of floating-point values printed with the given number of significant digits
+template<typename T>
+std::string generate_float_column(size_t count, double low, double high, int digits) {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(low, high);
+    std::string text;
+    char field[64];
+    for (size_t i = 0; i < count; ++i) {
+        std::snprintf(field, sizeof(field), "%.*g,", digits, static_cast<double>(static_cast<T>(dist(gen))));
+        text += field;
+    }
+    return text;
+}
+
+// Comma-separated column of zero-padded hexadecimal values of T (hashes, checksums)
+template<typename T>
+std::string generate_hex_column(size_t count) {
+    std::mt19937_64 gen(42);
+    std::string text;
+    char field[32];
+    for (size_t i = 0; i < count; ++i) {
+        std::snprintf(field, sizeof(field), "%0*llx,", static_cast<int>(2 * sizeof(T)),
+                      static_cast<unsigned long long>(static_cast<T>(gen())));
+        text += field;
+    }
+    return text;
+}
+
+// The standard parser and its result type for T
+inline long long parse_wide(const char* text, char** end, int base, long long) {
+    return std::strtoll(text, end, base);
+}
+
+inline unsigned long long parse_wide(const char* text, char** end, int base, unsigned long long) {
+    return std::strtoull(text, end, base);
+}
+
+inline double parse_wide(const char* text, char** end, int, double) {
+    return std::strtod(text, end);
+}
+
+template<typename T>
+struct wide_type {
+    typedef typename std::conditional<std::is_floating_point<T>::value, double,
+        typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type>::type type;
+};
+
+// Checksum type: integers wrap, floating-point values add up
+template<typename T>
+struct sum_type {
+    typedef typename std::conditional<std::is_floating_point<T>::value, double, std::uint64_t>::type type;
+};
+
+template<typename T, int Base>
+typename sum_type<T>::type sum_strtoll(const std::string& column) {
+    const char* p = column.c_str();
+    const char* end = p + column.size();
+    typename sum_type<T>::type sum = 0;
+    while (p != end) {
+        char* next = nullptr;
+        T value = numeric_cast<T>(parse_wide(p, &next, Base, typename wide_type<T>::type()));
+        sum += static_cast<typename sum_type<T>::type>(value);
+        p = next + 1;
+    }
+    return sum;
+}
+
+#if NCAST_HAS_CPP17
+// std::from_chars has a base argument for integers only
+template<int Base, typename T>
+std::from_chars_result from_chars_base(const char* first, const char* last, T& value) {
+    return std::from_chars(first, last, value, Base);
+}
+
+template<int Base>
+std::from_chars_result from_chars_base(const char* first, const char* last, double& value) {
+    return std::from_chars(first, last, value);
+}
+
+template<int Base>
+std::from_chars_result from_chars_base(const char* first, const char* last, float& value) {
+    return std::from_chars(first, last, value);
+}
+
+template<typename T, int Base>
+typename sum_type<T>::type sum_from_chars(const std::string& column) {
+    const char* p = column.data();
+    const char* end = p + column.size();
+    typename sum_type<T>::type sum = 0;
+    while (p != end) {
+        T value = 0;
+        std::from_chars_result r = from_chars_base<Base>(p, end, value);
+        sum += static_cast<typename sum_type<T>::type>(value);
+        p = r.ptr + 1;
+    }
+    return sum;
+}
+#endif
+
+template<typename T, int Base>
+typename sum_type<T>::type sum_parse_cast(const std::string& column) {
+    const char* p = column.data();
+    const char* end = p + column.size();
+    typename sum_type<T>::type sum = 0;
+    while (p != end) {
+        parse_result<T> r = parse_cast<T, Base>(p, end);
+        sum += static_cast<typename sum_type<T>::type>(r.value);
+        p = r.ptr + 1;
+    }
+    return sum;
+}
+
+template<typename T, int Base = 10>
+void run_column(const char* name, const std::string& column, int num_runs) {
+    const double bytes_per_value = static_cast<double>(column.size()) / static_cast<double>(VALUES);
+
+    std::ostringstream title;
+    title << name << ", " << VALUES / 1024 << "K values, " << column.size() / 1024 << " KB of text";
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel(std::is_floating_point<T>::value ? "strtod + numeric_cast"
+                                                                           : "strtoll + numeric_cast", [&]() {
+        benchmark_keep(sum_strtoll<T, Base>(column));
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_value);
+
+#if NCAST_HAS_CPP17
+    stats = measure_kernel("std::from_chars", [&]() {
+        benchmark_keep(sum_from_chars<T, Base>(column));
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_value);
+#endif
+
+    stats = measure_kernel("parse_cast", [&]() {
+        benchmark_keep(sum_parse_cast<T, Base>(column));
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, VALUES, REPEATS, bytes_per_value);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Parse Benchmark" << std::endl;
+    std::cout << "=====================" << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    run_column<std::int16_t>("int16", generate_column<std::int16_t>(VALUES), num_runs);
+    run_column<std::int32_t>("int32", generate_column<std::int32_t>(VALUES), num_runs);
+    run_column<std::uint64_t>("uint64", generate_column<std::uint64_t>(VALUES), num_runs);
+    run_column<std::int64_t>("int64 timestamps (13 digits)", generate_fixed_width_column<std::int64_t>(VALUES, 13),
+                             num_runs);
+    run_column<std::uint32_t>("uint32 IDs (8 digits)", generate_fixed_width_column<std::uint32_t>(VALUES, 8), num_runs);
+    run_column<float>("float readings (6 digits)", generate_float_column<float>(VALUES, -1000.0, 1000.0, 6),
+                      num_runs);
+    run_column<double>("double, round-trip (17 digits)", generate_float_column<double>(VALUES, 0.0, 1.0, 17),
+                       num_runs);
+    run_column<std::uint32_t, 16>("uint32 hashes (8 hex digits)", generate_hex_column<std::uint32_t>(VALUES), num_runs);
+    run_column<std::uint64_t, 16>("uint64 hashes (16 hex digits)", generate_hex_column<std::uint64_t>(VALUES), num_runs);
+
+    std::cout << "GB/s counts text bytes parsed." << std::endl;
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
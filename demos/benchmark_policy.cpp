@@ -0,0 +1,112 @@
+/**
+ * @file benchmark_policy.cpp
+ * @brief Cost of replacement policies versus per-element exception handling
+ *
+ * Converts 1M sensor readings (double, some NaN / out of range) with:
+ * 1. Loop of numeric_cast calls, replacing in the catch handler
+ * 2. convert_with_policy (vector compares and blends, no branches)
+ *
+ * Pairs: double -> int32, float -> uint8, int64 -> uint16, double -> float.
+ * Each runs on a clean batch and on a batch with 1% bad values (half NaN
+ * where the source has NaN, the rest out of range).
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for AVX2 code generation.
+ *
+ * Usage: ./benchmark_policy [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_policy.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ROWS = 1024 * 1024;
+const size_t REPEATS = 16;
+const int DEFAULT_RUNS = 3;
+
+// NaN -> 0, overflow saturates, negative -> 0
+typedef replace_policy<>::on_nan<replace::with_default>::on_negative_to_unsigned<replace::with_default> Policy;
+
+template<typename From>
+std::vector<From> generate_readings(size_t count, double low, double high, double bad_value, double bad_fraction) {
+    std::vector<From> data(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_real_distribution<double> readings(low, high);
+    std::uniform_real_distribution<double> pick(0.0, 1.0);
+    for (size_t i = 0; i < count; ++i) {
+        double r = pick(gen);
+        double value = readings(gen);
+        if (r < bad_fraction / 2) {
+            value = std::numeric_limits<From>::has_quiet_NaN ? std::numeric_limits<double>::quiet_NaN() : bad_value;
+        } else if (r < bad_fraction) {
+            value = bad_value;
+        }
+        data[i] = static_cast<From>(value);
+    }
+    return data;
+}
+
+template<typename To, typename From>
+void run_pair(const char* pair, double low, double high, double bad_value, double bad_fraction, int num_runs) {
+    std::vector<From> src = generate_readings<From>(ROWS, low, high, bad_value, bad_fraction);
+    std::vector<To> dst(ROWS);
+
+    std::ostringstream title;
+    title << pair << ", " << (bad_fraction > 0 ? "1% bad values" : "clean");
+    print_throughput_header(title.str());
+    const double bytes_per_element = static_cast<double>(sizeof(From) + sizeof(To));
+
+    BenchmarkStats stats = measure_kernel("numeric_cast loop (catch)", [&]() {
+        size_t replaced = 0;
+        for (size_t i = 0; i < src.size(); ++i) {
+            try {
+                dst[i] = numeric_cast<To>(src[i]);
+            } catch (const cast_exception&) {
+                dst[i] = To();
+                ++replaced;
+            }
+        }
+        benchmark_keep(replaced);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, ROWS, REPEATS, bytes_per_element);
+
+    stats = measure_kernel("convert_with_policy", [&]() {
+        size_t replaced = convert_with_policy<Policy>(src.data(), src.size(), dst.data());
+        benchmark_keep(replaced);
+    }, num_runs, REPEATS);
+    print_throughput_row(stats, ROWS, REPEATS, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Replacement Policy Benchmark" << std::endl;
+    std::cout << "==================================" << std::endl;
+    std::cout << "Rows per run: " << ROWS << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    const double fractions[] = { 0.0, 0.01 };
+    for (double bad : fractions) {
+        run_pair<std::int32_t, double>("double -> int32", -1.0e6, 1.0e6, 1.0e12, bad, num_runs);
+        run_pair<std::uint8_t, float>("float -> uint8", 0.0, 255.0, 1000.0, bad, num_runs);
+        run_pair<std::uint16_t, std::int64_t>("int64 -> uint16", 0.0, 65535.0, -1.0, bad, num_runs);
+        run_pair<float, double>("double -> float", -1.0e6, 1.0e6, 1.0e300, bad, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file benchmark_saturate.cpp
+ * @brief Throughput benchmark for saturating int32 -> int16 / uint8 conversion
+ *
+ * Compares, at L1-, L2- and DRAM-resident working set sizes:
+ * 1. Scalar clamp loop (std::min / std::max + static_cast)
+ * 2. Scalar saturate_cast loop
+ * 3. saturate_cast_n (pack instructions)
+ * 4. saturate_cast_n with clamped-lane counting
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON to use the AVX2 kernels.
+ *
+ * Usage: ./benchmark_saturate [number_of_runs]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../include/ncast/ncast_saturate.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ELEMENTS_PER_MEASUREMENT = 32 * 1024 * 1024;  // Elements converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t elements;
+};
+
+// int32 + int16 = 6 bytes per element
+const WorkingSet WORKING_SETS[] = {
+    { "L1 (2K elements, 12 KB)", 2 * 1024 },
+    { "L2 (64K elements, 384 KB)", 64 * 1024 },
+    { "DRAM (16M elements, 96 MB)", 16 * 1024 * 1024 }
+};
+
+// Audio-like samples where about 5% exceed the int16 range
+std::vector<std::int32_t> generate_test_data(size_t count) {
+    std::vector<std::int32_t> data(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<std::int32_t> dis(-34500, 34500);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+template<typename To>
+void clamp_loop(const std::int32_t* src, size_t count, To* dst) {
+    const std::int32_t lo = std::numeric_limits<To>::lowest();
+    const std::int32_t hi = std::numeric_limits<To>::max();
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<To>(std::min(std::max(src[i], lo), hi));
+    }
+}
+
+template<typename To>
+void saturate_cast_loop(const std::int32_t* src, size_t count, To* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = saturate_cast<To>(src[i]);
+    }
+}
+
+template<typename To>
+void run_pair(const char* title, const WorkingSet& ws, int num_runs) {
+    std::vector<std::int32_t> src = generate_test_data(ws.elements);
+    std::vector<To> dst(ws.elements);
+    size_t repeats = std::max<size_t>(1, ELEMENTS_PER_MEASUREMENT / ws.elements);
+    double bytes_per_element = static_cast<double>(sizeof(std::int32_t) + sizeof(To));
+
+    print_throughput_header(std::string(title) + ", " + ws.name);
+
+    BenchmarkStats stats = measure_kernel("scalar clamp loop", [&]() {
+        clamp_loop(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("saturate_cast loop", [&]() {
+        saturate_cast_loop(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("saturate_cast_n", [&]() {
+        saturate_cast_n(src.data(), src.size(), dst.data());
+        benchmark_keep(dst[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("saturate_cast_n (counted)", [&]() {
+        std::size_t clamped = 0;
+        saturate_cast_n(src.data(), src.size(), dst.data(), &clamped);
+        benchmark_keep(clamped);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Saturating Conversion Benchmark" << std::endl;
+    std::cout << "=====================================" << std::endl;
+    std::cout << "Elements per run: " << ELEMENTS_PER_MEASUREMENT << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << "SIMD: " << (NCAST_HAS_AVX2 ? "AVX2" : (NCAST_HAS_SSE2 ? "SSE2" : "none (scalar)")) << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_pair<std::int16_t>("int32 -> int16", ws, num_runs);
+        run_pair<std::uint8_t>("int32 -> uint8", ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
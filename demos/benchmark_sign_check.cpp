@@ -0,0 +1,138 @@
+/**
+ * @file benchmark_sign_check.cpp
+ * @brief Checked signed -> unsigned conversion of equal width against memcpy
+ *
+ * Compares, at L1-, L2- and DRAM-resident working set sizes:
+ * 1. memcpy (the bits do not change; the lower bound)
+ * 2. Scalar numeric_cast loop
+ * 3. Block-wise per-element range check (the generic bulk kernel)
+ * 4. try_numeric_cast_n (one pass: OR of four vectors, sign-bit test, store)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON for the AVX2 / AVX-512 reductions.
+ *
+ * Usage: ./benchmark_sign_check [number_of_runs]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "../include/ncast/ncast_bulk.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t BYTES_PER_MEASUREMENT = 256 * 1024 * 1024;  // Source bytes converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct WorkingSet {
+    const char* name;
+    size_t bytes;   ///< Source bytes
+};
+
+const WorkingSet WORKING_SETS[] = {
+    { "L1 (8 KB source)", 8 * 1024 },
+    { "L2 (256 KB source)", 256 * 1024 },
+    { "DRAM (128 MB source)", 128 * 1024 * 1024 }
+};
+
+template<typename Signed>
+std::vector<Signed> generate_test_data(size_t count) {
+    std::vector<Signed> data(count);
+    std::mt19937_64 gen(42); // Fixed seed for reproducible results
+    std::uniform_int_distribution<Signed> dis(0, std::numeric_limits<Signed>::max());
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+template<typename To, typename From>
+void numeric_cast_loop(const From* src, size_t count, To* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = numeric_cast<To>(src[i]);
+    }
+}
+
+// The generic kernel: per-element range check of each block, then a conversion loop
+template<typename To, typename From>
+size_t element_check_blocks(const From* src, size_t count, To* dst) {
+    for (size_t base = 0; base < count; base += detail::bulk_block_size) {
+        size_t n = count - base < detail::bulk_block_size ? count - base : detail::bulk_block_size;
+        size_t valid = detail::checked_block<To, From, false>::convert(src + base, n, dst + base);
+        if (valid != n) {
+            return base + valid;
+        }
+    }
+    return count;
+}
+
+template<typename Signed>
+void run_pair(const char* name, const WorkingSet& ws, int num_runs) {
+    typedef typename std::make_unsigned<Signed>::type Unsigned;
+    const size_t count = ws.bytes / sizeof(Signed);
+    std::vector<Signed> src = generate_test_data<Signed>(count);
+    std::vector<Unsigned> dst(count);
+    size_t repeats = std::max<size_t>(1, BYTES_PER_MEASUREMENT / ws.bytes);
+    const double bytes_per_element = 2.0 * sizeof(Signed);
+
+    std::ostringstream title;
+    title << name << ", " << ws.name;
+    print_throughput_header(title.str());
+
+    BenchmarkStats stats = measure_kernel("memcpy", [&]() {
+        std::memcpy(dst.data(), src.data(), count * sizeof(Signed));
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("numeric_cast loop", [&]() {
+        numeric_cast_loop(src.data(), count, dst.data());
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("per-element check blocks", [&]() {
+        benchmark_keep(element_check_blocks(src.data(), count, dst.data()));
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    stats = measure_kernel("try_numeric_cast_n (sign OR)", [&]() {
+        benchmark_keep(try_numeric_cast_n(src.data(), count, dst.data()).index);
+        benchmark_keep(dst[count / 2]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, count, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Sign Check Benchmark (signed -> unsigned, equal width)" << std::endl;
+    std::cout << "============================================================" << std::endl;
+    std::cout << "AVX-512: " << (NCAST_HAS_AVX512 ? "yes" : "no")
+              << ", AVX2: " << (NCAST_HAS_AVX2 ? "yes" : "no") << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_pair<std::int32_t>("int32 -> uint32", ws, num_runs);
+    }
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_pair<std::int64_t>("int64 -> uint64", ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
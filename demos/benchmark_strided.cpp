@@ -0,0 +1,112 @@
+/**
+ * @file benchmark_strided.cpp
+ * @brief Throughput benchmark for narrowing a struct field into a dense column
+ *
+ * Converts the double field of a 64-byte record to int32, comparing:
+ * 1. Plain static_cast loop (no validation)
+ * 2. Loop of numeric_cast calls
+ * 3. try_numeric_cast_strided (block gather + vectorized validation)
+ *
+ * Build with -DNCAST_ENABLE_NATIVE_ARCH=ON to use the AVX2 gathers.
+ *
+ * Usage: ./benchmark_strided [number_of_runs]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../include/ncast/ncast_strided.h"
+#include "benchmark_utils.h"
+
+using namespace ncast;
+
+// Configuration
+const size_t ELEMENTS_PER_MEASUREMENT = 16 * 1024 * 1024;  // Records converted per timed run
+const int DEFAULT_RUNS = 3;
+
+struct Record {
+    std::int64_t id;
+    double price;
+    std::int32_t quantity;
+    char symbol[44];
+};
+
+struct WorkingSet {
+    const char* name;
+    size_t elements;
+};
+
+const WorkingSet WORKING_SETS[] = {
+    { "L2 (4K records, 256 KB)", 4 * 1024 },
+    { "DRAM (2M records, 128 MB)", 2 * 1024 * 1024 }
+};
+
+std::vector<Record> generate_records(size_t count) {
+    std::vector<Record> records(count);
+    std::mt19937 gen(42); // Fixed seed for reproducible results
+    std::uniform_real_distribution<double> dis(-1.0e6, 1.0e6);
+    for (size_t i = 0; i < count; ++i) {
+        records[i].id = static_cast<std::int64_t>(i);
+        records[i].price = dis(gen);
+        records[i].quantity = static_cast<std::int32_t>(i);
+    }
+    return records;
+}
+
+void run_working_set(const WorkingSet& ws, int num_runs) {
+    std::vector<Record> records = generate_records(ws.elements);
+    std::vector<std::int32_t> prices(ws.elements);
+    size_t repeats = std::max<size_t>(1, ELEMENTS_PER_MEASUREMENT / ws.elements);
+
+    print_throughput_header(ws.name);
+
+    // Bytes counted: one 64-byte record line read + 4 bytes written
+    const double bytes_per_element = static_cast<double>(sizeof(Record) + sizeof(std::int32_t));
+
+    BenchmarkStats stats = measure_kernel("static_cast loop (unchecked)", [&]() {
+        for (size_t i = 0; i < records.size(); ++i) {
+            prices[i] = static_cast<std::int32_t>(records[i].price);
+        }
+        benchmark_keep(prices[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("numeric_cast loop", [&]() {
+        for (size_t i = 0; i < records.size(); ++i) {
+            prices[i] = numeric_cast<std::int32_t>(records[i].price);
+        }
+        benchmark_keep(prices[0]);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    stats = measure_kernel("try_numeric_cast_strided", [&]() {
+        bulk_result r = try_numeric_cast_strided(&records[0].price, sizeof(Record), records.size(), prices.data());
+        benchmark_keep(r.index);
+    }, num_runs, repeats);
+    print_throughput_row(stats, ws.elements, repeats, bytes_per_element);
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int num_runs = parse_benchmark_runs(argc, argv, DEFAULT_RUNS);
+    if (num_runs <= 0) {
+        return 1;
+    }
+
+    std::cout << "ncast Strided Field Conversion Benchmark (64-byte record, double -> int32)" << std::endl;
+    std::cout << "=========================================================================" << std::endl;
+    std::cout << "Records per run: " << ELEMENTS_PER_MEASUREMENT << std::endl;
+    std::cout << "Number of runs: " << num_runs << std::endl;
+    std::cout << "SIMD: " << (NCAST_HAS_AVX2 ? "AVX2" : (NCAST_HAS_SSE2 ? "SSE2" : "none (scalar)")) << std::endl;
+    std::cout << std::endl;
+
+    for (const WorkingSet& ws : WORKING_SETS) {
+        run_working_set(ws, num_runs);
+    }
+
+    std::cout << "Benchmark completed successfully!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file benchmark_utils.h
+ * @brief Timing and statistics helpers shared by the ncast benchmarks
+ */
+
+#ifndef BENCHMARK_UTILS_H
+#define BENCHMARK_UTILS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct BenchmarkStats {
+    std::string name;
+    std::vector<double> times;
+    double average;
+    double median;
+    double std_dev;
+    double min_time;
+    double max_time;
+
+    void calculate_stats() {
+        if (times.empty()) return;
+
+        // Sort for median calculation
+        std::vector<double> sorted_times = times;
+        std::sort(sorted_times.begin(), sorted_times.end());
+
+        // Calculate average
+        average = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+
+        // Calculate median
+        size_t n = sorted_times.size();
+        if (n % 2 == 0) {
+            median = (sorted_times[n/2 - 1] + sorted_times[n/2]) / 2.0;
+        } else {
+            median = sorted_times[n/2];
+        }
+
+        // Calculate standard deviation
+        double sum_sq_diff = 0.0;
+        for (double time : times) {
+            double diff = time - average;
+            sum_sq_diff += diff * diff;
+        }
+        std_dev = std::sqrt(sum_sq_diff / static_cast<double>(times.size()));
+
+        // Min and max
+        min_time = *std::min_element(times.begin(), times.end());
+        max_time = *std::max_element(times.begin(), times.end());
+    }
+};
+
+class BenchmarkTimer {
+private:
+    std::chrono::high_resolution_clock::time_point start_time;
+
+public:
+    void start() {
+        start_time = std::chrono::high_resolution_clock::now();
+    }
+
+    double stop() {
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+        return static_cast<double>(duration.count()) / 1000.0; // Return milliseconds
+    }
+};
+
+/**
+ * @brief Parse the optional [number_of_runs] command line argument
+ * @return Number of runs, or -1 if the argument is invalid
+ */
+inline int parse_benchmark_runs(int argc, char* argv[], int default_runs) {
+    if (argc > 1) {
+        int num_runs = std::atoi(argv[1]);
+        if (num_runs <= 0) {
+            std::cerr << "Error: Number of runs must be positive" << std::endl;
+            return -1;
+        }
+        return num_runs;
+    }
+    return default_runs;
+}
+
+/**
+ * @brief Time a kernel over several runs after one warm-up call
+ *
+ * The kernel is called with no arguments and should process the whole
+ * working set once per call; repeats are done by the caller-provided
+ * repeat count so that small (cache-resident) sets are timed reliably.
+ */
+template<typename Func>
+BenchmarkStats measure_kernel(const std::string& name, Func func, int num_runs, size_t repeats) {
+    BenchmarkStats stats;
+    stats.name = name;
+    stats.times.reserve(static_cast<size_t>(num_runs));
+
+    func(); // Warm-up: faults in pages and loads caches
+
+    BenchmarkTimer timer;
+    for (int run = 0; run < num_runs; ++run) {
+        timer.start();
+        for (size_t r = 0; r < repeats; ++r) {
+            func();
+        }
+        stats.times.push_back(timer.stop());
+    }
+
+    stats.calculate_stats();
+    return stats;
+}
+
+/**
+ * @brief Print one throughput table row: median time per pass, ns/element and GB/s
+ *
+ * @param bytes_per_element Bytes read plus bytes written per element
+ */
+inline void print_throughput_row(const BenchmarkStats& stats, size_t elements, size_t repeats,
+                                 double bytes_per_element) {
+    double total_elements = static_cast<double>(elements) * static_cast<double>(repeats);
+    double seconds = stats.median / 1000.0;
+    double ns_per_element = seconds > 0.0 ? (seconds * 1e9) / total_elements : 0.0;
+    double gb_per_s = seconds > 0.0 ? (total_elements * bytes_per_element) / seconds / 1e9 : 0.0;
+
+    std::cout << std::setw(34) << std::left << stats.name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(2) << stats.median
+              << std::setw(10) << std::setprecision(1) << stats.std_dev
+              << std::setw(12) << std::setprecision(3) << ns_per_element
+              << std::setw(10) << std::setprecision(2) << gb_per_s << std::endl;
+}
+
+inline void print_throughput_header(const std::string& title) {
+    std::cout << "=== " << title << " ===" << std::endl;
+    std::cout << std::setw(34) << std::left << "Method" << std::right
+              << std::setw(12) << "Median ms"
+              << std::setw(10) << "StdDev"
+              << std::setw(12) << "ns/elem"
+              << std::setw(10) << "GB/s" << std::endl;
+    std::cout << std::string(78, '-') << std::endl;
+}
+
+/**
+ * @brief Keep a value alive so the optimizer cannot drop the computation producing it
+ */
+template<typename T>
+inline void benchmark_keep(const T& value) {
+    volatile T sink = value;
+    (void)sink;
+}
+
+#endif // BENCHMARK_UTILS_H
@@ -47,6 +47,7 @@
 #include <sstream>
 #include <type_traits>
 #include <limits>
+#include <cstdint>
 #include <cmath> // For std::isnan and std::isinf
 
 // C++ standard detection and feature flags
@@ -101,6 +102,21 @@
 
 namespace ncast {
 
+/**
+ * @brief Reason a cast was rejected
+ */
+enum class cast_error {
+    none,                   ///< No error
+    positive_overflow,      ///< Value exceeds the maximum of the target type
+    negative_overflow,      ///< Value is below the minimum (lowest) of the target type
+    negative_to_unsigned,   ///< Negative value cast to an unsigned type
+    nan,                    ///< NaN cast to a type that cannot represent it
+    infinity,               ///< Infinity cast to a type that cannot represent it
+    precision_loss,         ///< Value is not exactly representable in the target type
+    underflow,              ///< Nonzero value becomes subnormal or zero in the target type
+    invalid_format          ///< Text does not hold a number in the expected format
+};
+
 /**
  * @brief Exception thrown when an unsafe cast is attempted
  */
@@ -110,6 +126,7 @@ private:
     std::string file_;
     int line_;
     std::string function_;
+    cast_error error_;
     std::string formatted_message_;
 
     std::string format_message() const {
@@ -130,10 +147,11 @@ public:
     /**
      * @brief Construct with basic error message
      */
-    explicit cast_exception(const std::string& message)
+    explicit cast_exception(const std::string& message, cast_error error = cast_error::none)
         : std::runtime_error(message), 
           message_(message),
-          line_(0) {
+          line_(0),
+          error_(error) {
         formatted_message_ = format_message();
     }
 
@@ -141,12 +159,14 @@ public:
      * @brief Construct with full location information
      */
     cast_exception(const std::string& message, const std::string& file, 
-                   int line, const std::string& function)
+                   int line, const std::string& function,
+                   cast_error error = cast_error::none)
         : std::runtime_error(message), 
           message_(message),
           file_(file), 
           line_(line), 
-          function_(function) {
+          function_(function),
+          error_(error) {
         formatted_message_ = format_message();
     }
     
@@ -155,6 +175,7 @@ public:
     const std::string& getFile() const { return file_; }
     int getLine() const { return line_; }
     const std::string& getFunction() const { return function_; }
+    cast_error getError() const { return error_; }
     
     virtual const char* what() const noexcept override {
         return formatted_message_.c_str();
@@ -178,6 +199,30 @@ namespace detail {
     using widening_float_type = long double;    ///< Type for floating-point widening comparisons
     using widening_int_type = long long;        ///< Type for integer widening comparisons
 
+    /**
+     * @brief Upper bound of ToType for a floating-point FromType value
+     * 
+     * An integral maximum (2^N - 1) is generally not representable in the
+     * source type and rounds up to 2^N, so `value > max` would accept 2^N.
+     * Integral targets are therefore bounded by 2^N itself, an exact power of
+     * two in every floating-point type: a value fits when value < 2^N.
+     */
+    template<typename ToType, typename FromType,
+             bool IsIntegralTarget = std::is_integral<ToType>::value && !std::is_same<ToType, bool>::value>
+    struct float_upper_limit {
+        static constexpr bool exceeds(FromType value) {
+            return value > static_cast<FromType>(std::numeric_limits<ToType>::max());
+        }
+    };
+
+    template<typename ToType, typename FromType>
+    struct float_upper_limit<ToType, FromType, true> {
+        static constexpr bool exceeds(FromType value) {
+            // max / 2 + 1 = 2^(N-1) converts exactly; doubling it stays exact
+            return value >= static_cast<FromType>(static_cast<float>(std::numeric_limits<ToType>::max() / 2 + 1) * 2.0f);
+        }
+    };
+
 #if NCAST_HAS_CONSTEXPR_VALIDATION
     /**
      * @brief Compile-time range validation utilities (C++14+ only)
@@ -192,7 +237,7 @@ namespace detail {
                 ? (std::is_floating_point<ToType>::value
                     ? (value <= static_cast<FromType>(std::numeric_limits<ToType>::max()) &&
                        value >= static_cast<FromType>(std::numeric_limits<ToType>::lowest()))
-                    : (value <= static_cast<FromType>(std::numeric_limits<ToType>::max()) &&
+                    : (!float_upper_limit<ToType, FromType>::exceeds(value) &&
                        value >= static_cast<FromType>(std::numeric_limits<ToType>::lowest()) &&
                        value == static_cast<FromType>(static_cast<ToType>(value))))
                 : (std::is_signed<FromType>::value && std::is_unsigned<ToType>::value && value < 0)
@@ -201,6 +246,36 @@ namespace detail {
                        static_cast<widening_float_type>(value) >= static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest()));
         }
 
+        template<typename T>
+        constexpr typename std::enable_if<std::is_floating_point<T>::value, bool>::type is_nan_value(T value) {
+            return value != value;
+        }
+
+        template<typename T>
+        constexpr typename std::enable_if<!std::is_floating_point<T>::value, bool>::type is_nan_value(T) {
+            return false;
+        }
+
+        /**
+         * @brief Classify a value rejected by is_in_range
+         */
+        template<typename ToType, typename FromType>
+        NCAST_CONSTEXPR_14 cast_error range_error(FromType value) {
+            return is_nan_value(value)
+                ? cast_error::nan
+                : (std::is_floating_point<FromType>::value && !std::is_floating_point<ToType>::value &&
+                   (value > std::numeric_limits<FromType>::max() || value < std::numeric_limits<FromType>::lowest()))
+                    ? cast_error::infinity
+                    : (!std::is_floating_point<FromType>::value && std::is_signed<FromType>::value &&
+                       std::is_unsigned<ToType>::value && value < 0)
+                        ? cast_error::negative_to_unsigned
+                        : (static_cast<widening_float_type>(value) > static_cast<widening_float_type>(std::numeric_limits<ToType>::max()))
+                            ? cast_error::positive_overflow
+                            : (static_cast<widening_float_type>(value) < static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest()))
+                                ? cast_error::negative_overflow
+                                : cast_error::precision_loss;
+        }
+
         /**
          * @brief Constexpr implementation of numeric cast with compile-time validation
          */
@@ -211,7 +286,8 @@ namespace detail {
             
             return is_in_range<ToType>(value) 
                 ? static_cast<ToType>(value)
-                : throw cast_exception("Compile-time cast validation failed: value is out of range for target type");
+                : throw cast_exception("Compile-time cast validation failed: value is out of range for target type",
+                                       range_error<ToType>(value));
         }
     }
 #endif // NCAST_HAS_CONSTEXPR_VALIDATION
@@ -225,17 +301,38 @@ namespace detail {
      */
 
 #if NCAST_HAS_CONSTEXPR_VALIDATION
+    /**
+     * @brief True when both types are built-in arithmetic types
+     * 
+     * Only built-in types take the constexpr path; extension types such as
+     * ncast::half are always validated at runtime.
+     */
+    template<typename ToType, typename FromType>
+    struct is_builtin_cast {
+        static const bool value = std::is_arithmetic<ToType>::value && std::numeric_limits<ToType>::is_specialized &&
+                                  std::is_arithmetic<FromType>::value && std::numeric_limits<FromType>::is_specialized;
+    };
+
     // C++14+ version with optional compile-time validation
     template<typename ToType, typename FromType>
-    NCAST_CONSTEXPR_14 ToType numeric_cast_enhanced(FromType value, const char* file = "unknown", int line = 0, const char* function = "unknown") {
+    NCAST_CONSTEXPR_14 typename std::enable_if<is_builtin_cast<ToType, FromType>::value, ToType>::type
+    numeric_cast_enhanced(FromType value, const char* file = "unknown", int line = 0, const char* function = "unknown") {
         // This will be evaluated at compile time for constant expressions in C++14+
         // and at runtime otherwise. The compiler automatically chooses the right path.
         return constexpr_validation::is_in_range<ToType>(value) 
             ? static_cast<ToType>(value)
             : (NCAST_ENABLE_RUNTIME_VALIDATION 
-                ? throw cast_exception("Cast validation failed: value is out of range for target type", file, line, function)
+                ? throw cast_exception("Cast validation failed: value is out of range for target type", file, line, function,
+                                       constexpr_validation::range_error<ToType>(value))
                 : static_cast<ToType>(value));
     }
+
+    // Extension types (e.g. ncast::half) - runtime validation only
+    template<typename ToType, typename FromType>
+    typename std::enable_if<!is_builtin_cast<ToType, FromType>::value, ToType>::type
+    numeric_cast_enhanced(FromType value, const char* file = "unknown", int line = 0, const char* function = "unknown") {
+        return numeric_cast_impl<ToType>(value, file, line, function);
+    }
 #else
     // C++11 fallback - runtime validation only
     template<typename ToType, typename FromType>
@@ -261,16 +358,109 @@ namespace detail {
 
     /**
      * @brief Type trait to check if a type is numeric or char
+     * 
+     * Specialized by extension headers (e.g. ncast_half.h) for additional
+     * numeric types.
      */
     template<typename T>
     struct is_numeric_or_char {
         static const bool value = std::is_arithmetic<T>::value;
     };
 
+    /**
+     * @brief Type trait to check if a type is a floating-point type
+     * 
+     * Selects the floating-point validator specializations. Specialized by
+     * extension headers for non-built-in floating-point types.
+     */
+    template<typename T>
+    struct is_float_type {
+        static const bool value = std::is_floating_point<T>::value;
+    };
+
+    /**
+     * @brief Range limits of ToType checked against a FromType value
+     * 
+     * Shared by numeric_cast_validator and the bulk range checks so that both
+     * accept exactly the same values. Floating-point sources are compared in
+     * the source type (against exact bounds, see float_upper_limit). Integral
+     * sources use exact integer comparisons for integral targets
+     * (integral_range_limits) and widening_float_type for floating-point
+     * targets (widening_range_limits).
+     */
+    template<typename ToType, typename FromType,
+             bool IsFromFloatingPoint = is_float_type<FromType>::value>
+    struct range_limits {
+        static bool exceeds_max(FromType value) {
+            return float_upper_limit<ToType, FromType>::exceeds(value);
+        }
+
+        static bool below_min(FromType value) {
+            return value < static_cast<FromType>(std::numeric_limits<ToType>::lowest());
+        }
+    };
+
+    template<typename ToType, typename FromType>
+    struct widening_range_limits {
+        static bool exceeds_max(FromType value) {
+            return static_cast<widening_float_type>(value) > static_cast<widening_float_type>(std::numeric_limits<ToType>::max());
+        }
+
+        static bool below_min(FromType value) {
+            return static_cast<widening_float_type>(value) < static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest());
+        }
+    };
+
+    /**
+     * @brief Exact integer comparisons for integral -> integral range checks
+     * 
+     * Stays in integer arithmetic, so 64-bit checks are exact even where long
+     * double is no wider than double (MSVC, AArch64) and widening_range_limits
+     * would round bounds such as INT64_MAX. Checks that can never fail for the
+     * type pair compile to nothing.
+     */
+    template<typename ToType, typename FromType>
+    struct integral_range_limits {
+        static const bool can_exceed_max =
+            static_cast<std::uintmax_t>(std::numeric_limits<FromType>::max()) >
+            static_cast<std::uintmax_t>(std::numeric_limits<ToType>::max());
+        static const bool can_go_below_min =
+            std::numeric_limits<FromType>::is_signed &&
+            static_cast<std::intmax_t>(std::numeric_limits<FromType>::lowest()) <
+            static_cast<std::intmax_t>(std::numeric_limits<ToType>::lowest());
+
+        static bool exceeds_max(FromType value) {
+            return exceeds_max(value, std::integral_constant<bool, can_exceed_max>());
+        }
+
+        static bool below_min(FromType value) {
+            return below_min(value, std::integral_constant<bool, can_go_below_min>());
+        }
+
+    private:
+        static bool exceeds_max(FromType value, std::true_type) {
+            return value > static_cast<FromType>(std::numeric_limits<ToType>::max());
+        }
+
+        static bool exceeds_max(FromType, std::false_type) { return false; }
+
+        static bool below_min(FromType value, std::true_type) {
+            return value < static_cast<FromType>(std::numeric_limits<ToType>::lowest());
+        }
+
+        static bool below_min(FromType, std::false_type) { return false; }
+    };
+
+    template<typename ToType, typename FromType>
+    struct range_limits<ToType, FromType, false>
+        : std::conditional<std::is_integral<ToType>::value && std::is_integral<FromType>::value,
+                           integral_range_limits<ToType, FromType>,
+                           widening_range_limits<ToType, FromType> >::type {};
+
     // Base implementation declaration
     template<typename ToType, typename FromType, 
-             bool IsFromFloatingPoint = std::is_floating_point<FromType>::value,
-             bool IsToFloatingPoint = std::is_floating_point<ToType>::value>
+             bool IsFromFloatingPoint = is_float_type<FromType>::value,
+             bool IsToFloatingPoint = is_float_type<ToType>::value>
     struct numeric_cast_validator;
 
     /**
@@ -282,14 +472,14 @@ namespace detail {
         if (std::isnan(value)) {
             std::ostringstream ss;
             ss << "Cannot convert NaN to non-floating-point type";
-            throw cast_exception(ss.str(), file, line, function);
+            throw cast_exception(ss.str(), file, line, function, cast_error::nan);
         }
         
         // Handle infinity to non-floating point types
         if (std::isinf(value)) {
             std::ostringstream ss;
             ss << "Cannot convert infinity to non-floating-point type";
-            throw cast_exception(ss.str(), file, line, function);
+            throw cast_exception(ss.str(), file, line, function, cast_error::infinity);
         }
         
         return true;
@@ -305,18 +495,18 @@ namespace detail {
             }
             
             // Check for overflow/underflow
-            if (value > static_cast<FromType>(std::numeric_limits<ToType>::max())) {
+            if (range_limits<ToType, FromType>::exceeds_max(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") exceeds maximum for target type ("
                    << std::numeric_limits<ToType>::max() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::positive_overflow);
             }
             
-            if (value < static_cast<FromType>(std::numeric_limits<ToType>::lowest())) {
+            if (range_limits<ToType, FromType>::below_min(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") is below minimum for target type ("
                    << std::numeric_limits<ToType>::lowest() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::negative_overflow);
             }
             
             return static_cast<ToType>(value);
@@ -331,28 +521,28 @@ namespace detail {
             if (std::isnan(value)) {
                 std::ostringstream ss;
                 ss << "Cannot convert NaN to non-floating-point type";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::nan);
             }
             
             if (std::isinf(value)) {
                 std::ostringstream ss;
                 ss << "Cannot convert infinity to non-floating-point type";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::infinity);
             }
             
             // Check for overflow/underflow
-            if (value > static_cast<FromType>(std::numeric_limits<ToType>::max())) {
+            if (range_limits<ToType, FromType>::exceeds_max(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") exceeds maximum for target type ("
                    << std::numeric_limits<ToType>::max() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::positive_overflow);
             }
             
-            if (value < static_cast<FromType>(std::numeric_limits<ToType>::lowest())) {
+            if (range_limits<ToType, FromType>::below_min(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") is below minimum for target type ("
                    << std::numeric_limits<ToType>::lowest() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::negative_overflow);
             }
             
             return static_cast<ToType>(value);
@@ -363,23 +553,20 @@ namespace detail {
     template<typename ToType, typename FromType>
     struct numeric_cast_validator<ToType, FromType, false, true> {
         static ToType validate(FromType value, const char* file, int line, const char* function) {
-            // Use widening_float_type for intermediate calculations to ensure maximum precision
-            // and accuracy when the target type is long double or when high precision is needed
-            widening_float_type wideningValue = static_cast<widening_float_type>(value);
-            
             // Check for overflow/underflow using widening_float_type for maximum precision
-            if (wideningValue > static_cast<widening_float_type>(std::numeric_limits<ToType>::max())) {
+            // (range_limits widens integral sources) so long double targets are handled accurately
+            if (range_limits<ToType, FromType>::exceeds_max(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") exceeds maximum for target type ("
                    << std::numeric_limits<ToType>::max() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::positive_overflow);
             }
             
-            if (wideningValue < static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest())) {
+            if (range_limits<ToType, FromType>::below_min(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") is below minimum for target type ("
                    << std::numeric_limits<ToType>::lowest() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::negative_overflow);
             }
             
             return static_cast<ToType>(value);
@@ -396,28 +583,24 @@ namespace detail {
                     std::ostringstream ss;
                     ss << "Attempt to cast negative value (" << value 
                        << ") to unsigned type";
-                    throw cast_exception(ss.str(), file, line, function);
+                    throw cast_exception(ss.str(), file, line, function, cast_error::negative_to_unsigned);
                 }
             }
             
-            // For integral types, use widening_float_type for range checks to ensure maximum precision
-            // This handles cases where both FromType and ToType might be larger than long long
-            widening_float_type wideningValue = static_cast<widening_float_type>(value);
-            widening_float_type maxTarget = static_cast<widening_float_type>(std::numeric_limits<ToType>::max());
-            widening_float_type minTarget = static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest());
-            
-            if (wideningValue > maxTarget) {
+            // Integral targets are checked with exact integer comparisons (integral_range_limits),
+            // floating-point targets in widening_float_type (widening_range_limits)
+            if (range_limits<ToType, FromType>::exceeds_max(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") exceeds maximum for target type ("
                    << std::numeric_limits<ToType>::max() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::positive_overflow);
             }
             
-            if (wideningValue < minTarget) {
+            if (range_limits<ToType, FromType>::below_min(value)) {
                 std::ostringstream ss;
                 ss << "Value (" << value << ") is below minimum for target type ("
                    << std::numeric_limits<ToType>::lowest() << ")";
-                throw cast_exception(ss.str(), file, line, function);
+                throw cast_exception(ss.str(), file, line, function, cast_error::negative_overflow);
             }
             
             return static_cast<ToType>(value);
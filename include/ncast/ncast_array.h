@@ -0,0 +1,185 @@
+#ifndef NCAST_ARRAY_H
+#define NCAST_ARRAY_H
+
+/**
+ * @file ncast_array.h
+ * @brief numeric_cast for std::array, std::pair and std::tuple of arithmetic values
+ *
+ * numeric_cast<std::array<To, N>>(std::array<From, N>) and the std::pair /
+ * std::tuple overloads convert every element with numeric_cast semantics.
+ * The element conversions are expanded over an index sequence, so there is
+ * no loop at runtime (C++11 and later), and in C++14+ the whole conversion
+ * is constexpr: a constant lookup table is validated at compile time.
+ *
+ * An out-of-range element fails compilation with "call to non-constexpr
+ * function throw_element_error"; the constexpr expansion trace above it shows
+ * the element index as the first template argument of
+ * ncast::detail::cast_element<Index, To, From>. At runtime the cast_exception
+ * message names the index ("... at element 3: ...").
+ *
+ * Plain structs cannot be traversed without reflection; convert them
+ * through std::tie / std::make_tuple.
+ *
+ * @code
+ * #include <ncast/ncast_array.h>
+ *
+ * constexpr std::array<int, 4> wide = {{ 0, 64, 127, -128 }};
+ * constexpr auto table = ncast::numeric_cast<std::array<std::int8_t, 4>>(wide);   // checked at compile time
+ *
+ * auto t = ncast::numeric_cast<std::tuple<std::uint8_t, float>>(std::make_tuple(200, 0.5));
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ncast {
+
+namespace detail {
+
+    /// Compile-time list of indexes (std::index_sequence is C++14)
+    template<std::size_t... Indexes>
+    struct index_sequence {};
+
+    template<typename First, typename Second>
+    struct concat_index_sequence;
+
+    template<std::size_t... First, std::size_t... Second>
+    struct concat_index_sequence<index_sequence<First...>, index_sequence<Second...> > {
+        typedef index_sequence<First..., (sizeof...(First) + Second)...> type;
+    };
+
+    /// index_sequence<0, ..., N - 1>, built with logarithmic template depth
+    template<std::size_t N>
+    struct make_index_sequence {
+        typedef typename concat_index_sequence<typename make_index_sequence<N / 2>::type,
+                                               typename make_index_sequence<N - N / 2>::type>::type type;
+    };
+
+    template<>
+    struct make_index_sequence<0> {
+        typedef index_sequence<> type;
+    };
+
+    template<>
+    struct make_index_sequence<1> {
+        typedef index_sequence<0> type;
+    };
+
+    template<typename T>
+    struct is_std_array : std::false_type {};
+
+    template<typename T, std::size_t N>
+    struct is_std_array<std::array<T, N> > : std::true_type {};
+
+    template<typename T>
+    struct is_std_tuple : std::false_type {};
+
+    template<typename... Types>
+    struct is_std_tuple<std::tuple<Types...> > : std::true_type {};
+
+    template<typename T>
+    struct is_std_pair : std::false_type {};
+
+    template<typename First, typename Second>
+    struct is_std_pair<std::pair<First, Second> > : std::true_type {};
+
+    /**
+     * @brief Report a failing element; never constexpr, so reaching it in a constant expression
+     *        is a compile error that shows the index
+     */
+    template<typename ToType>
+    ToType throw_element_error(std::size_t index, cast_error error) {
+        std::ostringstream ss;
+        ss << "Cast validation failed at element " << index << ": " << cast_error_message(error);
+        throw cast_exception(ss.str(), error);
+    }
+
+    /**
+     * @brief numeric_cast of element Index, with the index in the error
+     */
+#if NCAST_HAS_CONSTEXPR_VALIDATION
+    template<std::size_t Index, typename ToType, typename FromType>
+    NCAST_CONSTEXPR_14 ToType cast_element(FromType value) {
+        static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                      "numeric_cast of arrays and tuples requires built-in arithmetic elements");
+        // Same check as numeric_cast in C++14+
+        return constexpr_validation::is_in_range<ToType>(value)
+            ? static_cast<ToType>(value)
+            : (NCAST_ENABLE_RUNTIME_VALIDATION
+                ? throw_element_error<ToType>(Index, constexpr_validation::range_error<ToType>(value))
+                : static_cast<ToType>(value));
+    }
+#else
+    template<std::size_t Index, typename ToType, typename FromType>
+    ToType cast_element(FromType value) {
+        static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                      "numeric_cast of arrays and tuples requires built-in arithmetic elements");
+        try {
+            return numeric_cast<ToType>(value);
+        } catch (const cast_exception& e) {
+            return throw_element_error<ToType>(Index, e.getError());
+        }
+    }
+#endif
+
+    template<typename ToArray, typename FromType, std::size_t N, std::size_t... Indexes>
+    NCAST_CONSTEXPR_14 ToArray cast_array(const std::array<FromType, N>& values, index_sequence<Indexes...>) {
+        return ToArray{{ cast_element<Indexes, typename ToArray::value_type>(values[Indexes])... }};
+    }
+
+    template<typename ToTuple, typename FromTuple, std::size_t... Indexes>
+    NCAST_CONSTEXPR_14 ToTuple cast_tuple(const FromTuple& values, index_sequence<Indexes...>) {
+        // Braced initialisation evaluates the elements left to right, so the first failure is reported
+        return ToTuple{cast_element<Indexes, typename std::tuple_element<Indexes, ToTuple>::type>(
+            std::get<Indexes>(values))...};
+    }
+
+} // namespace detail
+
+/**
+ * @brief Element-wise numeric_cast of a std::array; constexpr in C++14+
+ *
+ * @tparam ToArray std::array<To, N> with the same N as the source
+ * @throws cast_exception naming the first failing element index
+ */
+template<typename ToArray, typename FromType, std::size_t N>
+NCAST_CONSTEXPR_14 typename std::enable_if<detail::is_std_array<ToArray>::value, ToArray>::type
+numeric_cast(const std::array<FromType, N>& values) {
+    static_assert(std::tuple_size<ToArray>::value == N, "numeric_cast: source and target arrays differ in size");
+    return detail::cast_array<ToArray>(values, typename detail::make_index_sequence<N>::type());
+}
+
+/**
+ * @brief Element-wise numeric_cast of a std::tuple; constexpr in C++14+
+ *
+ * @tparam ToTuple std::tuple<To...> with as many elements as the source
+ * @throws cast_exception naming the first failing element index
+ */
+template<typename ToTuple, typename... FromTypes>
+NCAST_CONSTEXPR_14 typename std::enable_if<detail::is_std_tuple<ToTuple>::value, ToTuple>::type
+numeric_cast(const std::tuple<FromTypes...>& values) {
+    static_assert(std::tuple_size<ToTuple>::value == sizeof...(FromTypes),
+                  "numeric_cast: source and target tuples differ in size");
+    return detail::cast_tuple<ToTuple>(values, typename detail::make_index_sequence<sizeof...(FromTypes)>::type());
+}
+
+/**
+ * @brief Element-wise numeric_cast of a std::pair (first is element 0); constexpr in C++14+
+ */
+template<typename ToPair, typename FromFirst, typename FromSecond>
+NCAST_CONSTEXPR_14 typename std::enable_if<detail::is_std_pair<ToPair>::value, ToPair>::type
+numeric_cast(const std::pair<FromFirst, FromSecond>& values) {
+    return ToPair{detail::cast_element<0, typename ToPair::first_type>(values.first),
+                  detail::cast_element<1, typename ToPair::second_type>(values.second)};
+}
+
+} // namespace ncast
+
+#endif // NCAST_ARRAY_H
@@ -0,0 +1,457 @@
+#ifndef NCAST_BFLOAT16_H
+#define NCAST_BFLOAT16_H
+
+/**
+ * @file ncast_bfloat16.h
+ * @brief bfloat16 support for ncast
+ *
+ * Adds the ncast::bfloat16 storage type (1 sign, 8 exponent, 7 mantissa bits:
+ * the upper half of an IEEE float) and makes it a valid source and target of
+ * numeric_cast / NUMERIC_CAST.
+ *
+ * Validation follows the floating-point rules of numeric_cast:
+ * - float/double/integer -> bfloat16: values beyond bfloat16's finite range
+ *   throw; NaN and infinity pass through (NaN stays a quiet NaN instead of
+ *   collapsing into infinity as a plain truncation would); rounding to
+ *   nearest-even is allowed
+ * - bfloat16 -> integer: NaN, infinity and out-of-range values throw
+ * - bfloat16 -> float/double: always succeeds and is exact
+ *
+ * Bulk kernels:
+ * - float_to_bfloat16_n: round-to-nearest-even, overflow becomes infinity, no validation
+ * - try_float_to_bfloat16_n: same conversion with range validation plus optional
+ *   precision-loss, NaN and infinity checks (see float_checks); stops at the
+ *   first failing element
+ * - bfloat16_to_float_n: exact widening
+ *
+ * Kernels use AVX2 or SSE2 integer instructions when available.
+ *
+ * @code
+ * #include <ncast/ncast_bfloat16.h>
+ *
+ * ncast::bfloat16 w = ncast::numeric_cast<ncast::bfloat16>(0.15625f);   // OK
+ *
+ * ncast::bulk_result r = ncast::try_float_to_bfloat16_n(weights, n, out, ncast::float_checks::exact);
+ * if (!r.ok()) {
+ *     // r.index is the first element that lost precision or overflowed
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_half.h"
+#include "ncast_simd.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace ncast {
+
+namespace detail {
+
+    /**
+     * @brief float bits -> bfloat16 bits with round-to-nearest-even
+     */
+    inline std::uint16_t float_bits_to_bfloat16_bits(std::uint32_t bits) {
+        if ((bits & 0x7fffffffu) > 0x7f800000u) {
+            // NaN: keep sign and upper payload, force quiet bit
+            return static_cast<std::uint16_t>((bits | 0x00400000u) >> 16);
+        }
+        std::uint32_t lsb = (bits >> 16) & 1u;
+        return static_cast<std::uint16_t>((bits + 0x7fffu + lsb) >> 16);
+    }
+
+    inline std::uint16_t float_to_bfloat16_bits(float value) {
+        return float_bits_to_bfloat16_bits(float_to_bits(value));
+    }
+
+    inline float bfloat16_bits_to_float(std::uint16_t bits) {
+        return bits_to_float(static_cast<std::uint32_t>(bits) << 16);
+    }
+
+    /**
+     * @brief Direct double -> bfloat16 with a single rounding
+     *
+     * Narrows to float with round-to-odd first; float keeps enough extra bits
+     * for the final round-to-nearest-even to match direct rounding.
+     */
+    inline std::uint16_t double_to_bfloat16_bits(double value) {
+        float f = static_cast<float>(value);
+        std::uint32_t bits = float_to_bits(f);
+        if (!std::isnan(value) && static_cast<double>(f) != value) {
+            if (std::fabs(static_cast<double>(f)) > std::fabs(value)) {
+                bits -= 1u;
+            }
+            bits |= 1u;
+        }
+        return float_bits_to_bfloat16_bits(bits);
+    }
+
+    inline std::uint16_t to_bfloat16_bits(float value) { return float_to_bfloat16_bits(value); }
+    inline std::uint16_t to_bfloat16_bits(double value) { return double_to_bfloat16_bits(value); }
+    inline std::uint16_t to_bfloat16_bits(long double value) { return double_to_bfloat16_bits(static_cast<double>(value)); }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value, std::uint16_t>::type to_bfloat16_bits(T value) {
+        return double_to_bfloat16_bits(static_cast<double>(value));
+    }
+
+    /**
+     * @brief Validate one float (as bits) for conversion to bfloat16
+     *
+     * Uses the same range rule as numeric_cast: finite values whose magnitude
+     * exceeds numeric_limits<bfloat16>::max() are rejected.
+     */
+    inline cast_error check_float_to_bfloat16(std::uint32_t bits, float_checks checks) {
+        std::uint32_t magnitude = bits & 0x7fffffffu;
+        if (magnitude > 0x7f800000u) {
+            return has_check(checks, float_checks::reject_nan) ? cast_error::nan : cast_error::none;
+        }
+        if (magnitude == 0x7f800000u) {
+            return has_check(checks, float_checks::reject_infinity) ? cast_error::infinity : cast_error::none;
+        }
+        if (magnitude > 0x7f7f0000u) {
+            return (bits >> 31) ? cast_error::negative_overflow : cast_error::positive_overflow;
+        }
+        if (has_check(checks, float_checks::exact) && (bits & 0xffffu) != 0) {
+            return cast_error::precision_loss;
+        }
+        return cast_error::none;
+    }
+
+#if NCAST_HAS_SSE2
+    // Round 4 floats (as bits) to bfloat16 in the low 16 bits of each lane, sign-extended for packing
+    inline __m128i bf16_round_sse2(__m128i bits) {
+        const __m128i magnitude_mask = _mm_set1_epi32(0x7fffffff);
+        const __m128i infinity = _mm_set1_epi32(0x7f800000);
+        __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+        __m128i rounded = _mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7fff)), lsb);
+        __m128i is_nan = _mm_cmpgt_epi32(_mm_and_si128(bits, magnitude_mask), infinity);
+        __m128i quiet = _mm_or_si128(bits, _mm_set1_epi32(0x00400000));
+        __m128i result = _mm_or_si128(_mm_and_si128(is_nan, quiet), _mm_andnot_si128(is_nan, rounded));
+        return _mm_srai_epi32(result, 16);
+    }
+
+    // Lanes failing validation are all ones; enabled_* masks switch optional checks on
+    inline __m128i bf16_fail_mask_sse2(__m128i bits, __m128i enabled_exact, __m128i enabled_nan, __m128i enabled_infinity) {
+        __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff));
+        __m128i above_max = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7f7f0000));
+        __m128i not_finite = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7f7fffff));
+        __m128i is_nan = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7f800000));
+        __m128i is_infinity = _mm_cmpeq_epi32(magnitude, _mm_set1_epi32(0x7f800000));
+        __m128i low_zero = _mm_cmpeq_epi32(_mm_and_si128(bits, _mm_set1_epi32(0xffff)), _mm_setzero_si128());
+        __m128i fail = _mm_andnot_si128(not_finite, above_max);
+        fail = _mm_or_si128(fail, _mm_and_si128(enabled_nan, is_nan));
+        fail = _mm_or_si128(fail, _mm_and_si128(enabled_infinity, is_infinity));
+        fail = _mm_or_si128(fail, _mm_andnot_si128(_mm_or_si128(low_zero, not_finite), enabled_exact));
+        return fail;
+    }
+#endif
+
+#if NCAST_HAS_AVX2
+    inline __m256i bf16_round_avx2(__m256i bits) {
+        const __m256i magnitude_mask = _mm256_set1_epi32(0x7fffffff);
+        const __m256i infinity = _mm256_set1_epi32(0x7f800000);
+        __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+        __m256i rounded = _mm256_add_epi32(_mm256_add_epi32(bits, _mm256_set1_epi32(0x7fff)), lsb);
+        __m256i is_nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, magnitude_mask), infinity);
+        __m256i quiet = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+        return _mm256_srai_epi32(_mm256_blendv_epi8(rounded, quiet, is_nan), 16);
+    }
+
+    inline __m256i bf16_fail_mask_avx2(__m256i bits, __m256i enabled_exact, __m256i enabled_nan, __m256i enabled_infinity) {
+        __m256i magnitude = _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff));
+        __m256i above_max = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x7f7f0000));
+        __m256i not_finite = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x7f7fffff));
+        __m256i is_nan = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x7f800000));
+        __m256i is_infinity = _mm256_cmpeq_epi32(magnitude, _mm256_set1_epi32(0x7f800000));
+        __m256i low_zero = _mm256_cmpeq_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0xffff)), _mm256_setzero_si256());
+        __m256i fail = _mm256_andnot_si256(not_finite, above_max);
+        fail = _mm256_or_si256(fail, _mm256_and_si256(enabled_nan, is_nan));
+        fail = _mm256_or_si256(fail, _mm256_and_si256(enabled_infinity, is_infinity));
+        fail = _mm256_or_si256(fail, _mm256_andnot_si256(_mm256_or_si256(low_zero, not_finite), enabled_exact));
+        return fail;
+    }
+
+    // Round and pack 16 floats into 16 bfloat16 values
+    inline __m256i bf16_pack16_avx2(__m256i lo, __m256i hi) {
+        return _mm256_permute4x64_epi64(_mm256_packs_epi32(bf16_round_avx2(lo), bf16_round_avx2(hi)), 0xd8);
+    }
+#endif
+
+} // namespace detail
+
+/**
+ * @brief bfloat16 storage type
+ *
+ * A trivially copyable 16-bit value holding the upper half of an IEEE float.
+ * Arithmetic is intentionally not provided: convert to float for computation.
+ * Conversions round to nearest-even; overflow produces infinity, so use
+ * numeric_cast<bfloat16> to reject out-of-range values.
+ */
+class bfloat16 {
+public:
+    constexpr bfloat16() noexcept : bits_(0) {}
+
+    explicit bfloat16(float value) noexcept : bits_(detail::to_bfloat16_bits(value)) {}
+    explicit bfloat16(double value) noexcept : bits_(detail::to_bfloat16_bits(value)) {}
+    explicit bfloat16(long double value) noexcept : bits_(detail::to_bfloat16_bits(value)) {}
+
+    template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    explicit bfloat16(T value) noexcept : bits_(detail::to_bfloat16_bits(value)) {}
+
+    /**
+     * @brief Construct from a raw bfloat16 bit pattern
+     */
+    static constexpr bfloat16 from_bits(std::uint16_t bits) noexcept {
+        return bfloat16(bits, bits_tag());
+    }
+
+    /**
+     * @brief Raw bfloat16 bit pattern
+     */
+    constexpr std::uint16_t bits() const noexcept { return bits_; }
+
+    template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    explicit operator T() const noexcept {
+        return static_cast<T>(detail::bfloat16_bits_to_float(bits_));
+    }
+
+    friend bool operator==(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) == static_cast<float>(b); }
+    friend bool operator!=(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) != static_cast<float>(b); }
+    friend bool operator<(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) < static_cast<float>(b); }
+    friend bool operator>(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) > static_cast<float>(b); }
+    friend bool operator<=(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) <= static_cast<float>(b); }
+    friend bool operator>=(bfloat16 a, bfloat16 b) noexcept { return static_cast<float>(a) >= static_cast<float>(b); }
+
+    friend std::ostream& operator<<(std::ostream& os, bfloat16 value) {
+        return os << static_cast<float>(value);
+    }
+
+private:
+    struct bits_tag {};
+    constexpr bfloat16(std::uint16_t bits, bits_tag) noexcept : bits_(bits) {}
+
+    std::uint16_t bits_;
+};
+
+static_assert(sizeof(bfloat16) == 2, "ncast::bfloat16 must be 16 bits wide");
+static_assert(std::is_trivially_copyable<bfloat16>::value, "ncast::bfloat16 must be trivially copyable");
+
+/**
+ * @brief Convert a float array to bfloat16 (round-to-nearest-even, no validation)
+ *
+ * NaN stays NaN, values beyond bfloat16's finite range become infinity.
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ */
+inline void float_to_bfloat16_n(const float* src, std::size_t count, bfloat16* dst) {
+    std::size_t i = 0;
+#if NCAST_HAS_AVX2
+    for (; i + 16 <= count; i += 16) {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), detail::bf16_pack16_avx2(lo, hi));
+    }
+#elif NCAST_HAS_SSE2
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+        __m128i packed = _mm_packs_epi32(detail::bf16_round_sse2(lo), detail::bf16_round_sse2(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = bfloat16::from_bits(detail::float_to_bfloat16_bits(src[i]));
+    }
+}
+
+/**
+ * @brief Convert a float array to bfloat16 with validation
+ *
+ * Rejects finite values beyond bfloat16's range (as numeric_cast does) and,
+ * depending on checks, values that lose precision, NaN and infinity.
+ * Conversion stops at the first failing element.
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @param checks Additional checks to perform
+ * @return Index and reason of the first failure, or {count, cast_error::none}
+ */
+inline bulk_result try_float_to_bfloat16_n(const float* src, std::size_t count, bfloat16* dst,
+                                           float_checks checks = float_checks::none) {
+    std::size_t i = 0;
+#if NCAST_HAS_AVX2
+    const __m256i enabled_exact = _mm256_set1_epi32(has_check(checks, float_checks::exact) ? -1 : 0);
+    const __m256i enabled_nan = _mm256_set1_epi32(has_check(checks, float_checks::reject_nan) ? -1 : 0);
+    const __m256i enabled_infinity = _mm256_set1_epi32(has_check(checks, float_checks::reject_infinity) ? -1 : 0);
+    for (; i + 16 <= count; i += 16) {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8));
+        __m256i fail = _mm256_or_si256(detail::bf16_fail_mask_avx2(lo, enabled_exact, enabled_nan, enabled_infinity),
+                                       detail::bf16_fail_mask_avx2(hi, enabled_exact, enabled_nan, enabled_infinity));
+        if (!_mm256_testz_si256(fail, fail)) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), detail::bf16_pack16_avx2(lo, hi));
+    }
+#elif NCAST_HAS_SSE2
+    const __m128i enabled_exact = _mm_set1_epi32(has_check(checks, float_checks::exact) ? -1 : 0);
+    const __m128i enabled_nan = _mm_set1_epi32(has_check(checks, float_checks::reject_nan) ? -1 : 0);
+    const __m128i enabled_infinity = _mm_set1_epi32(has_check(checks, float_checks::reject_infinity) ? -1 : 0);
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+        __m128i fail = _mm_or_si128(detail::bf16_fail_mask_sse2(lo, enabled_exact, enabled_nan, enabled_infinity),
+                                    detail::bf16_fail_mask_sse2(hi, enabled_exact, enabled_nan, enabled_infinity));
+        if (_mm_movemask_epi8(fail) != 0) {
+            break;
+        }
+        __m128i packed = _mm_packs_epi32(detail::bf16_round_sse2(lo), detail::bf16_round_sse2(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#endif
+    // Tail, or the block containing the first failure
+    for (; i < count; ++i) {
+        std::uint32_t bits = detail::float_to_bits(src[i]);
+        cast_error error = detail::check_float_to_bfloat16(bits, checks);
+        if (error != cast_error::none) {
+            bulk_result result = { i, error };
+            return result;
+        }
+        dst[i] = bfloat16::from_bits(detail::float_bits_to_bfloat16_bits(bits));
+    }
+    bulk_result result = { count, cast_error::none };
+    return result;
+}
+
+/**
+ * @brief Convert a bfloat16 array to float (always exact)
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ */
+inline void bfloat16_to_float_n(const bfloat16* src, std::size_t count, float* dst) {
+    std::size_t i = 0;
+#if NCAST_HAS_AVX2
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16));
+    }
+#elif NCAST_HAS_SSE2
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi16(_mm_setzero_si128(), v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), _mm_unpackhi_epi16(_mm_setzero_si128(), v));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = detail::bfloat16_bits_to_float(src[i].bits());
+    }
+}
+
+namespace detail {
+
+    template<>
+    struct is_numeric_or_char<bfloat16> {
+        static const bool value = true;
+    };
+
+    template<>
+    struct is_float_type<bfloat16> {
+        static const bool value = true;
+    };
+
+    // bfloat16 source: widen to float (exact) and apply the float rules
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, bfloat16, true, true> {
+        static ToType validate(bfloat16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, bfloat16, true, false> {
+        static ToType validate(bfloat16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+#if NCAST_HAS_FLOAT16
+    // _Float16 <-> bfloat16 matches both the bfloat16 source and the _Float16
+    // (ncast_half.h) partial specializations; both go through float, which
+    // holds every value of either type exactly
+    template<>
+    struct numeric_cast_validator<_Float16, bfloat16, true, true> {
+        static _Float16 validate(bfloat16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<_Float16, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+    template<>
+    struct numeric_cast_validator<bfloat16, _Float16, true, true> {
+        static bfloat16 validate(_Float16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<bfloat16, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+#endif // NCAST_HAS_FLOAT16
+
+} // namespace detail
+
+} // namespace ncast
+
+namespace std {
+
+/**
+ * @brief numeric_limits for ncast::bfloat16
+ */
+template<>
+class numeric_limits<ncast::bfloat16> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -125;
+    static constexpr int min_exponent10 = -37;
+    static constexpr int max_exponent = 128;
+    static constexpr int max_exponent10 = 38;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr ncast::bfloat16 min() noexcept { return ncast::bfloat16::from_bits(0x0080); }
+    static constexpr ncast::bfloat16 lowest() noexcept { return ncast::bfloat16::from_bits(0xff7f); }
+    static constexpr ncast::bfloat16 max() noexcept { return ncast::bfloat16::from_bits(0x7f7f); }
+    static constexpr ncast::bfloat16 epsilon() noexcept { return ncast::bfloat16::from_bits(0x3c00); }
+    static constexpr ncast::bfloat16 round_error() noexcept { return ncast::bfloat16::from_bits(0x3f00); }
+    static constexpr ncast::bfloat16 infinity() noexcept { return ncast::bfloat16::from_bits(0x7f80); }
+    static constexpr ncast::bfloat16 quiet_NaN() noexcept { return ncast::bfloat16::from_bits(0x7fc0); }
+    static constexpr ncast::bfloat16 signaling_NaN() noexcept { return ncast::bfloat16::from_bits(0x7fa0); }
+    static constexpr ncast::bfloat16 denorm_min() noexcept { return ncast::bfloat16::from_bits(0x0001); }
+};
+
+} // namespace std
+
+#endif // NCAST_BFLOAT16_H
@@ -0,0 +1,225 @@
+#ifndef NCAST_BUFFER_H
+#define NCAST_BUFFER_H
+
+/**
+ * @file ncast_buffer.h
+ * @brief Buffered checked conversion for producers that emit one value at a time
+ *
+ * cast_output_buffer<To, OutIt, From> collects pushed source values in a
+ * small aligned buffer and converts them with the vectorized bulk validator
+ * and converter (try_numeric_cast_n) when the buffer fills or on flush().
+ * Converted values are written to the output iterator in order, so a
+ * producer feeding std::back_inserter gets bulk validation instead of one
+ * numeric_cast per value; a std::back_insert_iterator receives each batch
+ * with one range insert into its container.
+ *
+ * Errors carry the global index: the position of the failing value among all
+ * values pushed into the buffer. On a failure the values before it are
+ * written, only the failing value is dropped, and the values after it stay
+ * pending, so a caller can record the bad value and flush again to continue.
+ *
+ * The destructor flushes pending values, skipping failing ones, but cannot
+ * report errors (it swallows every exception, including those of the output);
+ * call flush() (throws) or try_flush() before destruction to observe them.
+ *
+ * @code
+ * #include <ncast/ncast_buffer.h>
+ *
+ * std::vector<std::int32_t> out;
+ * auto buffer = ncast::make_cast_output_buffer<std::int32_t, std::int64_t>(std::back_inserter(out));
+ * std::copy(readings.begin(), readings.end(), buffer.inserter());
+ * buffer.flush();   // throws cast_exception "Bulk cast failed at index <global index>: ..."
+ *
+ * // Dead-letter loop: skip each bad value and keep going
+ * for (ncast::bulk_result r = buffer.try_flush(); !r.ok(); r = buffer.try_flush()) {
+ *     dead_letter(r.index, r.error);
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ncast {
+
+namespace detail {
+
+    /// Write a converted batch to an output iterator
+    template<typename ToType, typename OutputIterator>
+    OutputIterator append_output(const ToType* first, const ToType* last, OutputIterator out) {
+        return std::copy(first, last, out);
+    }
+
+    /// Reaches the container of a std::back_insert_iterator (a protected member)
+    template<typename Container>
+    struct back_insert_access : std::back_insert_iterator<Container> {
+        static Container& container_of(std::back_insert_iterator<Container>& out) {
+            return *(out.*(&back_insert_access::container));
+        }
+    };
+
+    /// std::back_inserter: append the batch with one range insert instead of a push_back per value
+    template<typename ToType, typename Container>
+    std::back_insert_iterator<Container> append_output(const ToType* first, const ToType* last,
+                                                       std::back_insert_iterator<Container> out) {
+        Container& container = back_insert_access<Container>::container_of(out);
+        container.insert(container.end(), first, last);
+        return out;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Output buffer converting batches of pushed values with the bulk checked conversion
+ *
+ * @tparam ToType Target arithmetic type written to the output iterator
+ * @tparam OutputIterator Destination, e.g. std::back_insert_iterator or a pointer
+ * @tparam FromType Source arithmetic type of pushed values
+ * @tparam Capacity Values per batch
+ */
+template<typename ToType, typename OutputIterator, typename FromType,
+         std::size_t Capacity = detail::bulk_block_size>
+class cast_output_buffer {
+private:
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "cast_output_buffer requires built-in arithmetic types");
+    static_assert(Capacity > 0, "cast_output_buffer needs a non-empty buffer");
+
+    alignas(64) FromType pending_[Capacity];
+    alignas(64) ToType converted_[Capacity];
+    std::size_t size_;
+    std::size_t flushed_;           ///< Values pushed before pending_[0]
+    OutputIterator out_;
+
+public:
+    /**
+     * @brief Output iterator pushing assigned values into a cast_output_buffer
+     */
+    class iterator {
+    private:
+        cast_output_buffer* buffer_;
+
+    public:
+        typedef std::output_iterator_tag iterator_category;
+        typedef void value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef void reference;
+
+        explicit iterator(cast_output_buffer& buffer) : buffer_(&buffer) {}
+
+        iterator& operator=(FromType value) { buffer_->push(value); return *this; }
+        iterator& operator*() { return *this; }
+        iterator& operator++() { return *this; }
+        iterator& operator++(int) { return *this; }
+    };
+
+    explicit cast_output_buffer(OutputIterator out) : size_(0), flushed_(0), out_(std::move(out)) {}
+
+    cast_output_buffer(const cast_output_buffer&) = delete;
+    cast_output_buffer& operator=(const cast_output_buffer&) = delete;
+
+    cast_output_buffer(cast_output_buffer&& other)
+        : size_(other.size_), flushed_(other.flushed_), out_(std::move(other.out_)) {
+        std::copy(other.pending_, other.pending_ + other.size_, pending_);
+        other.size_ = 0;
+    }
+
+    /// Flushes pending values, skipping failing ones; errors and exceptions are not reported
+    ~cast_output_buffer() {
+        try {
+            while (size_ != 0) {
+                try_flush();
+            }
+        } catch (...) {
+        }
+    }
+
+    /**
+     * @brief Add one value; converts the batch when the buffer is full
+     *
+     * The value is kept even if the conversion throws: only the failing value
+     * of the batch is dropped, and the values after it stay pending. A buffer
+     * left full by a throwing output is flushed before the value is stored;
+     * if the output throws again, the value is not added.
+     *
+     * @throws cast_exception with the global index if a value of the batch fails
+     */
+    void push(FromType value) {
+        if (size_ == Capacity) {
+            bulk_result result = try_flush();
+            pending_[size_++] = value;
+            if (!result.ok()) {
+                detail::throw_bulk_error(result, "unknown", 0, "unknown");
+            }
+            return;
+        }
+        pending_[size_++] = value;
+        if (size_ == Capacity) {
+            flush();
+        }
+    }
+
+    /// Output iterator for std::copy and friends; values assigned through it are pushed
+    iterator inserter() { return iterator(*this); }
+
+    /**
+     * @brief Convert and write pending values up to the first failing one
+     *
+     * On a failure the values before it are written, the failing value is
+     * dropped and the values after it stay pending for the next flush. If the
+     * output throws, the pending values are left as they were.
+     *
+     * @return {number of values pushed so far, none}, or the global index and error of the failing value
+     */
+    bulk_result try_flush() {
+        bulk_result result = try_numeric_cast_n(pending_, size_, converted_);
+        out_ = detail::append_output(converted_, converted_ + result.index, out_);
+        const std::size_t consumed = result.ok() ? size_ : result.index + 1;
+        std::copy(pending_ + consumed, pending_ + size_, pending_);
+        size_ -= consumed;
+        result.index += flushed_;
+        flushed_ += consumed;
+        return result;
+    }
+
+    /**
+     * @brief Convert and write pending values
+     * @throws cast_exception with the global index if a pending value fails;
+     *         the values after it stay pending
+     */
+    void flush() {
+        bulk_result result = try_flush();
+        if (!result.ok()) {
+            detail::throw_bulk_error(result, "unknown", 0, "unknown");
+        }
+    }
+
+    /// Values waiting for the next flush
+    std::size_t pending() const { return size_; }
+
+    /// Values pushed so far; the global index of the next pushed value
+    std::size_t pushed() const { return flushed_ + size_; }
+
+    /// Output iterator past the last written value
+    const OutputIterator& output() const { return out_; }
+};
+
+/**
+ * @brief Create a cast_output_buffer, deducing the output iterator type
+ *
+ * make_cast_output_buffer<To, From>(std::back_inserter(v))
+ */
+template<typename ToType, typename FromType, std::size_t Capacity = detail::bulk_block_size, typename OutputIterator>
+cast_output_buffer<ToType, OutputIterator, FromType, Capacity> make_cast_output_buffer(OutputIterator out) {
+    return cast_output_buffer<ToType, OutputIterator, FromType, Capacity>(std::move(out));
+}
+
+} // namespace ncast
+
+#endif // NCAST_BUFFER_H
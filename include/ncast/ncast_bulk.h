@@ -0,0 +1,792 @@
+#ifndef NCAST_BULK_H
+#define NCAST_BULK_H
+
+/**
+ * @file ncast_bulk.h
+ * @brief Common types for ncast bulk (array) conversions
+ *
+ * Bulk conversions validate and convert whole arrays. Checked variants
+ * convert elements in order and stop at the first element that fails
+ * validation, reporting its index and the reason via bulk_result.
+ * Elements before the failing index have been written to the destination;
+ * the failing element and everything after it are left untouched.
+ *
+ * try_numeric_cast_n() / numeric_cast_n() are the generic checked
+ * conversions for any pair of built-in arithmetic types; for integer to
+ * floating-point conversions, float_checks::exact also rejects values that
+ * would be rounded. double -> float takes the same float_checks, plus
+ * float_checks::reject_underflow, in a single-pass vector-compare kernel.
+ *
+ * Element validation follows the runtime numeric_cast rules in every
+ * language standard: ranges are checked on the source value, fractions
+ * truncate toward zero, and NaN and infinity pass into floating-point
+ * targets. In C++14 and later, numeric_cast of built-in types also rejects
+ * fractional values (precision_loss) and non-finite values narrowed into a
+ * floating-point type; the bulk conversions do not, so their results do not
+ * depend on the standard a translation unit is compiled with. Use
+ * saturate_cast_n / replace policies to clamp, or round the source first.
+ */
+
+#include "ncast.h"
+#include "ncast_simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace ncast {
+
+/**
+ * @brief Outcome of a checked bulk conversion
+ */
+struct bulk_result {
+    std::size_t index;      ///< Index of the first failing element, or the element count on success
+    cast_error error;       ///< Reason of the failure, cast_error::none on success
+
+    bool ok() const { return error == cast_error::none; }
+};
+
+/**
+ * @brief Optional checks for floating-point bulk conversions
+ *
+ * Range checks are always performed. These flags add stricter checks;
+ * combine them with operator|.
+ */
+enum class float_checks : unsigned {
+    none = 0,               ///< Range checks only; NaN and infinity pass through, rounding is allowed
+    exact = 1u << 0,        ///< Reject values that are not exactly representable in the target type
+    reject_nan = 1u << 1,   ///< Reject NaN
+    reject_infinity = 1u << 2, ///< Reject infinity
+    reject_underflow = 1u << 3 ///< Reject nonzero values below the smallest normal value of the target type
+};
+
+inline constexpr float_checks operator|(float_checks a, float_checks b) {
+    return static_cast<float_checks>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+
+inline constexpr bool has_check(float_checks set, float_checks flag) {
+    return (static_cast<unsigned>(set) & static_cast<unsigned>(flag)) != 0;
+}
+
+namespace detail {
+
+    inline std::uint32_t float_to_bits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline float bits_to_float(std::uint32_t bits) {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    inline std::uint64_t double_to_bits(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline double bits_to_double(std::uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    inline const char* cast_error_message(cast_error error) {
+        switch (error) {
+            case cast_error::none: return "no error";
+            case cast_error::positive_overflow: return "value exceeds maximum for target type";
+            case cast_error::negative_overflow: return "value is below minimum for target type";
+            case cast_error::negative_to_unsigned: return "negative value cast to unsigned type";
+            case cast_error::nan: return "NaN is not allowed";
+            case cast_error::infinity: return "infinity is not allowed";
+            case cast_error::precision_loss: return "value is not exactly representable in target type";
+            case cast_error::underflow: return "nonzero value underflows to subnormal or zero in target type";
+            case cast_error::invalid_format: return "text is not a number in the expected format";
+        }
+        return "unknown error";
+    }
+
+    /**
+     * @brief Per-element validation used by the generic bulk conversions
+     *
+     * fits() accepts exactly the values numeric_cast_validator accepts and is
+     * written without branches so that loops over it vectorize; error()
+     * classifies a single element (cast_error::none if it fits).
+     */
+    template<typename ToType, typename FromType,
+             bool IsFromFloatingPoint = is_float_type<FromType>::value,
+             bool IsToFloatingPoint = is_float_type<ToType>::value>
+    struct element_check;
+
+    // Integral source: range only
+    template<typename ToType, typename FromType, bool IsToFloatingPoint>
+    struct element_check<ToType, FromType, false, IsToFloatingPoint> {
+        static bool fits(FromType value) {
+            return !(range_limits<ToType, FromType>::exceeds_max(value) | range_limits<ToType, FromType>::below_min(value));
+        }
+
+        static cast_error error(FromType value) {
+            if (std::is_signed<FromType>::value && std::is_unsigned<ToType>::value && value < 0) {
+                return cast_error::negative_to_unsigned;
+            }
+            if (range_limits<ToType, FromType>::exceeds_max(value)) return cast_error::positive_overflow;
+            if (range_limits<ToType, FromType>::below_min(value)) return cast_error::negative_overflow;
+            return cast_error::none;
+        }
+    };
+
+    // Floating-point source, integral target: NaN and infinity are rejected
+    template<typename ToType, typename FromType>
+    struct element_check<ToType, FromType, true, false> {
+        static bool fits(FromType value) {
+            // NaN fails the equality; infinity is beyond every integral range
+            return (value == value) &
+                   !(range_limits<ToType, FromType>::exceeds_max(value) | range_limits<ToType, FromType>::below_min(value));
+        }
+
+        static cast_error error(FromType value) {
+            if (std::isnan(value)) return cast_error::nan;
+            if (std::isinf(value)) return cast_error::infinity;
+            if (range_limits<ToType, FromType>::exceeds_max(value)) return cast_error::positive_overflow;
+            if (range_limits<ToType, FromType>::below_min(value)) return cast_error::negative_overflow;
+            return cast_error::none;
+        }
+    };
+
+    // Floating-point source and target: NaN and infinity pass through
+    template<typename ToType, typename FromType>
+    struct element_check<ToType, FromType, true, true> {
+        static bool fits(FromType value) {
+            // NaN fails both range comparisons and passes
+            const FromType infinity = std::numeric_limits<FromType>::infinity();
+            return !(range_limits<ToType, FromType>::exceeds_max(value) | range_limits<ToType, FromType>::below_min(value)) |
+                   (value == infinity) | (value == -infinity);
+        }
+
+        static cast_error error(FromType value) {
+            if (fits(value)) return cast_error::none;
+            return range_limits<ToType, FromType>::exceeds_max(value) ? cast_error::positive_overflow
+                                                                      : cast_error::negative_overflow;
+        }
+    };
+
+    /**
+     * @brief Index of the first element failing element_check, or count
+     */
+    template<typename ToType, typename FromType>
+    std::size_t find_first_failure(const FromType* src, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!element_check<ToType, FromType>::fits(src[i])) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Check a block of elements without early exit, so the loop vectorizes
+     */
+    template<typename ToType, typename FromType>
+    bool block_fits(const FromType* src, std::size_t count) {
+        // An integer OR-reduction vectorizes where a bool &= reduction does not
+        unsigned failed = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            failed |= static_cast<unsigned>(!element_check<ToType, FromType>::fits(src[i]));
+        }
+        return failed == 0;
+    }
+
+    /// Unsigned type with the bits of T; T itself unless T is a signed integral type
+    template<typename T, bool IsSignedIntegral = std::is_integral<T>::value && std::is_signed<T>::value>
+    struct bits_of {
+        typedef T type;
+    };
+
+    template<typename T>
+    struct bits_of<T, true> {
+        typedef typename std::make_unsigned<T>::type type;
+    };
+
+    /**
+     * @brief Integer pairs differing only in signedness (int32_t / uint32_t, long long / unsigned long long)
+     *
+     * The value bits are kept by the conversion and a value fits exactly when
+     * its top bit is clear. Such pairs may also access each other's objects.
+     */
+    template<typename ToType, typename FromType>
+    struct is_sign_change : std::integral_constant<bool,
+        std::is_integral<ToType>::value && std::is_integral<FromType>::value &&
+        !std::is_same<ToType, bool>::value && !std::is_same<FromType, bool>::value &&
+        std::is_signed<ToType>::value != std::is_signed<FromType>::value &&
+        std::is_same<typename bits_of<ToType>::type, typename bits_of<FromType>::type>::value> {};
+
+    /// 64-bit word with the top bit of every Size-byte lane set
+    template<std::size_t Size>
+    struct sign_bit_pattern;
+
+    template<>
+    struct sign_bit_pattern<1> { static const long long value = static_cast<long long>(0x8080808080808080ull); };
+
+    template<>
+    struct sign_bit_pattern<2> { static const long long value = static_cast<long long>(0x8000800080008000ull); };
+
+    template<>
+    struct sign_bit_pattern<4> { static const long long value = static_cast<long long>(0x8000000080000000ull); };
+
+    template<>
+    struct sign_bit_pattern<8> { static const long long value = static_cast<long long>(0x8000000000000000ull); };
+
+    /**
+     * @brief True if no element has its top bit set: one OR-reduction, no per-element compare
+     *
+     * The SIMD paths OR 512 (AVX-512), 256 (AVX2) or 128 (SSE2) bits per load
+     * into two accumulators and test the sign bits of all lanes once at the end.
+     */
+    template<typename FromType>
+    bool sign_bits_clear(const FromType* src, std::size_t count) {
+        typedef typename bits_of<FromType>::type bits_type;
+        std::size_t i = 0;
+#if NCAST_HAS_AVX512
+        const std::size_t lanes = 64 / sizeof(FromType);
+        __m512i any0 = _mm512_setzero_si512();
+        __m512i any1 = _mm512_setzero_si512();
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            any0 = _mm512_or_si512(any0, _mm512_loadu_si512(src + i));
+            any1 = _mm512_or_si512(any1, _mm512_loadu_si512(src + i + lanes));
+        }
+        const __m512i sign_bits = _mm512_set1_epi64(sign_bit_pattern<sizeof(FromType)>::value);
+        if (_mm512_test_epi64_mask(_mm512_or_si512(any0, any1), sign_bits) != 0) {
+            return false;
+        }
+#elif NCAST_HAS_AVX2
+        const std::size_t lanes = 32 / sizeof(FromType);
+        __m256i any0 = _mm256_setzero_si256();
+        __m256i any1 = _mm256_setzero_si256();
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            any0 = _mm256_or_si256(any0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+            any1 = _mm256_or_si256(any1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + lanes)));
+        }
+        const __m256i sign_bits = _mm256_set1_epi64x(sign_bit_pattern<sizeof(FromType)>::value);
+        if (!_mm256_testz_si256(_mm256_or_si256(any0, any1), sign_bits)) {
+            return false;
+        }
+#elif NCAST_HAS_SSE2
+        const std::size_t lanes = 16 / sizeof(FromType);
+        __m128i any0 = _mm_setzero_si128();
+        __m128i any1 = _mm_setzero_si128();
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            any0 = _mm_or_si128(any0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            any1 = _mm_or_si128(any1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + lanes)));
+        }
+        const __m128i sign_bits = _mm_set1_epi64x(sign_bit_pattern<sizeof(FromType)>::value);
+        __m128i set = _mm_and_si128(_mm_or_si128(any0, any1), sign_bits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(set, _mm_setzero_si128())) != 0xffff) {
+            return false;
+        }
+#endif
+        bits_type any = 0;
+        for (; i < count; ++i) {
+            any = static_cast<bits_type>(any | static_cast<bits_type>(src[i]));
+        }
+        return (any >> (std::numeric_limits<bits_type>::digits - 1)) == 0;
+    }
+
+    /**
+     * @brief Copy a same-width sign change up to the first element with its top bit set
+     *
+     * One pass at memcpy speed: each step loads four 512-bit (AVX-512),
+     * 256-bit (AVX2) or 128-bit (SSE2) vectors, ORs them and tests the sign
+     * bits once; a clean group is stored as is. A group with a sign bit set is
+     * finished element by element, so nothing from the failing element on is
+     * written. Stores are aligned by a scalar prologue: unaligned 512-bit
+     * stores split cache lines and lose to memcpy beyond L1.
+     *
+     * @return Number of elements copied (the index of the first failing element, or count)
+     */
+    template<typename ToType, typename FromType>
+    std::size_t copy_while_sign_bits_clear(const FromType* src, std::size_t count, ToType* dst) {
+        typedef typename bits_of<FromType>::type bits_type;
+        const int sign_shift = std::numeric_limits<bits_type>::digits - 1;
+        std::size_t i = 0;
+#if NCAST_HAS_AVX512 || NCAST_HAS_AVX2
+        const std::size_t vector_bytes = NCAST_HAS_AVX512 ? 64 : 32;
+        for (; i < count && (reinterpret_cast<std::uintptr_t>(dst + i) & (vector_bytes - 1)) != 0; ++i) {
+            if (static_cast<bits_type>(src[i]) >> sign_shift) {
+                return i;
+            }
+            dst[i] = static_cast<ToType>(src[i]);
+        }
+#endif
+#if NCAST_HAS_AVX512
+        const std::size_t lanes = 64 / sizeof(FromType);
+        const __m512i sign_bits = _mm512_set1_epi64(sign_bit_pattern<sizeof(FromType)>::value);
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            __m512i a = _mm512_loadu_si512(src + i);
+            __m512i b = _mm512_loadu_si512(src + i + lanes);
+            __m512i c = _mm512_loadu_si512(src + i + 2 * lanes);
+            __m512i d = _mm512_loadu_si512(src + i + 3 * lanes);
+            if (_mm512_test_epi64_mask(_mm512_or_si512(_mm512_or_si512(a, b), _mm512_or_si512(c, d)), sign_bits) != 0) {
+                break;
+            }
+            _mm512_store_si512(dst + i, a);
+            _mm512_store_si512(dst + i + lanes, b);
+            _mm512_store_si512(dst + i + 2 * lanes, c);
+            _mm512_store_si512(dst + i + 3 * lanes, d);
+        }
+#elif NCAST_HAS_AVX2
+        const std::size_t lanes = 32 / sizeof(FromType);
+        const __m256i sign_bits = _mm256_set1_epi64x(sign_bit_pattern<sizeof(FromType)>::value);
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + lanes));
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 2 * lanes));
+            __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 3 * lanes));
+            if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), sign_bits)) {
+                break;
+            }
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + i), a);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + i + lanes), b);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + i + 2 * lanes), c);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + i + 3 * lanes), d);
+        }
+#elif NCAST_HAS_SSE2
+        const std::size_t lanes = 16 / sizeof(FromType);
+        const __m128i sign_bits = _mm_set1_epi64x(sign_bit_pattern<sizeof(FromType)>::value);
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + lanes));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 2 * lanes));
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 3 * lanes));
+            __m128i set = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), sign_bits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(set, _mm_setzero_si128())) != 0xffff) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), a);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + lanes), b);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 2 * lanes), c);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 3 * lanes), d);
+        }
+#endif
+        for (; i < count; ++i) {
+            if (static_cast<bits_type>(src[i]) >> sign_shift) {
+                break;
+            }
+            dst[i] = static_cast<ToType>(src[i]);
+        }
+        return i;
+    }
+
+    /// Elements validated per step by the generic checked conversions
+    const std::size_t bulk_block_size = 256;
+
+    /**
+     * @brief Validate and convert one block; returns the number of elements converted
+     *
+     * A block that passes (the common case) costs one vectorized validation
+     * pass and one vectorized conversion pass.
+     */
+    template<typename ToType, typename FromType, bool IsSignChange = is_sign_change<ToType, FromType>::value>
+    struct checked_block {
+        static const std::size_t block_size = bulk_block_size;   ///< Elements per call in try_numeric_cast_n
+
+        static std::size_t convert(const FromType* src, std::size_t count, ToType* dst) {
+            std::size_t valid = block_fits<ToType>(src, count) ? count : find_first_failure<ToType>(src, count);
+            for (std::size_t i = 0; i < valid; ++i) {
+                dst[i] = static_cast<ToType>(src[i]);
+            }
+            return valid;
+        }
+    };
+
+    /// Same-width sign change: a copy of the bits that stops at the first set sign bit
+    template<typename ToType, typename FromType>
+    struct checked_block<ToType, FromType, true> {
+        static const std::size_t block_size = ~static_cast<std::size_t>(0);   ///< Whole arrays in one call
+
+        static std::size_t convert(const FromType* src, std::size_t count, ToType* dst) {
+            return copy_while_sign_bits_clear(src, count, dst);
+        }
+    };
+
+    template<typename ToType, typename FromType>
+    std::size_t convert_checked_block(const FromType* src, std::size_t count, ToType* dst) {
+        return checked_block<ToType, FromType>::convert(src, count, dst);
+    }
+
+    /**
+     * @brief Exactness of an integer in a floating-point type
+     *
+     * A magnitude u is exact when its odd part fits the significand:
+     * u < lowest_set_bit(u) * 2^digits, i.e. (u >> digits) < lowest_set_bit(u).
+     * Values up to 2^digits (2^24 for float, 2^53 for double) always pass;
+     * larger ones pass when enough low bits are zero. Written without branches
+     * (abs, shift, compare), so loops over it vectorize.
+     */
+    template<typename ToType, typename FromType>
+    struct exact_check {
+        typedef typename std::make_unsigned<typename std::common_type<FromType, unsigned>::type>::type magnitude_type;
+        static const int digits = std::numeric_limits<ToType>::digits;
+        static const bool always = digits >= std::numeric_limits<magnitude_type>::digits;
+
+        static bool fits(FromType value) {
+            magnitude_type u = static_cast<magnitude_type>(value);
+            magnitude_type negative = static_cast<magnitude_type>(0) -
+                static_cast<magnitude_type>(std::is_signed<FromType>::value && value < 0);
+            u = (u ^ negative) - negative;
+            magnitude_type lowest = u & (static_cast<magnitude_type>(0) - u);
+            // lowest - 1 wraps to the maximum for zero
+            return always | ((u >> (always ? 0 : digits)) <= static_cast<magnitude_type>(lowest - 1));
+        }
+    };
+
+    /**
+     * @brief Exactness-check and convert one block; returns the number of elements converted
+     */
+    template<typename ToType, typename FromType>
+    std::size_t convert_exact_block(const FromType* src, std::size_t count, ToType* dst) {
+        unsigned failed = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            failed |= static_cast<unsigned>(!exact_check<ToType, FromType>::fits(src[i]));
+        }
+        std::size_t valid = count;
+        if (failed != 0) {
+            for (valid = 0; exact_check<ToType, FromType>::fits(src[valid]); ++valid) {
+            }
+        }
+        for (std::size_t i = 0; i < valid; ++i) {
+            dst[i] = static_cast<ToType>(src[i]);
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Validate one double for conversion to float under float_checks
+     *
+     * The range rule is numeric_cast's: finite magnitudes above FLT_MAX fail,
+     * NaN and infinity pass unless rejected. reject_underflow fails nonzero
+     * magnitudes below FLT_MIN (tiny before rounding); exact fails values that
+     * change in a round trip through float.
+     */
+    inline cast_error check_double_to_float(double value, float_checks checks) {
+        const double magnitude = std::fabs(value);
+        if (std::isnan(value)) {
+            return has_check(checks, float_checks::reject_nan) ? cast_error::nan : cast_error::none;
+        }
+        if (std::isinf(value)) {
+            return has_check(checks, float_checks::reject_infinity) ? cast_error::infinity : cast_error::none;
+        }
+        if (magnitude > static_cast<double>(std::numeric_limits<float>::max())) {
+            return value < 0 ? cast_error::negative_overflow : cast_error::positive_overflow;
+        }
+        if (has_check(checks, float_checks::reject_underflow) && magnitude > 0.0 &&
+            magnitude < static_cast<double>(std::numeric_limits<float>::min())) {
+            return cast_error::underflow;
+        }
+        if (has_check(checks, float_checks::exact) && static_cast<double>(static_cast<float>(value)) != value) {
+            return cast_error::precision_loss;
+        }
+        return cast_error::none;
+    }
+
+#if NCAST_HAS_AVX512
+    // check_double_to_float for 8 lanes; the enabled_* masks are all ones or zero
+    struct double_to_float_checks_avx512 {
+        __mmask8 exact, nan, infinity, underflow;
+
+        explicit double_to_float_checks_avx512(float_checks checks)
+            : exact(enabled(checks, float_checks::exact)), nan(enabled(checks, float_checks::reject_nan)),
+              infinity(enabled(checks, float_checks::reject_infinity)),
+              underflow(enabled(checks, float_checks::reject_underflow)) {}
+
+        static __mmask8 enabled(float_checks checks, float_checks flag) {
+            return static_cast<__mmask8>(has_check(checks, flag) ? 0xff : 0);
+        }
+
+        // Bit i is set if lane i of value fails; converted is value narrowed to float
+        unsigned fail(__m512d value, __m256 converted) const {
+            const __m512d infinity_value = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+            const __m512d magnitude = _mm512_abs_pd(value);
+            unsigned failed = _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(magnitude, infinity_value, _CMP_LT_OQ), magnitude,
+                _mm512_set1_pd(static_cast<double>(std::numeric_limits<float>::max())), _CMP_GT_OQ);
+            failed |= _mm512_mask_cmp_pd_mask(nan, value, value, _CMP_UNORD_Q);
+            failed |= _mm512_mask_cmp_pd_mask(infinity, magnitude, infinity_value, _CMP_EQ_OQ);
+            failed |= _mm512_mask_cmp_pd_mask(_mm512_mask_cmp_pd_mask(underflow, magnitude, _mm512_setzero_pd(), _CMP_GT_OQ),
+                magnitude, _mm512_set1_pd(static_cast<double>(std::numeric_limits<float>::min())), _CMP_LT_OQ);
+            failed |= _mm512_mask_cmp_pd_mask(exact, _mm512_maskz_cvtps_pd(0xff, converted), value, _CMP_NEQ_OQ);
+            return failed;
+        }
+    };
+#elif NCAST_HAS_AVX2
+    struct double_to_float_checks_avx2 {
+        __m256d exact, nan, infinity, underflow;
+
+        explicit double_to_float_checks_avx2(float_checks checks)
+            : exact(enabled(checks, float_checks::exact)), nan(enabled(checks, float_checks::reject_nan)),
+              infinity(enabled(checks, float_checks::reject_infinity)),
+              underflow(enabled(checks, float_checks::reject_underflow)) {}
+
+        static __m256d enabled(float_checks checks, float_checks flag) {
+            return _mm256_castsi256_pd(_mm256_set1_epi64x(has_check(checks, flag) ? -1 : 0));
+        }
+
+        // Failing lanes are all ones
+        __m256d fail(__m256d value, __m128 converted) const {
+            const __m256d infinity_value = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            const __m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), value);
+            __m256d failed = _mm256_and_pd(_mm256_cmp_pd(magnitude, infinity_value, _CMP_LT_OQ),
+                _mm256_cmp_pd(magnitude, _mm256_set1_pd(static_cast<double>(std::numeric_limits<float>::max())), _CMP_GT_OQ));
+            failed = _mm256_or_pd(failed, _mm256_and_pd(nan, _mm256_cmp_pd(value, value, _CMP_UNORD_Q)));
+            failed = _mm256_or_pd(failed, _mm256_and_pd(infinity, _mm256_cmp_pd(magnitude, infinity_value, _CMP_EQ_OQ)));
+            __m256d tiny = _mm256_and_pd(_mm256_cmp_pd(magnitude, _mm256_setzero_pd(), _CMP_GT_OQ),
+                _mm256_cmp_pd(magnitude, _mm256_set1_pd(static_cast<double>(std::numeric_limits<float>::min())), _CMP_LT_OQ));
+            failed = _mm256_or_pd(failed, _mm256_and_pd(underflow, tiny));
+            failed = _mm256_or_pd(failed, _mm256_and_pd(exact, _mm256_cmp_pd(_mm256_cvtps_pd(converted), value, _CMP_NEQ_OQ)));
+            return failed;
+        }
+    };
+#elif NCAST_HAS_SSE2
+    struct double_to_float_checks_sse2 {
+        __m128d exact, nan, infinity, underflow;
+
+        explicit double_to_float_checks_sse2(float_checks checks)
+            : exact(enabled(checks, float_checks::exact)), nan(enabled(checks, float_checks::reject_nan)),
+              infinity(enabled(checks, float_checks::reject_infinity)),
+              underflow(enabled(checks, float_checks::reject_underflow)) {}
+
+        static __m128d enabled(float_checks checks, float_checks flag) {
+            return _mm_castsi128_pd(_mm_set1_epi64x(has_check(checks, flag) ? -1 : 0));
+        }
+
+        // Failing lanes are all ones; converted holds value narrowed to float in its low half
+        __m128d fail(__m128d value, __m128 converted) const {
+            const __m128d infinity_value = _mm_set1_pd(std::numeric_limits<double>::infinity());
+            const __m128d magnitude = _mm_andnot_pd(_mm_set1_pd(-0.0), value);
+            // Ordered compares: NaN lanes fail none of them
+            __m128d failed = _mm_and_pd(_mm_cmplt_pd(magnitude, infinity_value),
+                _mm_cmpgt_pd(magnitude, _mm_set1_pd(static_cast<double>(std::numeric_limits<float>::max()))));
+            failed = _mm_or_pd(failed, _mm_and_pd(nan, _mm_cmpunord_pd(value, value)));
+            failed = _mm_or_pd(failed, _mm_and_pd(infinity, _mm_cmpeq_pd(magnitude, infinity_value)));
+            __m128d tiny = _mm_and_pd(_mm_cmpgt_pd(magnitude, _mm_setzero_pd()),
+                _mm_cmplt_pd(magnitude, _mm_set1_pd(static_cast<double>(std::numeric_limits<float>::min()))));
+            failed = _mm_or_pd(failed, _mm_and_pd(underflow, tiny));
+            __m128d changed = _mm_andnot_pd(_mm_cmpeq_pd(_mm_cvtps_pd(converted), value), _mm_cmpord_pd(value, value));
+            failed = _mm_or_pd(failed, _mm_and_pd(exact, changed));
+            return failed;
+        }
+    };
+#endif
+
+    /**
+     * @brief double -> float with float_checks in a single pass
+     *
+     * Each step narrows 16 (AVX-512), 8 (AVX2) or 4 (SSE2) doubles, classifies
+     * them with vector compares against the converted values and stores the
+     * floats if no lane fails; the step holding the first failure is finished
+     * by the scalar loop. The MXCSR exception flags are not used: they are
+     * sticky and not per lane, so locating the failing element would still
+     * need the compares, and the compiler may move a conversion across a flag
+     * read.
+     */
+    inline bulk_result try_double_to_float_n(const double* src, std::size_t count, float* dst, float_checks checks) {
+        std::size_t i = 0;
+#if NCAST_HAS_AVX512
+        const double_to_float_checks_avx512 enabled(checks);
+        for (; i + 16 <= count; i += 16) {
+            __m512d lo = _mm512_loadu_pd(src + i);
+            __m512d hi = _mm512_loadu_pd(src + i + 8);
+            // The zero-masked forms avoid GCC's -Wmaybe-uninitialized on _mm512_cvt*'s undefined pass-through
+            __m256 lo_converted = _mm512_maskz_cvtpd_ps(0xff, lo);
+            __m256 hi_converted = _mm512_maskz_cvtpd_ps(0xff, hi);
+            if ((enabled.fail(lo, lo_converted) | enabled.fail(hi, hi_converted)) != 0) {
+                break;
+            }
+            _mm256_storeu_ps(dst + i, lo_converted);
+            _mm256_storeu_ps(dst + i + 8, hi_converted);
+        }
+#elif NCAST_HAS_AVX2
+        const double_to_float_checks_avx2 enabled(checks);
+        for (; i + 8 <= count; i += 8) {
+            __m256d lo = _mm256_loadu_pd(src + i);
+            __m256d hi = _mm256_loadu_pd(src + i + 4);
+            __m128 lo_converted = _mm256_cvtpd_ps(lo);
+            __m128 hi_converted = _mm256_cvtpd_ps(hi);
+            if (_mm256_movemask_pd(_mm256_or_pd(enabled.fail(lo, lo_converted), enabled.fail(hi, hi_converted))) != 0) {
+                break;
+            }
+            _mm_storeu_ps(dst + i, lo_converted);
+            _mm_storeu_ps(dst + i + 4, hi_converted);
+        }
+#elif NCAST_HAS_SSE2
+        const double_to_float_checks_sse2 enabled(checks);
+        for (; i + 4 <= count; i += 4) {
+            __m128d lo = _mm_loadu_pd(src + i);
+            __m128d hi = _mm_loadu_pd(src + i + 2);
+            __m128 lo_converted = _mm_cvtpd_ps(lo);
+            __m128 hi_converted = _mm_cvtpd_ps(hi);
+            if (_mm_movemask_pd(_mm_or_pd(enabled.fail(lo, lo_converted), enabled.fail(hi, hi_converted))) != 0) {
+                break;
+            }
+            _mm_storeu_ps(dst + i, _mm_movelh_ps(lo_converted, hi_converted));
+        }
+#endif
+        // Tail, or the step containing the first failure
+        for (; i < count; ++i) {
+            cast_error error = check_double_to_float(src[i], checks);
+            if (error != cast_error::none) {
+                bulk_result result = { i, error };
+                return result;
+            }
+            dst[i] = static_cast<float>(src[i]);
+        }
+        bulk_result result = { count, cast_error::none };
+        return result;
+    }
+
+    /// double -> float: the single-pass kernel with numeric_cast's rules instead of check-then-convert blocks
+    template<>
+    struct checked_block<float, double, false> {
+        static const std::size_t block_size = ~static_cast<std::size_t>(0);   ///< Whole arrays in one call
+
+        static std::size_t convert(const double* src, std::size_t count, float* dst) {
+            return try_double_to_float_n(src, count, dst, float_checks::none).index;
+        }
+    };
+
+    /**
+     * @brief Throw cast_exception describing a failed bulk conversion
+     */
+    inline void throw_bulk_error(const bulk_result& result, const char* file, int line, const char* function) {
+        std::ostringstream ss;
+        ss << "Bulk cast failed at index " << result.index << ": " << cast_error_message(result.error);
+        throw cast_exception(ss.str(), file, line, function, result.error);
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert an array with numeric_cast validation
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @return Index and reason of the first failure, or {count, cast_error::none}
+ */
+template<typename ToType, typename FromType>
+bulk_result try_numeric_cast_n(const FromType* src, std::size_t count, ToType* dst) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "try_numeric_cast_n requires built-in arithmetic types");
+    const std::size_t block_size = detail::checked_block<ToType, FromType>::block_size;
+    for (std::size_t base = 0; base < count; base += block_size) {
+        std::size_t n = count - base < block_size ? count - base : block_size;
+        std::size_t valid = detail::convert_checked_block(src + base, n, dst + base);
+        if (valid != n) {
+            bulk_result result = { base + valid, detail::element_check<ToType, FromType>::error(src[base + valid]) };
+            return result;
+        }
+    }
+    bulk_result result = { count, cast_error::none };
+    return result;
+}
+
+/**
+ * @brief Convert an array with numeric_cast validation, throwing on failure
+ *
+ * @throws cast_exception if an element does not fit; elements before it are converted
+ */
+template<typename ToType, typename FromType>
+void numeric_cast_n(const FromType* src, std::size_t count, ToType* dst) {
+    bulk_result result = try_numeric_cast_n(src, count, dst);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+}
+
+namespace detail {
+
+    /**
+     * @brief try_numeric_cast_n with float_checks, selected by source kind
+     */
+    template<typename ToType, typename FromType, bool IsIntegralSource = std::is_integral<FromType>::value>
+    struct float_checked_conversion {
+        static bulk_result convert(const FromType* src, std::size_t count, ToType* dst, float_checks checks) {
+            if (!has_check(checks, float_checks::exact)) {
+                return try_numeric_cast_n(src, count, dst);
+            }
+            for (std::size_t base = 0; base < count; base += bulk_block_size) {
+                std::size_t n = count - base < bulk_block_size ? count - base : bulk_block_size;
+                std::size_t valid = convert_exact_block(src + base, n, dst + base);
+                if (valid != n) {
+                    bulk_result result = { base + valid, cast_error::precision_loss };
+                    return result;
+                }
+            }
+            bulk_result result = { count, cast_error::none };
+            return result;
+        }
+    };
+
+    template<typename ToType, typename FromType>
+    struct float_checked_conversion<ToType, FromType, false> {
+        static bulk_result convert(const double* src, std::size_t count, float* dst, float_checks checks) {
+            return try_double_to_float_n(src, count, dst, checks);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Convert integers to a floating-point type, or double to float, with float_checks
+ *
+ * Integer sources: numeric_cast accepts any integer for a floating-point
+ * target and rounds. With float_checks::exact every element must be exactly
+ * representable: |v| <= 2^24 (float) or 2^53 (double), or a larger value
+ * whose trailing zero bits leave no more significant bits than the
+ * significand holds; the first inexact element is reported as
+ * cast_error::precision_loss. The other flags do not apply to integer
+ * sources; without exact this is try_numeric_cast_n(src, count, dst).
+ *
+ * double -> float: finite values beyond float's range fail as in
+ * numeric_cast. All flags apply: exact (precision_loss), reject_nan,
+ * reject_infinity and reject_underflow, which fails nonzero values below
+ * numeric_limits<float>::min() (cast_error::underflow) because they would
+ * become subnormal or zero. Validation and narrowing run in one vectorized
+ * pass.
+ *
+ * Nothing from the first failing element on is written.
+ *
+ * @code
+ * bulk_result r = ncast::try_numeric_cast_n(ids, n, ids_as_float, ncast::float_checks::exact);
+ * bulk_result s = ncast::try_numeric_cast_n(features, n, stored,
+ *                                           ncast::float_checks::reject_underflow | ncast::float_checks::reject_nan);
+ * @endcode
+ */
+template<typename ToType, typename FromType>
+bulk_result try_numeric_cast_n(const FromType* src, std::size_t count, ToType* dst, float_checks checks) {
+    static_assert((std::is_integral<FromType>::value && std::is_floating_point<ToType>::value) ||
+                  (std::is_same<FromType, double>::value && std::is_same<ToType, float>::value),
+                  "float_checks of try_numeric_cast_n apply to integer -> floating-point and double -> float conversions");
+    return detail::float_checked_conversion<ToType, FromType>::convert(src, count, dst, checks);
+}
+
+/**
+ * @brief Convert with float_checks, throwing on failure
+ *
+ * @throws cast_exception with the error of the first failing element
+ */
+template<typename ToType, typename FromType>
+void numeric_cast_n(const FromType* src, std::size_t count, ToType* dst, float_checks checks) {
+    bulk_result result = try_numeric_cast_n(src, count, dst, checks);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+}
+
+} // namespace ncast
+
+#endif // NCAST_BULK_H
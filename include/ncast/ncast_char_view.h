@@ -0,0 +1,195 @@
+#ifndef NCAST_CHAR_VIEW_H
+#define NCAST_CHAR_VIEW_H
+
+/**
+ * @file ncast_char_view.h
+ * @brief Zero-copy char_cast views over strings and byte buffers
+ *
+ * char_cast converts one character between char, signed char and unsigned
+ * char. char_cast_view<To>() applies the same conversion to a whole string
+ * or buffer without copying it: it returns a char_span<To>, a pointer and a
+ * length that reads the original storage as To. The three char types may
+ * access each other's objects and have the same size and alignment, so the
+ * view is valid wherever the source is.
+ *
+ * Type safety is the same as char_cast: both the source and the target
+ * element types must satisfy is_char_type (a view of int or std::byte does
+ * not compile). Constness is kept: a view of a const string or a
+ * std::string_view is a char_span<const To>. The view does not own the
+ * storage; it is invalidated when the source is resized or destroyed, and
+ * views of temporary strings and vectors do not compile.
+ *
+ * Sources: pointer and length, std::basic_string, std::vector, C arrays,
+ * char_span and, in C++17, std::basic_string_view.
+ *
+ * @code
+ * #include <ncast/ncast_char_view.h>
+ *
+ * std::string payload = read_message();
+ * ncast::char_span<const unsigned char> bytes = ncast::char_cast_view<unsigned char>(payload);
+ * std::uint32_t crc = crc32(bytes.data(), bytes.size());   // no copy
+ * @endcode
+ */
+
+#include "ncast.h"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if NCAST_HAS_CPP17
+#include <string_view>
+#endif
+
+namespace ncast {
+
+/**
+ * @brief Non-owning view of a contiguous run of characters (pointer and length)
+ *
+ * @tparam CharType char, signed char or unsigned char, optionally const
+ */
+template<typename CharType>
+class char_span {
+    static_assert(detail::is_char_type<typename std::remove_cv<CharType>::type>::value,
+                  "char_span element type must be a char type (char, signed char, unsigned char)");
+
+public:
+    typedef CharType element_type;
+    typedef typename std::remove_cv<CharType>::type value_type;
+    typedef std::size_t size_type;
+    typedef CharType* pointer;
+    typedef CharType& reference;
+    typedef CharType* iterator;
+
+    constexpr char_span() noexcept : data_(nullptr), size_(0) {}
+
+    constexpr char_span(CharType* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    /// A view of mutable characters converts to a view of const characters
+    template<typename OtherType, typename = typename std::enable_if<
+        std::is_same<const OtherType, CharType>::value && !std::is_const<OtherType>::value>::type>
+    constexpr char_span(const char_span<OtherType>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    constexpr CharType* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    constexpr CharType& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    /**
+     * @brief View of count characters starting at offset (count is clamped to the end)
+     */
+    constexpr char_span subspan(std::size_t offset, std::size_t count = ~static_cast<std::size_t>(0)) const noexcept {
+        return char_span(data_ + offset, count < size_ - offset ? count : size_ - offset);
+    }
+
+private:
+    CharType* data_;
+    std::size_t size_;
+};
+
+namespace detail {
+
+    /// To with the constness of From
+    template<typename ToType, typename FromType>
+    struct char_view_element {
+        static_assert(is_char_type<typename std::remove_cv<ToType>::type>::value,
+                      "ToType must be a char type (char, signed char, unsigned char)");
+        static_assert(is_char_type<typename std::remove_cv<FromType>::type>::value,
+                      "FromType must be a char type (char, signed char, unsigned char)");
+
+        typedef typename std::remove_cv<ToType>::type unqualified;
+        typedef typename std::conditional<std::is_const<FromType>::value || std::is_const<ToType>::value,
+                                          const unqualified, unqualified>::type type;
+    };
+
+    template<typename ToType, typename FromType>
+    char_span<typename char_view_element<ToType, FromType>::type> make_char_view(FromType* data, std::size_t size) {
+        typedef typename char_view_element<ToType, FromType>::type element;
+        return char_span<element>(reinterpret_cast<element*>(data), size);
+    }
+
+} // namespace detail
+
+/**
+ * @brief View size characters at data as ToType, without copying
+ *
+ * @tparam ToType Target char type (char, signed char, unsigned char)
+ * @return char_span<ToType>, or char_span<const ToType> for a const source
+ */
+template<typename ToType, typename FromType>
+char_span<typename detail::char_view_element<ToType, FromType>::type> char_cast_view(FromType* data, std::size_t size) {
+    return detail::make_char_view<ToType>(data, size);
+}
+
+/**
+ * @brief View a character array (including a string literal's terminating zero) as ToType
+ */
+template<typename ToType, typename FromType, std::size_t N>
+char_span<typename detail::char_view_element<ToType, FromType>::type> char_cast_view(FromType (&array)[N]) {
+    return detail::make_char_view<ToType>(array, N);
+}
+
+/**
+ * @brief View a string's characters as ToType; the terminating zero is not part of the view
+ */
+template<typename ToType, typename FromType, typename Traits, typename Allocator>
+char_span<typename detail::char_view_element<ToType, FromType>::type>
+char_cast_view(std::basic_string<FromType, Traits, Allocator>& text) {
+    // &text[0] is the mutable buffer in C++11 (data() is const until C++17), valid for empty strings too
+    return detail::make_char_view<ToType>(&text[0], text.size());
+}
+
+template<typename ToType, typename FromType, typename Traits, typename Allocator>
+char_span<typename detail::char_view_element<ToType, const FromType>::type>
+char_cast_view(const std::basic_string<FromType, Traits, Allocator>& text) {
+    return detail::make_char_view<ToType>(text.data(), text.size());
+}
+
+/// A view of a temporary string would dangle
+template<typename ToType, typename FromType, typename Traits, typename Allocator>
+void char_cast_view(std::basic_string<FromType, Traits, Allocator>&& text) = delete;
+
+/**
+ * @brief View a vector of characters as ToType
+ */
+template<typename ToType, typename FromType, typename Allocator>
+char_span<typename detail::char_view_element<ToType, FromType>::type>
+char_cast_view(std::vector<FromType, Allocator>& buffer) {
+    return detail::make_char_view<ToType>(buffer.data(), buffer.size());
+}
+
+template<typename ToType, typename FromType, typename Allocator>
+char_span<typename detail::char_view_element<ToType, const FromType>::type>
+char_cast_view(const std::vector<FromType, Allocator>& buffer) {
+    return detail::make_char_view<ToType>(buffer.data(), buffer.size());
+}
+
+/// A view of a temporary vector would dangle
+template<typename ToType, typename FromType, typename Allocator>
+void char_cast_view(std::vector<FromType, Allocator>&& buffer) = delete;
+
+/**
+ * @brief View a char_span as another char type
+ */
+template<typename ToType, typename FromType>
+char_span<typename detail::char_view_element<ToType, FromType>::type> char_cast_view(char_span<FromType> view) {
+    return detail::make_char_view<ToType>(view.data(), view.size());
+}
+
+#if NCAST_HAS_CPP17
+/**
+ * @brief View a string_view's characters as ToType (C++17)
+ */
+template<typename ToType, typename FromType, typename Traits>
+char_span<typename detail::char_view_element<ToType, const FromType>::type>
+char_cast_view(std::basic_string_view<FromType, Traits> text) {
+    return detail::make_char_view<ToType>(text.data(), text.size());
+}
+#endif
+
+} // namespace ncast
+
+#endif // NCAST_CHAR_VIEW_H
@@ -0,0 +1,299 @@
+#ifndef NCAST_CSV_H
+#define NCAST_CSV_H
+
+/**
+ * @file ncast_csv.h
+ * @brief Parallel ingestion of numeric CSV columns into typed column buffers
+ *
+ * csv_columns binds CSV field indexes to std::vector<T> columns and parses
+ * a whole text (typically a memory-mapped file) into them. Every bound field
+ * is parsed with parse_cast<T>, so the range check is fused into parsing: a
+ * "70000" in a std::int16_t column is a positive_overflow, not a wrapped
+ * value. Failures do not stop the ingestion; each one is recorded with its
+ * row and field index, the value is left as T(), and the remaining fields
+ * and rows are parsed.
+ *
+ * The text is split into chunks of about 1 MB whose boundaries are moved
+ * to the next line start, so no row straddles two chunks. A first pass
+ * counts the rows of every chunk (giving each chunk its first row index and
+ * the columns their final size), a second pass parses the chunks straight
+ * into place. Both passes run on a thread_pool with the work-stealing
+ * scheduler of try_numeric_cast_parallel(); the results do not depend on
+ * the number of threads.
+ *
+ * Errors are collected per chunk; an allocation failure (std::bad_alloc)
+ * on any thread is rethrown by parse() on the calling thread.
+ *
+ * Format: one row per line ('\n' or "\r\n"), fields separated by a single
+ * delimiter character, an optional header line. Bound fields must be bare
+ * numbers in parse_cast syntax: an empty, quoted, padded or missing field is
+ * an invalid_format error. Unbound fields are skipped and may hold anything
+ * except the delimiter.
+ *
+ * @code
+ * #include <ncast/ncast_csv.h>
+ *
+ * std::vector<std::uint32_t> ids;
+ * std::vector<float> prices;
+ * ncast::csv_columns columns(',', true);          // comma-separated, with a header line
+ * columns.add(0, ids).add(3, prices);
+ * ncast::thread_pool pool;
+ * ncast::csv_result r = columns.parse(text, size, pool);
+ * for (const ncast::csv_field_error& e : r.errors) {
+ *     reject(e.row, e.column, e.error);
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_parallel.h"
+#include "ncast_parse.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace ncast {
+
+/**
+ * @brief One field that failed to parse
+ */
+struct csv_field_error {
+    std::size_t row;        ///< Data row, 0-based (the header line is not counted)
+    std::size_t column;     ///< Field index within the row, 0-based
+    cast_error error;       ///< Reason of the failure
+};
+
+/**
+ * @brief Outcome of csv_columns::parse
+ */
+struct csv_result {
+    std::size_t rows;                       ///< Number of data rows; every bound column holds this many values
+    std::vector<csv_field_error> errors;    ///< Failed fields, by row and then by field index
+
+    bool ok() const { return errors.empty(); }
+};
+
+namespace detail {
+
+    /// Text bytes per chunk: large enough to amortize scheduling, small enough to balance threads
+    const std::size_t csv_chunk_bytes = 1024 * 1024;
+
+    /// Number of rows in [first, last): its line ends plus an unterminated last line
+    inline std::size_t count_csv_rows(const char* first, const char* last) {
+        std::size_t rows = 0;
+        for (const char* p = first; p != last; ++p) {
+            rows += *p == '\n';
+        }
+        return rows + (first != last && last[-1] != '\n');
+    }
+
+    /**
+     * @brief Type-erased access to a bound std::vector<T> column
+     */
+    struct csv_binding {
+        std::size_t column;
+        void* values;
+
+        /// Replace the column's contents with rows values of T(); returns the data pointer
+        void* (*resize)(void* values, std::size_t rows);
+
+        /// Parse the field at first into data[row]; stop is the delimiter or line end after it, or null on failure
+        cast_error (*parse)(const char* first, const char* line_end, char delimiter,
+                            void* data, std::size_t row, const char*& stop);
+    };
+
+    template<typename T>
+    struct csv_column_access {
+        static void* resize(void* values, std::size_t rows) {
+            std::vector<T>& column = *static_cast<std::vector<T>*>(values);
+            column.clear();
+            column.resize(rows);
+            return column.data();
+        }
+
+        static cast_error parse(const char* first, const char* line_end, char delimiter,
+                                void* data, std::size_t row, const char*& stop) {
+            parse_result<T> r = parse_cast<T>(first, line_end);
+            if (r.ok() && r.ptr != line_end && *r.ptr != delimiter) {
+                // Text after the number ("12kg", "1.5" in an integer column)
+                r.value = T();
+                r.error = cast_error::invalid_format;
+            }
+            static_cast<T*>(data)[row] = r.value;
+            stop = r.ok() ? r.ptr : nullptr;
+            return r.error;
+        }
+    };
+
+    inline bool csv_binding_before(const csv_binding& a, const csv_binding& b) {
+        return a.column < b.column;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Bindings of CSV field indexes to typed columns, and the parser that fills them
+ *
+ * The bound vectors are referenced, not owned: they must outlive the
+ * csv_columns object, and parse() replaces their contents.
+ */
+class csv_columns {
+private:
+    std::vector<detail::csv_binding> bindings_;     // sorted by field index
+    char delimiter_;
+    bool header_;
+
+    /// Parse the rows of one chunk, the first of which is row first_row
+    void parse_chunk(const char* first, const char* last, std::size_t first_row,
+                     void* const* data, std::vector<csv_field_error>& errors) const {
+        std::size_t row = first_row;
+        for (const char* p = first; p != last; ++row) {
+            const char* line_end = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(last - p)));
+            const char* next = line_end ? line_end + 1 : last;
+            line_end = line_end ? line_end : last;
+            if (line_end != p && line_end[-1] == '\r') {
+                --line_end;
+            }
+
+            // Walk the fields once, left to right; a parsed field's end is known without a search
+            const char* field = p;
+            const char* field_end = nullptr;
+            std::size_t column = 0;
+            bool has_field = true;
+            for (std::size_t b = 0; b < bindings_.size(); ++b) {
+                const detail::csv_binding& binding = bindings_[b];
+                while (has_field && column < binding.column) {
+                    const char* d = field_end ? field_end : static_cast<const char*>(
+                        std::memchr(field, delimiter_, static_cast<std::size_t>(line_end - field)));
+                    has_field = d != nullptr && d != line_end;
+                    field = has_field ? d + 1 : line_end;
+                    field_end = nullptr;
+                    ++column;
+                }
+                cast_error error = cast_error::invalid_format;
+                if (has_field) {
+                    const char* stop;
+                    error = binding.parse(field, line_end, delimiter_, data[b], row, stop);
+                    field_end = stop;
+                }
+                if (error != cast_error::none) {
+                    csv_field_error failure = { row, binding.column, error };
+                    errors.push_back(failure);
+                }
+            }
+            p = next;
+        }
+    }
+
+    /// Run task(chunk) for every chunk, on the pool when there is one
+    template<typename Task>
+    static void for_each_chunk(std::size_t chunks, thread_pool* pool, Task task) {
+        if (pool == nullptr || pool->size() == 1 || chunks <= 1) {
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                task(chunk);
+            }
+            return;
+        }
+        detail::chunk_scheduler scheduler(chunks, pool->size());
+        pool->run([&](unsigned thread) {
+            std::size_t chunk;
+            while (scheduler.next(thread, chunk)) {
+                task(chunk);
+            }
+        });
+    }
+
+    csv_result parse_text(const char* text, std::size_t size, thread_pool* pool) const {
+        const char* first = text;
+        const char* last = text + size;
+        if (header_ && first != last) {
+            const char* header_end = static_cast<const char*>(std::memchr(first, '\n', size));
+            first = header_end ? header_end + 1 : last;
+        }
+
+        // Chunk boundaries at line starts
+        std::vector<const char*> bounds(1, first);
+        while (bounds.back() != last) {
+            const char* start = bounds.back();
+            if (static_cast<std::size_t>(last - start) <= detail::csv_chunk_bytes) {
+                bounds.push_back(last);
+                break;
+            }
+            const char* cut = start + detail::csv_chunk_bytes;
+            const char* line_end = static_cast<const char*>(std::memchr(cut, '\n', static_cast<std::size_t>(last - cut)));
+            bounds.push_back(line_end ? line_end + 1 : last);
+        }
+        const std::size_t chunks = bounds.size() - 1;
+
+        // Pass 1: rows per chunk, then each chunk's first row
+        std::vector<std::size_t> first_rows(chunks + 1, 0);
+        for_each_chunk(chunks, pool, [&](std::size_t chunk) {
+            first_rows[chunk + 1] = detail::count_csv_rows(bounds[chunk], bounds[chunk + 1]);
+        });
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            first_rows[chunk + 1] += first_rows[chunk];
+        }
+
+        csv_result result;
+        result.rows = first_rows[chunks];
+        std::vector<void*> data(bindings_.size());
+        for (std::size_t b = 0; b < bindings_.size(); ++b) {
+            data[b] = bindings_[b].resize(bindings_[b].values, result.rows);
+        }
+
+        // Pass 2: parse every chunk into place, collecting its errors separately
+        std::vector<std::vector<csv_field_error> > chunk_errors(chunks);
+        for_each_chunk(chunks, pool, [&](std::size_t chunk) {
+            parse_chunk(bounds[chunk], bounds[chunk + 1], first_rows[chunk], data.data(), chunk_errors[chunk]);
+        });
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            result.errors.insert(result.errors.end(), chunk_errors[chunk].begin(), chunk_errors[chunk].end());
+        }
+        return result;
+    }
+
+public:
+    /**
+     * @param delimiter Field separator
+     * @param header True when the first line holds column names and is skipped
+     */
+    explicit csv_columns(char delimiter = ',', bool header = false) : delimiter_(delimiter), header_(header) {}
+
+    /**
+     * @brief Bind field index column (0-based) to values
+     *
+     * @tparam T Column type: integral (not bool), float, double or half
+     * @return *this, so bindings can be chained
+     */
+    template<typename T>
+    csv_columns& add(std::size_t column, std::vector<T>& values) {
+        static_assert((std::is_integral<T>::value && !std::is_same<T, bool>::value)
+                          || detail::is_parse_float_type<T>::value,
+                      "csv_columns requires integral, float, double or half columns");
+        detail::csv_binding binding = { column, &values, &detail::csv_column_access<T>::resize,
+                                        &detail::csv_column_access<T>::parse };
+        bindings_.insert(std::upper_bound(bindings_.begin(), bindings_.end(), binding, detail::csv_binding_before),
+                         binding);
+        return *this;
+    }
+
+    /**
+     * @brief Parse size characters of CSV text on the calling thread
+     */
+    csv_result parse(const char* text, std::size_t size) const {
+        return parse_text(text, size, nullptr);
+    }
+
+    /**
+     * @brief Parse size characters of CSV text on a thread pool
+     */
+    csv_result parse(const char* text, std::size_t size, thread_pool& pool) const {
+        return parse_text(text, size, &pool);
+    }
+};
+
+} // namespace ncast
+
+#endif // NCAST_CSV_H
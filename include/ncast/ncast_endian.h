@@ -0,0 +1,315 @@
+#ifndef NCAST_ENDIAN_H
+#define NCAST_ENDIAN_H
+
+/**
+ * @file ncast_endian.h
+ * @brief Checked conversion of big-endian wire fields
+ *
+ * load_be_cast<To, Wire>(p) reads a big-endian Wire value (network byte
+ * order) from an address with any alignment and converts it to To with the
+ * numeric_cast rules. The bulk variants convert a packed array of wire
+ * values in one pass: each 16-byte load is byte-swapped with SSSE3 pshufb,
+ * range-checked in its wire lanes and, for integral narrowing, shuffled
+ * straight into the target width, so the input is read once with no
+ * memcpy / be64toh / numeric_cast passes in between. Other type pairs swap
+ * a block of 256 values into a stack buffer and validate it with the
+ * try_numeric_cast_n kernels while it is in L1.
+ *
+ * The scalar loads assemble the value from its bytes, which compilers turn
+ * into one load and bswap / movbe, and give the same result on any host
+ * byte order. Floating-point wire types (IEEE 754 double / float sent in
+ * network byte order) are supported as well.
+ *
+ * @code
+ * #include <ncast/ncast_endian.h>
+ *
+ * std::int32_t sequence = ncast::load_be_cast<std::int32_t, std::int64_t>(packet + 8);
+ *
+ * std::vector<std::uint16_t> ports(count);
+ * ncast::bulk_result r = ncast::try_load_be_cast_n<std::uint16_t, std::uint64_t>(payload, count, ports.data());
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ncast {
+
+namespace detail {
+
+    /// Unsigned integer with Size bytes
+    template<std::size_t Size>
+    struct wire_bits;
+
+    template<>
+    struct wire_bits<1> { typedef std::uint8_t type; };
+
+    template<>
+    struct wire_bits<2> { typedef std::uint16_t type; };
+
+    template<>
+    struct wire_bits<4> { typedef std::uint32_t type; };
+
+    template<>
+    struct wire_bits<8> { typedef std::uint64_t type; };
+
+    /// Big-endian bytes as an unsigned word: the first byte is the most significant (compiles to load + bswap)
+    inline std::uint8_t load_be_bits(const unsigned char* p, wire_bits<1>) {
+        return p[0];
+    }
+
+    inline std::uint16_t load_be_bits(const unsigned char* p, wire_bits<2>) {
+        return static_cast<std::uint16_t>(p[0] << 8 | p[1]);
+    }
+
+    inline std::uint32_t load_be_bits(const unsigned char* p, wire_bits<4>) {
+        return static_cast<std::uint32_t>(p[0]) << 24
+             | static_cast<std::uint32_t>(p[1]) << 16
+             | static_cast<std::uint32_t>(p[2]) << 8
+             | static_cast<std::uint32_t>(p[3]);
+    }
+
+    inline std::uint64_t load_be_bits(const unsigned char* p, wire_bits<8>) {
+        return static_cast<std::uint64_t>(p[0]) << 56
+             | static_cast<std::uint64_t>(p[1]) << 48
+             | static_cast<std::uint64_t>(p[2]) << 40
+             | static_cast<std::uint64_t>(p[3]) << 32
+             | static_cast<std::uint64_t>(p[4]) << 24
+             | static_cast<std::uint64_t>(p[5]) << 16
+             | static_cast<std::uint64_t>(p[6]) << 8
+             | static_cast<std::uint64_t>(p[7]);
+    }
+
+    template<typename WireType>
+    WireType load_be_value(const unsigned char* p) {
+        typename wire_bits<sizeof(WireType)>::type bits = load_be_bits(p, wire_bits<sizeof(WireType)>());
+        WireType value;
+        std::memcpy(&value, &bits, sizeof(WireType));
+        return value;
+    }
+
+    /// Elements swapped and validated per step by the generic path
+    const std::size_t wire_block_size = 256;
+
+#if NCAST_HAS_SSSE3
+    /// pshufb mask reversing the bytes of every Size-byte lane
+    inline __m128i wire_swap_mask(std::size_t size) {
+        char mask[16];
+        for (std::size_t k = 0; k < 16; ++k) {
+            mask[k] = static_cast<char>(k - k % size + size - 1 - k % size);
+        }
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+    }
+
+    /// pshufb mask packing the low To bytes of every big-endian Wire lane, in host order, from byte offset on
+    inline __m128i wire_narrow_mask(std::size_t wire_size, std::size_t to_size, std::size_t offset) {
+        char mask[16];
+        for (std::size_t k = 0; k < 16; ++k) {
+            const std::size_t lane = (k - offset) / to_size;
+            mask[k] = k >= offset && lane < 16 / wire_size
+                ? static_cast<char>(lane * wire_size + wire_size - 1 - (k - offset) % to_size)
+                : static_cast<char>(0x80);
+        }
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+    }
+
+    /// Lane-width add and logical shift for the fused range check
+    template<std::size_t Size>
+    struct wire_lanes;
+
+    template<>
+    struct wire_lanes<2> {
+        static __m128i set1(std::uint64_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+        static __m128i add(__m128i a, __m128i b) { return _mm_add_epi16(a, b); }
+        static __m128i shift_right(__m128i a, __m128i count) { return _mm_srl_epi16(a, count); }
+    };
+
+    template<>
+    struct wire_lanes<4> {
+        static __m128i set1(std::uint64_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+        static __m128i add(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+        static __m128i shift_right(__m128i a, __m128i count) { return _mm_srl_epi32(a, count); }
+    };
+
+    template<>
+    struct wire_lanes<8> {
+        static __m128i set1(std::uint64_t v) { return _mm_set1_epi64x(static_cast<long long>(v)); }
+        static __m128i add(__m128i a, __m128i b) { return _mm_add_epi64(a, b); }
+        static __m128i shift_right(__m128i a, __m128i count) { return _mm_srl_epi64(a, count); }
+    };
+#endif // NCAST_HAS_SSSE3
+
+    /**
+     * @brief Swap count big-endian values into host order
+     */
+    template<typename WireType>
+    void load_be_block(const unsigned char* src, std::size_t count, WireType* out) {
+        std::size_t i = 0;
+#if NCAST_HAS_SSSE3
+        if (sizeof(WireType) > 1) {
+            const std::size_t lanes = 16 / sizeof(WireType);
+            const __m128i swap = wire_swap_mask(sizeof(WireType));
+            for (; i + lanes <= count; i += lanes) {
+                __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(WireType)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(raw, swap));
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = load_be_value<WireType>(src + i * sizeof(WireType));
+        }
+    }
+
+    /// Integral narrowing (wider wire type of 2, 4 or 8 bytes) has a fused swap-check-pack kernel
+    template<typename ToType, typename WireType>
+    struct is_fused_wire_narrowing : std::integral_constant<bool,
+        std::is_integral<ToType>::value && std::is_integral<WireType>::value &&
+        !std::is_same<ToType, bool>::value && !std::is_same<WireType, bool>::value &&
+        sizeof(ToType) < sizeof(WireType)> {};
+
+    /**
+     * @brief Convert the leading big-endian values that pass validation, one pass per 16 bytes
+     *
+     * Primary template: no fused kernel, nothing is converted here.
+     */
+    template<typename ToType, typename WireType,
+             bool IsFused = NCAST_HAS_SSSE3 && is_fused_wire_narrowing<ToType, WireType>::value>
+    struct wire_narrow_kernel {
+        static std::size_t convert(const unsigned char*, std::size_t, ToType*) {
+            return 0;
+        }
+    };
+
+#if NCAST_HAS_SSSE3
+    /**
+     * Each 16-byte load is swapped into host-order lanes and checked for all
+     * lanes at once: a value fits a b-bit target when its bits above b are
+     * zero, after adding 2^(b-1) for signed to signed (which maps
+     * [-2^(b-1), 2^(b-1)) onto [0, 2^b)); unsigned to signed keeps b - 1
+     * bits. The loads that fill one 16-byte output (2 for 8 -> 4 bytes, 4
+     * for 8 -> 2, 8 for 8 -> 1) are checked together and shuffled from their
+     * raw bytes into place, so each group costs one test and one store. The
+     * first failing group ends the kernel, and the caller finds the failing
+     * element.
+     */
+    template<typename ToType, typename WireType>
+    struct wire_narrow_kernel<ToType, WireType, true> {
+        static const std::size_t lanes = 16 / sizeof(WireType);                  ///< Values per load
+        static const std::size_t loads = sizeof(WireType) / sizeof(ToType);     ///< Loads per 16-byte output
+
+        static std::size_t convert(const unsigned char* src, std::size_t count, ToType* dst) {
+            typedef wire_lanes<sizeof(WireType)> lanes_ops;
+            const int to_bits = static_cast<int>(8 * sizeof(ToType));
+            const bool sign_extend = std::is_signed<ToType>::value && std::is_signed<WireType>::value;
+            const int kept_bits = std::is_signed<ToType>::value && !std::is_signed<WireType>::value ? to_bits - 1 : to_bits;
+            const __m128i swap = wire_swap_mask(sizeof(WireType));
+            const __m128i bias = lanes_ops::set1(sign_extend ? std::uint64_t(1) << (to_bits - 1) : 0);
+            const __m128i shift = _mm_cvtsi32_si128(kept_bits);
+            const __m128i zero = _mm_setzero_si128();
+            __m128i narrow[loads];
+            for (std::size_t j = 0; j < loads; ++j) {
+                narrow[j] = wire_narrow_mask(sizeof(WireType), sizeof(ToType), j * 16 / loads);
+            }
+
+            std::size_t i = 0;
+            for (; i + loads * lanes <= count; i += loads * lanes) {
+                const unsigned char* p = src + i * sizeof(WireType);
+                __m128i high = zero;
+                __m128i packed = zero;
+                for (std::size_t j = 0; j < loads; ++j) {
+                    __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * j));
+                    high = _mm_or_si128(high, lanes_ops::shift_right(lanes_ops::add(_mm_shuffle_epi8(raw, swap), bias), shift));
+                    packed = _mm_or_si128(packed, _mm_shuffle_epi8(raw, narrow[j]));
+                }
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)) != 0xffff) {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+            }
+            return i;
+        }
+    };
+#endif // NCAST_HAS_SSSE3
+
+} // namespace detail
+
+/**
+ * @brief Load a big-endian value from an address with any alignment
+ *
+ * @tparam WireType Arithmetic type of the field (e.g. std::uint64_t, double)
+ * @param src Address of the first byte of the field
+ * @return The field in host byte order
+ */
+template<typename WireType>
+WireType load_be(const void* src) {
+    static_assert(std::is_arithmetic<WireType>::value, "load_be requires a built-in arithmetic type");
+    return detail::load_be_value<WireType>(static_cast<const unsigned char*>(src));
+}
+
+/**
+ * @brief Load a big-endian value and convert it with numeric_cast validation
+ *
+ * @tparam ToType Target type
+ * @tparam WireType Type of the field on the wire
+ * @param src Address of the first byte of the field (any alignment)
+ * @return The converted value
+ * @throws cast_exception if the value does not fit ToType
+ */
+template<typename ToType, typename WireType>
+ToType load_be_cast(const void* src) {
+    return numeric_cast<ToType>(load_be<WireType>(src));
+}
+
+/**
+ * @brief Convert an array of big-endian values with numeric_cast validation
+ *
+ * Elements before the first failing one are converted; conversion stops
+ * there, as in try_numeric_cast_n().
+ *
+ * @param src Address of the first field; fields are packed, sizeof(WireType) bytes apart (any alignment)
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @return Index and reason of the first failure, or {count, cast_error::none}
+ */
+template<typename ToType, typename WireType>
+bulk_result try_load_be_cast_n(const void* src, std::size_t count, ToType* dst) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<WireType>::value,
+                  "try_load_be_cast_n requires built-in arithmetic types");
+    const unsigned char* in = static_cast<const unsigned char*>(src);
+    const std::size_t fused = detail::wire_narrow_kernel<ToType, WireType>::convert(in, count, dst);
+
+    WireType loaded[detail::wire_block_size];
+    for (std::size_t base = fused; base < count; base += detail::wire_block_size) {
+        std::size_t n = count - base < detail::wire_block_size ? count - base : detail::wire_block_size;
+        detail::load_be_block(in + base * sizeof(WireType), n, loaded);
+        std::size_t valid = detail::convert_checked_block(loaded, n, dst + base);
+        if (valid != n) {
+            bulk_result failure = { base + valid, detail::element_check<ToType, WireType>::error(loaded[valid]) };
+            return failure;
+        }
+    }
+    bulk_result success = { count, cast_error::none };
+    return success;
+}
+
+/**
+ * @brief Convert an array of big-endian values with numeric_cast validation, throwing on failure
+ *
+ * @throws cast_exception if an element does not fit; elements before it are converted
+ */
+template<typename ToType, typename WireType>
+void load_be_cast_n(const void* src, std::size_t count, ToType* dst) {
+    bulk_result result = try_load_be_cast_n<ToType, WireType>(src, count, dst);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+}
+
+} // namespace ncast
+
+#endif // NCAST_ENDIAN_H
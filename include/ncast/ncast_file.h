@@ -0,0 +1,403 @@
+#ifndef NCAST_FILE_H
+#define NCAST_FILE_H
+
+/**
+ * @file ncast_file.h
+ * @brief Streaming checked narrowing of binary column files
+ *
+ * try_numeric_cast_file<To, From>() converts a flat binary file of From
+ * values (a raw int64 or double column, native byte order, no header) into
+ * a file of To values, validating every element with the bulk conversion
+ * rules of ncast_bulk.h: the runtime numeric_cast checks in every language
+ * standard, so fractions truncate toward zero and NaN and infinity pass into
+ * floating-point targets even where C++14+ numeric_cast rejects them. The
+ * input is processed in bounded windows: each window is memory-mapped with
+ * a sequential access hint, the following window is prefetched, and the
+ * window is unmapped as soon as it is converted. The converted window goes
+ * through one reusable buffer to the output file. Memory use is therefore
+ * fixed by the window size (16 MB of input by default), not by the file
+ * size: a 50 GB column converts with the same resident set as a 50 MB one.
+ *
+ * Failure handling mirrors the in-memory bulk conversions:
+ * - try_numeric_cast_file() stops at the first failing element; the output
+ *   holds the elements before it (like try_numeric_cast_n)
+ * - numeric_cast_file() throws cast_exception for the first failing element
+ * - convert_file_with_failures() converts everything, writes a replacement
+ *   for failing elements and calls on_failure(index, error) for every one
+ *   of them in order (like convert_with_validity)
+ *
+ * I/O errors throw std::system_error; an input whose size is not a
+ * multiple of sizeof(From) throws cast_exception with invalid_format.
+ * Without mmap (non-POSIX systems) the windows are read with fread, with
+ * the same bounded memory. Files over 2 GB need 64-bit offsets: POSIX
+ * builds require a 64-bit off_t (-D_FILE_OFFSET_BITS=64 on 32-bit systems),
+ * Windows uses _fseeki64 / _ftelli64.
+ *
+ * @code
+ * #include <ncast/ncast_file.h>
+ *
+ * ncast::file_cast_result r = ncast::try_numeric_cast_file<std::int32_t, std::int64_t>("ids.i64", "ids.i32");
+ * if (!r.ok()) {
+ *     std::cerr << "element " << r.first_index << " does not fit int32\n";
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_validity.h"
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define NCAST_HAS_MMAP 1
+#else
+#define NCAST_HAS_MMAP 0
+#endif
+
+#if NCAST_HAS_MMAP
+static_assert(sizeof(off_t) >= 8, "ncast_file.h requires a 64-bit off_t; build with -D_FILE_OFFSET_BITS=64");
+#endif
+
+namespace ncast {
+
+/**
+ * @brief Outcome of a file conversion
+ */
+struct file_cast_result {
+    std::uint64_t count;            ///< Number of elements in the input file
+    std::uint64_t failures;         ///< Failing elements found (at most 1 when stopping at the first)
+    std::uint64_t first_index;      ///< Index of the first failing element, or count
+    cast_error first_error;         ///< Reason of the first failure, cast_error::none on success
+
+    bool ok() const { return failures == 0; }
+};
+
+namespace detail {
+
+    /// Input bytes per window
+    const std::size_t file_window_bytes = 16 * 1024 * 1024;
+
+    /// Windows are multiples of 64 KB: the largest common page size, and Windows' mapping granularity
+    const std::size_t file_window_alignment = 64 * 1024;
+
+    inline std::size_t aligned_window_bytes(std::size_t window_bytes) {
+        const std::size_t windows = (window_bytes + file_window_alignment - 1) / file_window_alignment;
+        return (windows == 0 ? 1 : windows) * file_window_alignment;
+    }
+
+    inline void throw_file_error(const char* action, const std::string& path) {
+        throw std::system_error(errno, std::generic_category(), std::string("ncast: cannot ") + action + " " + path);
+    }
+
+#if !NCAST_HAS_MMAP
+    /// Size of an open file; long is 32 bits on Windows, so std::ftell would stop at 2 GB
+    inline bool stream_size(std::FILE* file, std::uint64_t& size) {
+#if defined(_WIN32)
+        if (::_fseeki64(file, 0, SEEK_END) != 0) {
+            return false;
+        }
+        const long long end = ::_ftelli64(file);
+#else
+        if (std::fseek(file, 0, SEEK_END) != 0) {
+            return false;
+        }
+        const long end = std::ftell(file);
+#endif
+        if (end < 0) {
+            return false;
+        }
+        size = static_cast<std::uint64_t>(end);
+        std::rewind(file);
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Reads a file as a sequence of windows, holding at most one in memory
+     */
+    class file_window_reader {
+    private:
+        std::string path_;
+        std::uint64_t size_;
+        std::uint64_t offset_;
+        std::size_t window_;
+#if NCAST_HAS_MMAP
+        int fd_;
+        void* mapping_;
+        std::size_t mapped_;
+
+        void unmap() {
+            if (mapping_ != nullptr) {
+                ::munmap(mapping_, mapped_);
+                mapping_ = nullptr;
+            }
+        }
+#else
+        std::FILE* file_;
+        std::vector<char> buffer_;
+#endif
+
+    public:
+        file_window_reader(const std::string& path, std::size_t window_bytes)
+            : path_(path), size_(0), offset_(0), window_(window_bytes) {
+#if NCAST_HAS_MMAP
+            mapping_ = nullptr;
+            mapped_ = 0;
+            fd_ = ::open(path.c_str(), O_RDONLY);
+            struct stat info;
+            if (fd_ < 0 || ::fstat(fd_, &info) != 0) {
+                const int error = errno;
+                if (fd_ >= 0) {
+                    ::close(fd_);
+                }
+                errno = error;
+                throw_file_error("open", path);
+            }
+            size_ = static_cast<std::uint64_t>(info.st_size);
+#else
+            file_ = std::fopen(path.c_str(), "rb");
+            if (file_ == nullptr || !stream_size(file_, size_)) {
+                const int error = errno;
+                if (file_ != nullptr) {
+                    std::fclose(file_);
+                }
+                errno = error;
+                throw_file_error("open", path);
+            }
+#endif
+        }
+
+        file_window_reader(const file_window_reader&) = delete;
+        file_window_reader& operator=(const file_window_reader&) = delete;
+
+        ~file_window_reader() {
+#if NCAST_HAS_MMAP
+            unmap();
+            ::close(fd_);
+#else
+            std::fclose(file_);
+#endif
+        }
+
+        /// File size in bytes
+        std::uint64_t size() const { return size_; }
+
+        /**
+         * @brief Make the next window available, releasing the previous one
+         * @return false at the end of the file
+         */
+        bool next(const char*& data, std::size_t& bytes) {
+            if (offset_ == size_) {
+#if NCAST_HAS_MMAP
+                unmap();
+#endif
+                return false;
+            }
+            const std::uint64_t remaining = size_ - offset_;
+            bytes = remaining < window_ ? static_cast<std::size_t>(remaining) : window_;
+#if NCAST_HAS_MMAP
+            unmap();
+            mapping_ = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd_, static_cast<off_t>(offset_));
+            if (mapping_ == MAP_FAILED) {
+                mapping_ = nullptr;
+                throw_file_error("map", path_);
+            }
+            mapped_ = bytes;
+            ::madvise(mapping_, bytes, MADV_SEQUENTIAL);
+#if defined(POSIX_FADV_WILLNEED)
+            // Start reading the next window while this one is converted
+            if (remaining > bytes) {
+                const std::uint64_t following = remaining - bytes;
+                ::posix_fadvise(fd_, static_cast<off_t>(offset_ + bytes),
+                                static_cast<off_t>(following < window_ ? following : window_), POSIX_FADV_WILLNEED);
+            }
+#endif
+            data = static_cast<const char*>(mapping_);
+#else
+            buffer_.resize(window_);
+            if (std::fread(buffer_.data(), 1, bytes, file_) != bytes) {
+                throw_file_error("read", path_);
+            }
+            data = buffer_.data();
+#endif
+            offset_ += bytes;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Sequential binary output file; close() reports write errors
+     */
+    class file_writer {
+    private:
+        std::string path_;
+        std::FILE* file_;
+
+    public:
+        explicit file_writer(const std::string& path) : path_(path), file_(std::fopen(path.c_str(), "wb")) {
+            if (file_ == nullptr) {
+                throw_file_error("create", path);
+            }
+        }
+
+        file_writer(const file_writer&) = delete;
+        file_writer& operator=(const file_writer&) = delete;
+
+        ~file_writer() {
+            if (file_ != nullptr) {
+                std::fclose(file_);
+            }
+        }
+
+        void write(const void* data, std::size_t bytes) {
+            if (bytes != 0 && std::fwrite(data, 1, bytes, file_) != bytes) {
+                throw_file_error("write", path_);
+            }
+        }
+
+        void close() {
+            std::FILE* file = file_;
+            file_ = nullptr;
+            if (std::fclose(file) != 0) {
+                throw_file_error("write", path_);
+            }
+        }
+    };
+
+    /// Open the input, check that it holds whole FromType elements and prepare the result
+    template<typename FromType>
+    file_cast_result start_file_cast(const file_window_reader& reader, const std::string& input) {
+        if (reader.size() % sizeof(FromType) != 0) {
+            std::ostringstream ss;
+            ss << "File cast failed: size of " << input << " (" << reader.size()
+               << " bytes) is not a multiple of the element size (" << sizeof(FromType) << " bytes)";
+            throw cast_exception(ss.str(), cast_error::invalid_format);
+        }
+        const std::uint64_t count = reader.size() / sizeof(FromType);
+        file_cast_result result = { count, 0, count, cast_error::none };
+        return result;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert a binary file of FromType into a file of ToType, stopping at the first failure
+ *
+ * @param input Path of the source column (native byte order)
+ * @param output Path of the converted column, created or truncated; on
+ *        failure it holds the elements before the failing one
+ * @param window_bytes Input bytes held in memory at a time (rounded up to a multiple of 64 KB)
+ * @return Element count and the first failure, if any
+ * @throws std::system_error on I/O errors, cast_exception if the input size is not a multiple of sizeof(FromType)
+ */
+template<typename ToType, typename FromType>
+file_cast_result try_numeric_cast_file(const std::string& input, const std::string& output,
+                                       std::size_t window_bytes = detail::file_window_bytes) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "try_numeric_cast_file requires built-in arithmetic types");
+    const std::size_t window = detail::aligned_window_bytes(window_bytes);
+    detail::file_window_reader reader(input, window);
+    file_cast_result result = detail::start_file_cast<FromType>(reader, input);
+    detail::file_writer writer(output);
+    std::vector<ToType> converted(window / sizeof(FromType));
+
+    std::uint64_t base = 0;
+    const char* data;
+    std::size_t bytes;
+    while (reader.next(data, bytes)) {
+        const std::size_t n = bytes / sizeof(FromType);
+        bulk_result r = try_numeric_cast_n(reinterpret_cast<const FromType*>(data), n, converted.data());
+        writer.write(converted.data(), r.index * sizeof(ToType));
+        if (!r.ok()) {
+            result.failures = 1;
+            result.first_index = base + r.index;
+            result.first_error = r.error;
+            break;
+        }
+        base += n;
+    }
+    writer.close();
+    return result;
+}
+
+/**
+ * @brief Convert a binary file of FromType into a file of ToType; throws on the first failure
+ *
+ * @throws cast_exception with the index and error of the first failing element
+ */
+template<typename ToType, typename FromType>
+void numeric_cast_file(const std::string& input, const std::string& output,
+                       std::size_t window_bytes = detail::file_window_bytes) {
+    file_cast_result result = try_numeric_cast_file<ToType, FromType>(input, output, window_bytes);
+    if (!result.ok()) {
+        std::ostringstream ss;
+        ss << "File cast failed at element " << result.first_index << ": "
+           << detail::cast_error_message(result.first_error);
+        throw cast_exception(ss.str(), result.first_error);
+    }
+}
+
+/**
+ * @brief Convert a whole binary file, replacing failing elements and reporting each of them
+ *
+ * @param on_failure Called as on_failure(std::uint64_t index, cast_error error)
+ *        for every failing element, in index order
+ * @param replacement Value written for failing elements
+ * @return Element count, number of failures and the first failure
+ * @throws std::system_error on I/O errors, cast_exception if the input size is not a multiple of sizeof(FromType)
+ */
+template<typename ToType, typename FromType, typename OnFailure>
+file_cast_result convert_file_with_failures(const std::string& input, const std::string& output, OnFailure on_failure,
+                                            typename detail::non_deduced<ToType>::type replacement = ToType(),
+                                            std::size_t window_bytes = detail::file_window_bytes) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "convert_file_with_failures requires built-in arithmetic types");
+    const std::size_t window = detail::aligned_window_bytes(window_bytes);
+    detail::file_window_reader reader(input, window);
+    file_cast_result result = detail::start_file_cast<FromType>(reader, input);
+    detail::file_writer writer(output);
+    std::vector<ToType> converted(window / sizeof(FromType));
+    std::vector<std::uint8_t> validity(validity_bitmap_bytes(converted.size()));
+
+    std::uint64_t base = 0;
+    const char* data;
+    std::size_t bytes;
+    while (reader.next(data, bytes)) {
+        const FromType* src = reinterpret_cast<const FromType*>(data);
+        const std::size_t n = bytes / sizeof(FromType);
+        if (convert_with_validity(src, n, converted.data(), validity.data(), replacement) != 0) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (validity[i / 8] == 0xFF) {
+                    i |= 7;     // whole byte valid: skip to its last element
+                } else if (!is_valid(validity.data(), i)) {
+                    const cast_error error = detail::element_check<ToType, FromType>::error(src[i]);
+                    if (result.failures++ == 0) {
+                        result.first_index = base + i;
+                        result.first_error = error;
+                    }
+                    on_failure(base + i, error);
+                }
+            }
+        }
+        writer.write(converted.data(), n * sizeof(ToType));
+        base += n;
+    }
+    writer.close();
+    return result;
+}
+
+} // namespace ncast
+
+#endif // NCAST_FILE_H
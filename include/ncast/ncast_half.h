@@ -0,0 +1,487 @@
+#ifndef NCAST_HALF_H
+#define NCAST_HALF_H
+
+/**
+ * @file ncast_half.h
+ * @brief IEEE 754 binary16 (half precision) support for ncast
+ *
+ * Adds the ncast::half storage type and makes it a valid source and target of
+ * numeric_cast / NUMERIC_CAST. Where the compiler provides _Float16 (and thus
+ * std::float16_t in C++23), that type is accepted by numeric_cast as well.
+ *
+ * Validation follows the floating-point rules of numeric_cast:
+ * - float/double/integer -> half: values beyond half's finite range throw
+ *   instead of silently becoming infinity; NaN and infinity pass through;
+ *   precision loss (rounding to nearest-even) is allowed
+ * - half -> integer: NaN, infinity and out-of-range values throw
+ * - half -> float/double: always succeeds
+ *
+ * Bulk conversion (float_to_half_n, half_to_float_n) uses F16C instructions
+ * when the translation unit is compiled with them, and a table-based scalar
+ * conversion otherwise. Bulk conversion follows IEEE semantics (overflow
+ * rounds to infinity) and performs no validation.
+ *
+ * @code
+ * #include <ncast/ncast_half.h>
+ *
+ * ncast::half h = ncast::numeric_cast<ncast::half>(3.5f);   // OK
+ * float f = ncast::numeric_cast<float>(h);                 // OK, exact
+ * ncast::numeric_cast<ncast::half>(70000.0f);              // Throws: exceeds 65504
+ *
+ * std::vector<float> in(1024);
+ * std::vector<ncast::half> out(in.size());
+ * ncast::float_to_half_n(in.data(), in.size(), out.data());
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+// _Float16 detection (GCC 12+, Clang 15+ on x86-64 and AArch64)
+#if defined(__FLT16_MAX__) && !defined(NCAST_DISABLE_FLOAT16)
+#define NCAST_HAS_FLOAT16 1
+#else
+#define NCAST_HAS_FLOAT16 0
+#endif
+
+namespace ncast {
+
+namespace detail {
+
+    /**
+     * @brief Lookup tables for scalar float <-> half conversion
+     *
+     * float -> half is indexed by the float sign and exponent (9 bits) and
+     * yields the half base pattern, the mantissa shift and the implicit bit
+     * needed for half subnormals. Rounding to nearest-even is applied on the
+     * shifted-out bits.
+     *
+     * half -> float uses the mantissa/exponent/offset tables described in
+     * "Fast Half Float Conversions" (J. van der Zijp).
+     */
+    struct half_tables {
+        std::uint16_t base[512];
+        std::uint8_t shift[512];
+        std::uint32_t implicit_bit[512];
+
+        std::uint32_t mantissa[2048];
+        std::uint32_t exponent[64];
+        std::uint16_t offset[64];
+
+        half_tables() {
+            for (unsigned i = 0; i < 256; ++i) {
+                int e = static_cast<int>(i) - 127;
+                std::uint16_t b;
+                std::uint8_t s;
+                std::uint32_t imp = 0;
+                if (e > 15) {                 // overflow, infinity and NaN
+                    b = 0x7c00;
+                    s = 24;
+                } else if (e >= -14) {        // normal half
+                    b = static_cast<std::uint16_t>((e + 15) << 10);
+                    s = 13;
+                } else if (e >= -25) {        // subnormal half
+                    b = 0;
+                    s = static_cast<std::uint8_t>(13 + (-14 - e));
+                    imp = 0x00800000u;
+                } else {                      // underflow to zero
+                    b = 0;
+                    s = 24;
+                }
+                base[i] = b;
+                base[i | 0x100] = static_cast<std::uint16_t>(b | 0x8000);
+                shift[i] = shift[i | 0x100] = s;
+                implicit_bit[i] = implicit_bit[i | 0x100] = imp;
+            }
+
+            mantissa[0] = 0;
+            for (std::uint32_t i = 1; i < 1024; ++i) {
+                std::uint32_t m = i << 13;
+                std::uint32_t e = 0;
+                while (!(m & 0x00800000u)) {
+                    e -= 0x00800000u;
+                    m <<= 1;
+                }
+                m &= ~0x00800000u;
+                e += 0x38800000u;
+                mantissa[i] = m | e;
+            }
+            for (std::uint32_t i = 1024; i < 2048; ++i) {
+                mantissa[i] = 0x38000000u + ((i - 1024) << 13);
+            }
+
+            exponent[0] = 0;
+            for (std::uint32_t i = 1; i < 31; ++i) {
+                exponent[i] = i << 23;
+            }
+            exponent[31] = 0x47800000u;
+            exponent[32] = 0x80000000u;
+            for (std::uint32_t i = 33; i < 63; ++i) {
+                exponent[i] = 0x80000000u + ((i - 32) << 23);
+            }
+            exponent[63] = 0xc7800000u;
+
+            for (unsigned i = 0; i < 64; ++i) {
+                offset[i] = 1024;
+            }
+            offset[0] = 0;
+            offset[32] = 0;
+        }
+
+        static const half_tables& instance() {
+            static const half_tables tables;
+            return tables;
+        }
+    };
+
+    /**
+     * @brief Table-based float -> half with round-to-nearest-even
+     */
+    inline std::uint16_t float_to_half_bits_table(float value, const half_tables& t) {
+        std::uint32_t f = float_to_bits(value);
+        if ((f & 0x7fffffffu) > 0x7f800000u) {
+            // NaN: keep sign and upper payload, force quiet bit
+            return static_cast<std::uint16_t>(((f >> 16) & 0x8000u) | 0x7e00u | ((f >> 13) & 0x3ffu));
+        }
+        std::uint32_t index = f >> 23;
+        std::uint32_t s = t.shift[index];
+        std::uint32_t m = (f & 0x007fffffu) | t.implicit_bit[index];
+        std::uint32_t h = t.base[index] + (m >> s);
+        std::uint32_t rem = m & ((1u << s) - 1u);
+        std::uint32_t halfway = 1u << (s - 1u);
+        h += static_cast<std::uint32_t>((rem > halfway) | ((rem == halfway) & (h & 1u)));
+        return static_cast<std::uint16_t>(h);
+    }
+
+    /**
+     * @brief Table-based half -> float (always exact)
+     */
+    inline float half_bits_to_float_table(std::uint16_t h, const half_tables& t) {
+        unsigned e = static_cast<unsigned>(h >> 10);
+        return bits_to_float(t.mantissa[t.offset[e] + (h & 0x3ffu)] + t.exponent[e]);
+    }
+
+    inline std::uint16_t float_to_half_bits(float value) {
+#if NCAST_HAS_F16C
+        return static_cast<std::uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+        return float_to_half_bits_table(value, half_tables::instance());
+#endif
+    }
+
+    inline float half_bits_to_float(std::uint16_t h) {
+#if NCAST_HAS_F16C
+        return _cvtsh_ss(h);
+#else
+        return half_bits_to_float_table(h, half_tables::instance());
+#endif
+    }
+
+    /**
+     * @brief Direct double -> half with round-to-nearest-even
+     *
+     * Rounds once from double, avoiding the double rounding of double -> float -> half.
+     */
+    inline std::uint16_t double_to_half_bits(double value) {
+        std::uint64_t d = double_to_bits(value);
+        std::uint32_t sign = static_cast<std::uint32_t>((d >> 48) & 0x8000u);
+        int e = static_cast<int>((d >> 52) & 0x7ffu);
+        std::uint64_t m = d & 0x000fffffffffffffull;
+
+        if (e == 0x7ff) {
+            if (m != 0) {
+                return static_cast<std::uint16_t>(sign | 0x7e00u | static_cast<std::uint32_t>((m >> 42) & 0x3ffu));
+            }
+            return static_cast<std::uint16_t>(sign | 0x7c00u);
+        }
+
+        e -= 1023;
+        if (e > 15) {
+            return static_cast<std::uint16_t>(sign | 0x7c00u);
+        }
+
+        std::uint32_t h;
+        unsigned s;
+        if (e >= -14) {
+            h = static_cast<std::uint32_t>((e + 15) << 10);
+            s = 42;
+        } else if (e >= -25) {
+            h = 0;
+            s = static_cast<unsigned>(42 + (-14 - e));
+            m |= 0x0010000000000000ull;
+        } else {
+            return static_cast<std::uint16_t>(sign);
+        }
+
+        h += static_cast<std::uint32_t>(m >> s);
+        std::uint64_t rem = m & ((1ull << s) - 1u);
+        std::uint64_t halfway = 1ull << (s - 1u);
+        h += static_cast<std::uint32_t>((rem > halfway) | ((rem == halfway) & ((h & 1u) != 0)));
+        return static_cast<std::uint16_t>(sign | h);
+    }
+
+    inline std::uint16_t to_half_bits(float value) { return float_to_half_bits(value); }
+    inline std::uint16_t to_half_bits(double value) { return double_to_half_bits(value); }
+    inline std::uint16_t to_half_bits(long double value) { return double_to_half_bits(static_cast<double>(value)); }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value, std::uint16_t>::type to_half_bits(T value) {
+        // Every integer beyond 2^53 is far outside half's range, so rounding to double first is exact enough
+        return double_to_half_bits(static_cast<double>(value));
+    }
+
+} // namespace detail
+
+/**
+ * @brief IEEE 754 binary16 storage type
+ *
+ * A trivially copyable 16-bit value. Arithmetic is intentionally not
+ * provided: convert to float for computation. All conversions round to
+ * nearest-even; overflow produces infinity, so use numeric_cast<half> to
+ * reject out-of-range values.
+ */
+class half {
+public:
+    constexpr half() noexcept : bits_(0) {}
+
+    explicit half(float value) noexcept : bits_(detail::to_half_bits(value)) {}
+    explicit half(double value) noexcept : bits_(detail::to_half_bits(value)) {}
+    explicit half(long double value) noexcept : bits_(detail::to_half_bits(value)) {}
+
+    template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    explicit half(T value) noexcept : bits_(detail::to_half_bits(value)) {}
+
+#if NCAST_HAS_FLOAT16
+    explicit half(_Float16 value) noexcept : bits_(0) {
+        std::memcpy(&bits_, &value, sizeof(bits_));
+    }
+
+    explicit operator _Float16() const noexcept {
+        _Float16 value;
+        std::memcpy(&value, &bits_, sizeof(value));
+        return value;
+    }
+#endif
+
+    /**
+     * @brief Construct from a raw binary16 bit pattern
+     */
+    static constexpr half from_bits(std::uint16_t bits) noexcept {
+        return half(bits, bits_tag());
+    }
+
+    /**
+     * @brief Raw binary16 bit pattern
+     */
+    constexpr std::uint16_t bits() const noexcept { return bits_; }
+
+    template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    explicit operator T() const noexcept {
+        return static_cast<T>(detail::half_bits_to_float(bits_));
+    }
+
+    friend bool operator==(half a, half b) noexcept { return static_cast<float>(a) == static_cast<float>(b); }
+    friend bool operator!=(half a, half b) noexcept { return static_cast<float>(a) != static_cast<float>(b); }
+    friend bool operator<(half a, half b) noexcept { return static_cast<float>(a) < static_cast<float>(b); }
+    friend bool operator>(half a, half b) noexcept { return static_cast<float>(a) > static_cast<float>(b); }
+    friend bool operator<=(half a, half b) noexcept { return static_cast<float>(a) <= static_cast<float>(b); }
+    friend bool operator>=(half a, half b) noexcept { return static_cast<float>(a) >= static_cast<float>(b); }
+
+    friend std::ostream& operator<<(std::ostream& os, half value) {
+        return os << static_cast<float>(value);
+    }
+
+private:
+    struct bits_tag {};
+    constexpr half(std::uint16_t bits, bits_tag) noexcept : bits_(bits) {}
+
+    std::uint16_t bits_;
+};
+
+static_assert(sizeof(half) == 2, "ncast::half must be 16 bits wide");
+static_assert(std::is_trivially_copyable<half>::value, "ncast::half must be trivially copyable");
+
+/**
+ * @brief Convert a float array to half precision (IEEE rounding, no validation)
+ *
+ * Values beyond half's finite range become infinity. Uses F16C when available.
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ */
+inline void float_to_half_n(const float* src, std::size_t count, half* dst) {
+    std::size_t i = 0;
+#if NCAST_HAS_F16C
+    for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+#endif
+    const detail::half_tables& tables = detail::half_tables::instance();
+    for (; i < count; ++i) {
+        dst[i] = half::from_bits(detail::float_to_half_bits_table(src[i], tables));
+    }
+}
+
+/**
+ * @brief Convert a half array to float (always exact)
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ */
+inline void half_to_float_n(const half* src, std::size_t count, float* dst) {
+    std::size_t i = 0;
+#if NCAST_HAS_F16C
+    for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    const detail::half_tables& tables = detail::half_tables::instance();
+    for (; i < count; ++i) {
+        dst[i] = detail::half_bits_to_float_table(src[i].bits(), tables);
+    }
+}
+
+namespace detail {
+
+    template<>
+    struct is_numeric_or_char<half> {
+        static const bool value = true;
+    };
+
+    template<>
+    struct is_float_type<half> {
+        static const bool value = true;
+    };
+
+    // half source: widen to float (exact) and apply the float rules
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, half, true, true> {
+        static ToType validate(half value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, half, true, false> {
+        static ToType validate(half value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+#if NCAST_HAS_FLOAT16
+    template<>
+    struct is_numeric_or_char<_Float16> {
+        static const bool value = true;
+    };
+
+    template<>
+    struct is_float_type<_Float16> {
+        static const bool value = true;
+    };
+
+    // _Float16 source: widen to float (exact) and apply the float rules
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, _Float16, true, true> {
+        static ToType validate(_Float16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+    template<typename ToType>
+    struct numeric_cast_validator<ToType, _Float16, true, false> {
+        static ToType validate(_Float16 value, const char* file, int line, const char* function) {
+            return numeric_cast_validator<ToType, float>::validate(static_cast<float>(value), file, line, function);
+        }
+    };
+
+    // _Float16 target: validate as half, then reinterpret (identical encoding)
+    template<typename FromType>
+    struct numeric_cast_validator<_Float16, FromType, true, true> {
+        static _Float16 validate(FromType value, const char* file, int line, const char* function) {
+            return static_cast<_Float16>(numeric_cast_validator<half, FromType>::validate(value, file, line, function));
+        }
+    };
+
+    template<typename FromType>
+    struct numeric_cast_validator<_Float16, FromType, false, true> {
+        static _Float16 validate(FromType value, const char* file, int line, const char* function) {
+            return static_cast<_Float16>(numeric_cast_validator<half, FromType>::validate(value, file, line, function));
+        }
+    };
+
+    template<>
+    struct numeric_cast_validator<_Float16, _Float16, true, true> {
+        static _Float16 validate(_Float16 value, const char*, int, const char*) {
+            return value;
+        }
+    };
+
+    template<>
+    struct numeric_cast_validator<_Float16, half, true, true> {
+        static _Float16 validate(half value, const char*, int, const char*) {
+            return static_cast<_Float16>(value);
+        }
+    };
+#endif // NCAST_HAS_FLOAT16
+
+} // namespace detail
+
+} // namespace ncast
+
+namespace std {
+
+/**
+ * @brief numeric_limits for ncast::half (IEEE 754 binary16)
+ */
+template<>
+class numeric_limits<ncast::half> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr bool is_iec559 = true;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int min_exponent10 = -4;
+    static constexpr int max_exponent = 16;
+    static constexpr int max_exponent10 = 4;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr ncast::half min() noexcept { return ncast::half::from_bits(0x0400); }
+    static constexpr ncast::half lowest() noexcept { return ncast::half::from_bits(0xfbff); }
+    static constexpr ncast::half max() noexcept { return ncast::half::from_bits(0x7bff); }
+    static constexpr ncast::half epsilon() noexcept { return ncast::half::from_bits(0x1400); }
+    static constexpr ncast::half round_error() noexcept { return ncast::half::from_bits(0x3800); }
+    static constexpr ncast::half infinity() noexcept { return ncast::half::from_bits(0x7c00); }
+    static constexpr ncast::half quiet_NaN() noexcept { return ncast::half::from_bits(0x7e00); }
+    static constexpr ncast::half signaling_NaN() noexcept { return ncast::half::from_bits(0x7d00); }
+    static constexpr ncast::half denorm_min() noexcept { return ncast::half::from_bits(0x0001); }
+};
+
+} // namespace std
+
+#endif // NCAST_HALF_H
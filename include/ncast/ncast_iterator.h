@@ -0,0 +1,298 @@
+#ifndef NCAST_ITERATOR_H
+#define NCAST_ITERATOR_H
+
+/**
+ * @file ncast_iterator.h
+ * @brief Lazy checked conversion: iterator adaptor and C++20 range adaptor
+ *
+ * checked_cast_iterator<To, It> wraps an iterator over arithmetic values and
+ * converts each element on dereference, so algorithms read converted values
+ * without a converted copy of the data. The error policy is chosen at compile
+ * time:
+ * - throw_policy (default)   numeric_cast; a failing element throws cast_exception
+ * - replace_policy<...>      the element is replaced per error kind (see ncast_policy.h);
+ *                            replace_policy<> saturates like saturate_cast
+ *
+ * Values are computed, not stored: dereference returns a prvalue, which the
+ * C++98 forward iterator requirements do not allow, so iterator_category is
+ * input_iterator_tag (like std::views::transform). The operations of the
+ * wrapped iterator (+=, [], -, ordering) are still provided, and with C++20
+ * iterator_concept keeps its category up to random access, so std::ranges
+ * algorithms step in O(1). A contiguous iterator becomes random_access.
+ *
+ * A replace_policy<...> is evaluated into its replacement values once, when
+ * the iterator is constructed, not on every dereference.
+ *
+ * With C++20, ncast::views::cast<To> (or views::cast<To, Policy>) adapts a
+ * range, keeping its sized / common / borrowed properties.
+ *
+ * @code
+ * #include <ncast/ncast_iterator.h>
+ *
+ * long long total = std::accumulate(ncast::make_checked_cast_iterator<std::int32_t>(v.begin()),
+ *                                   ncast::make_checked_cast_iterator<std::int32_t>(v.end()), 0LL);
+ *
+ * // C++20
+ * for (std::uint8_t level : samples | ncast::views::cast<std::uint8_t, ncast::replace_policy<> >) { ... }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_policy.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if NCAST_HAS_CPP20
+#include <ranges>
+#endif
+
+namespace ncast {
+
+/**
+ * @brief Error policy of the lazy conversions: throw cast_exception like numeric_cast
+ */
+struct throw_policy {};
+
+namespace detail {
+
+    /**
+     * @brief Conversion of one element under an error policy; replace_policy<...> types replace
+     *
+     * Holds the replacement values of the policy, evaluated once on construction.
+     */
+    template<typename ErrorPolicy, typename ToType, typename FromType>
+    class element_cast {
+    private:
+        replacement_values<ToType> values_;
+
+    public:
+        element_cast() : values_(make_replacement_values<ErrorPolicy, ToType, FromType>()) {}
+
+        ToType cast(FromType value) const {
+            return replace_value(value, values_);
+        }
+    };
+
+    template<typename ToType, typename FromType>
+    class element_cast<throw_policy, ToType, FromType> {
+    public:
+        ToType cast(FromType value) const {
+            return numeric_cast<ToType>(value);
+        }
+    };
+
+    template<typename Iterator>
+    struct source_iterator_types {
+#if NCAST_HAS_CPP20
+        typedef std::iter_value_t<Iterator> value_type;
+        typedef std::iter_difference_t<Iterator> difference_type;
+#else
+        typedef typename std::iterator_traits<Iterator>::value_type value_type;
+        typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+#endif
+    };
+
+#if NCAST_HAS_CPP20
+    /// C++20 concept of the wrapped iterator, capped at random access
+    template<typename Iterator>
+    using cast_iterator_concept = typename std::conditional<std::random_access_iterator<Iterator>,
+        std::random_access_iterator_tag,
+        typename std::conditional<std::bidirectional_iterator<Iterator>, std::bidirectional_iterator_tag,
+            typename std::conditional<std::forward_iterator<Iterator>, std::forward_iterator_tag,
+                std::input_iterator_tag>::type>::type>::type;
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Iterator adaptor converting each element to ToType on dereference
+ *
+ * @tparam ToType Target arithmetic type
+ * @tparam Iterator Wrapped iterator over arithmetic values
+ * @tparam ErrorPolicy throw_policy or a replace_policy<...>
+ *
+ * operator* and operator[] return ToType by value. Operations the wrapped
+ * iterator does not support (e.g. -- on a forward iterator) are only
+ * rejected when used.
+ */
+template<typename ToType, typename Iterator, typename ErrorPolicy = throw_policy>
+class checked_cast_iterator
+    : private detail::element_cast<ErrorPolicy, ToType,
+                                   typename detail::source_iterator_types<Iterator>::value_type> {
+private:
+    typedef typename detail::source_iterator_types<Iterator>::value_type source_type;
+    typedef detail::element_cast<ErrorPolicy, ToType, source_type> converter;
+    Iterator it_;
+
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<source_type>::value,
+                  "checked_cast_iterator requires built-in arithmetic types");
+
+public:
+    typedef std::input_iterator_tag iterator_category;
+#if NCAST_HAS_CPP20
+    typedef detail::cast_iterator_concept<Iterator> iterator_concept;
+#endif
+    typedef ToType value_type;
+    typedef typename detail::source_iterator_types<Iterator>::difference_type difference_type;
+    typedef void pointer;
+    typedef ToType reference;
+
+    checked_cast_iterator() : it_() {}
+    explicit checked_cast_iterator(Iterator it) : it_(std::move(it)) {}
+
+    /// Wrapped iterator
+    const Iterator& base() const { return it_; }
+
+    ToType operator*() const {
+        return converter::cast(static_cast<source_type>(*it_));
+    }
+
+    ToType operator[](difference_type n) const {
+        return converter::cast(static_cast<source_type>(it_[n]));
+    }
+
+    checked_cast_iterator& operator++() { ++it_; return *this; }
+    checked_cast_iterator operator++(int) { checked_cast_iterator old(*this); ++it_; return old; }
+    checked_cast_iterator& operator--() { --it_; return *this; }
+    checked_cast_iterator operator--(int) { checked_cast_iterator old(*this); --it_; return old; }
+
+    checked_cast_iterator& operator+=(difference_type n) { it_ += n; return *this; }
+    checked_cast_iterator& operator-=(difference_type n) { it_ -= n; return *this; }
+
+    friend checked_cast_iterator operator+(checked_cast_iterator i, difference_type n) { return i += n; }
+    friend checked_cast_iterator operator+(difference_type n, checked_cast_iterator i) { return i += n; }
+    friend checked_cast_iterator operator-(checked_cast_iterator i, difference_type n) { return i -= n; }
+    friend difference_type operator-(const checked_cast_iterator& a, const checked_cast_iterator& b) {
+        return a.it_ - b.it_;
+    }
+
+    friend bool operator==(const checked_cast_iterator& a, const checked_cast_iterator& b) { return a.it_ == b.it_; }
+    friend bool operator!=(const checked_cast_iterator& a, const checked_cast_iterator& b) { return !(a.it_ == b.it_); }
+    friend bool operator<(const checked_cast_iterator& a, const checked_cast_iterator& b) { return a.it_ < b.it_; }
+    friend bool operator>(const checked_cast_iterator& a, const checked_cast_iterator& b) { return b.it_ < a.it_; }
+    friend bool operator<=(const checked_cast_iterator& a, const checked_cast_iterator& b) { return !(b.it_ < a.it_); }
+    friend bool operator>=(const checked_cast_iterator& a, const checked_cast_iterator& b) { return !(a.it_ < b.it_); }
+};
+
+/**
+ * @brief Wrap an iterator: make_checked_cast_iterator<To>(it) or <To, Policy>(it)
+ */
+template<typename ToType, typename ErrorPolicy = throw_policy, typename Iterator>
+checked_cast_iterator<ToType, Iterator, ErrorPolicy> make_checked_cast_iterator(Iterator it) {
+    return checked_cast_iterator<ToType, Iterator, ErrorPolicy>(std::move(it));
+}
+
+#if NCAST_HAS_CPP20
+
+/**
+ * @brief Sentinel of cast_view over a range whose end is not an iterator
+ */
+template<typename Sentinel>
+class cast_sentinel {
+private:
+    Sentinel end_;
+
+public:
+    cast_sentinel() = default;
+    explicit cast_sentinel(Sentinel end) : end_(std::move(end)) {}
+
+    const Sentinel& base() const { return end_; }
+
+    template<typename ToType, typename Iterator, typename ErrorPolicy>
+    friend bool operator==(const checked_cast_iterator<ToType, Iterator, ErrorPolicy>& i, const cast_sentinel& s) {
+        return i.base() == s.end_;
+    }
+
+    template<typename ToType, typename Iterator, typename ErrorPolicy>
+        requires std::sized_sentinel_for<Sentinel, Iterator>
+    friend std::iter_difference_t<Iterator> operator-(const cast_sentinel& s,
+                                                      const checked_cast_iterator<ToType, Iterator, ErrorPolicy>& i) {
+        return s.end_ - i.base();
+    }
+
+    template<typename ToType, typename Iterator, typename ErrorPolicy>
+        requires std::sized_sentinel_for<Sentinel, Iterator>
+    friend std::iter_difference_t<Iterator> operator-(const checked_cast_iterator<ToType, Iterator, ErrorPolicy>& i,
+                                                      const cast_sentinel& s) {
+        return i.base() - s.end_;
+    }
+};
+
+/**
+ * @brief View of a range converted element-wise to ToType on access (C++20)
+ */
+template<std::ranges::input_range View, typename ToType, typename ErrorPolicy = throw_policy>
+    requires std::ranges::view<View>
+class cast_view : public std::ranges::view_interface<cast_view<View, ToType, ErrorPolicy> > {
+private:
+    View base_;
+
+    template<typename Iterator>
+    using iterator_for = checked_cast_iterator<ToType, Iterator, ErrorPolicy>;
+
+    template<typename Range>
+    static auto end_of(Range& range) {
+        if constexpr (std::ranges::common_range<Range>) {
+            return iterator_for<std::ranges::iterator_t<Range> >(std::ranges::end(range));
+        } else {
+            return cast_sentinel<std::ranges::sentinel_t<Range> >(std::ranges::end(range));
+        }
+    }
+
+public:
+    cast_view() requires std::default_initializable<View> = default;
+    explicit cast_view(View base) : base_(std::move(base)) {}
+
+    View base() const& requires std::copy_constructible<View> { return base_; }
+    View base() && { return std::move(base_); }
+
+    auto begin() { return iterator_for<std::ranges::iterator_t<View> >(std::ranges::begin(base_)); }
+    auto begin() const requires std::ranges::range<const View> {
+        return iterator_for<std::ranges::iterator_t<const View> >(std::ranges::begin(base_));
+    }
+
+    auto end() { return end_of(base_); }
+    auto end() const requires std::ranges::range<const View> { return end_of(base_); }
+
+    auto size() requires std::ranges::sized_range<View> { return std::ranges::size(base_); }
+    auto size() const requires std::ranges::sized_range<const View> { return std::ranges::size(base_); }
+};
+
+namespace views {
+
+    /// Range adaptor object behind views::cast
+    template<typename ToType, typename ErrorPolicy>
+    struct cast_adaptor {
+        template<std::ranges::viewable_range Range>
+        auto operator()(Range&& range) const {
+            return cast_view<std::views::all_t<Range>, ToType, ErrorPolicy>(std::views::all(std::forward<Range>(range)));
+        }
+
+        template<std::ranges::viewable_range Range>
+        friend auto operator|(Range&& range, const cast_adaptor& adaptor) {
+            return adaptor(std::forward<Range>(range));
+        }
+    };
+
+    /**
+     * @brief Range adaptor: range | views::cast<To> or views::cast<To, Policy>(range)
+     */
+    template<typename ToType, typename ErrorPolicy = throw_policy>
+    inline constexpr cast_adaptor<ToType, ErrorPolicy> cast{};
+
+} // namespace views
+
+#endif // NCAST_HAS_CPP20
+
+} // namespace ncast
+
+#if NCAST_HAS_CPP20
+namespace std::ranges {
+    template<typename View, typename ToType, typename ErrorPolicy>
+    inline constexpr bool enable_borrowed_range<ncast::cast_view<View, ToType, ErrorPolicy> > = enable_borrowed_range<View>;
+}
+#endif
+
+#endif // NCAST_ITERATOR_H
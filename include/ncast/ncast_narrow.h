@@ -0,0 +1,671 @@
+#ifndef NCAST_NARROW_H
+#define NCAST_NARROW_H
+
+/**
+ * @file ncast_narrow.h
+ * @brief Narrowest-type selection and storage for integer columns
+ *
+ * narrowest_integral_type() picks the smallest fixed-width integer type that
+ * holds every value of an array, using one vectorized min/max scan
+ * (analyze_range) and the numeric_cast range rules (fits_in). Arrays
+ * without negative values get an unsigned type, others a signed type.
+ *
+ * narrow_to_fit() converts an array into a narrowed_buffer: a buffer of
+ * elements of the selected type, tagged with that type.
+ *
+ * try_narrow_in_place() / narrow_in_place() narrow an array or a
+ * std::vector into a smaller type inside its own storage, without
+ * allocating a second buffer. convert_vector() converts a std::vector
+ * into a std::vector<To>, moving it when the types match.
+ *
+ * @code
+ * #include <ncast/ncast_narrow.h>
+ *
+ * std::vector<std::int64_t> column = load_column();
+ * ncast::narrowed_buffer narrowed = ncast::narrow_to_fit(column.data(), column.size());
+ * if (narrowed.type() == ncast::integral_type::uint16) {
+ *     const std::uint16_t* values = narrowed.data<std::uint16_t>();
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_range.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ncast {
+
+/**
+ * @brief Tag of a fixed-width integer element type
+ */
+enum class integral_type {
+    int8,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    int64,
+    uint64
+};
+
+/**
+ * @brief Size in bytes of the element type identified by a tag
+ */
+inline std::size_t integral_type_size(integral_type type) {
+    switch (type) {
+        case integral_type::int8:
+        case integral_type::uint8: return 1;
+        case integral_type::int16:
+        case integral_type::uint16: return 2;
+        case integral_type::int32:
+        case integral_type::uint32: return 4;
+        case integral_type::int64:
+        case integral_type::uint64: return 8;
+    }
+    return 8;
+}
+
+/**
+ * @brief Name of the element type identified by a tag (e.g. "int16")
+ */
+inline const char* integral_type_name(integral_type type) {
+    switch (type) {
+        case integral_type::int8: return "int8";
+        case integral_type::uint8: return "uint8";
+        case integral_type::int16: return "int16";
+        case integral_type::uint16: return "uint16";
+        case integral_type::int32: return "int32";
+        case integral_type::uint32: return "uint32";
+        case integral_type::int64: return "int64";
+        case integral_type::uint64: return "uint64";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Tag of a fixed-width integer type
+ */
+template<typename T>
+struct integral_type_of;
+
+template<> struct integral_type_of<std::int8_t> { static const integral_type value = integral_type::int8; };
+template<> struct integral_type_of<std::uint8_t> { static const integral_type value = integral_type::uint8; };
+template<> struct integral_type_of<std::int16_t> { static const integral_type value = integral_type::int16; };
+template<> struct integral_type_of<std::uint16_t> { static const integral_type value = integral_type::uint16; };
+template<> struct integral_type_of<std::int32_t> { static const integral_type value = integral_type::int32; };
+template<> struct integral_type_of<std::uint32_t> { static const integral_type value = integral_type::uint32; };
+template<> struct integral_type_of<std::int64_t> { static const integral_type value = integral_type::int64; };
+template<> struct integral_type_of<std::uint64_t> { static const integral_type value = integral_type::uint64; };
+
+/**
+ * @brief Smallest fixed-width integer type holding every analyzed value
+ *
+ * Candidates are tried from 8 to 64 bits with fits_in(), i.e. the
+ * numeric_cast range rules; unsigned types are used when there are no
+ * negative values. An empty range selects uint8.
+ */
+template<typename T>
+integral_type narrowest_integral_type(const range_stats<T>& stats) {
+    static_assert(std::is_integral<T>::value, "narrowest_integral_type requires an integral element type");
+    if (stats.has_negative) {
+        if (fits_in<std::int8_t>(stats)) return integral_type::int8;
+        if (fits_in<std::int16_t>(stats)) return integral_type::int16;
+        if (fits_in<std::int32_t>(stats)) return integral_type::int32;
+        return integral_type::int64;
+    }
+    if (fits_in<std::uint8_t>(stats)) return integral_type::uint8;
+    if (fits_in<std::uint16_t>(stats)) return integral_type::uint16;
+    if (fits_in<std::uint32_t>(stats)) return integral_type::uint32;
+    return integral_type::uint64;
+}
+
+/**
+ * @brief Smallest fixed-width integer type holding every element of an array
+ */
+template<typename T>
+integral_type narrowest_integral_type(const T* data, std::size_t count) {
+    return narrowest_integral_type(analyze_range(data, count));
+}
+
+/**
+ * @brief Integer array stored in a type chosen at runtime
+ *
+ * Owns count() elements of the type identified by type(). Access them with
+ * data<T>() for the matching T, or with visit(), which calls
+ * f(const T* data, std::size_t count) with the stored element type.
+ */
+class narrowed_buffer {
+private:
+    integral_type type_;
+    std::size_t count_;
+    std::unique_ptr<unsigned char[]> storage_;  // new unsigned char[] is aligned for every element type
+
+    // Create count default-initialized T objects in the storage (no zero fill)
+    template<typename T>
+    static void create(unsigned char* bytes, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ::new (static_cast<void*>(bytes + i * sizeof(T))) T;
+        }
+    }
+
+    static std::unique_ptr<unsigned char[]> allocate(integral_type type, std::size_t count) {
+        if (count > std::numeric_limits<std::size_t>::max() / integral_type_size(type)) {
+            throw std::bad_array_new_length();
+        }
+        std::unique_ptr<unsigned char[]> bytes(new unsigned char[count * integral_type_size(type)]);
+        switch (type) {
+            case integral_type::int8: create<std::int8_t>(bytes.get(), count); break;
+            case integral_type::uint8: create<std::uint8_t>(bytes.get(), count); break;
+            case integral_type::int16: create<std::int16_t>(bytes.get(), count); break;
+            case integral_type::uint16: create<std::uint16_t>(bytes.get(), count); break;
+            case integral_type::int32: create<std::int32_t>(bytes.get(), count); break;
+            case integral_type::uint32: create<std::uint32_t>(bytes.get(), count); break;
+            case integral_type::int64: create<std::int64_t>(bytes.get(), count); break;
+            case integral_type::uint64: create<std::uint64_t>(bytes.get(), count); break;
+        }
+        return bytes;
+    }
+
+    template<typename T>
+    T* elements() const {
+        if (count_ == 0) {
+            return nullptr;
+        }
+#if defined(__cpp_lib_launder)
+        return std::launder(static_cast<T*>(static_cast<void*>(storage_.get())));
+#else
+        return static_cast<T*>(static_cast<void*>(storage_.get()));
+#endif
+    }
+
+    template<typename Buffer, typename Visitor>
+    static void dispatch(Buffer& buffer, Visitor& f) {
+        switch (buffer.type_) {
+            case integral_type::int8: f(buffer.template data<std::int8_t>(), buffer.count_); break;
+            case integral_type::uint8: f(buffer.template data<std::uint8_t>(), buffer.count_); break;
+            case integral_type::int16: f(buffer.template data<std::int16_t>(), buffer.count_); break;
+            case integral_type::uint16: f(buffer.template data<std::uint16_t>(), buffer.count_); break;
+            case integral_type::int32: f(buffer.template data<std::int32_t>(), buffer.count_); break;
+            case integral_type::uint32: f(buffer.template data<std::uint32_t>(), buffer.count_); break;
+            case integral_type::int64: f(buffer.template data<std::int64_t>(), buffer.count_); break;
+            case integral_type::uint64: f(buffer.template data<std::uint64_t>(), buffer.count_); break;
+        }
+    }
+
+public:
+    narrowed_buffer() : type_(integral_type::uint8), count_(0) {}
+
+    /**
+     * @brief Buffer of count elements of the given type, left uninitialized
+     * @throws std::bad_array_new_length if count elements do not fit in std::size_t bytes
+     */
+    narrowed_buffer(integral_type type, std::size_t count)
+        : type_(type), count_(count), storage_(allocate(type, count)) {}
+
+    narrowed_buffer(const narrowed_buffer& other)
+        : type_(other.type_), count_(other.count_), storage_(allocate(other.type_, other.count_)) {
+        if (count_ != 0) {
+            std::memcpy(storage_.get(), other.storage_.get(), size_bytes());
+        }
+    }
+
+    narrowed_buffer(narrowed_buffer&& other) noexcept
+        : type_(other.type_), count_(other.count_), storage_(std::move(other.storage_)) {
+        other.count_ = 0;
+    }
+
+    narrowed_buffer& operator=(narrowed_buffer other) noexcept {
+        type_ = other.type_;
+        count_ = other.count_;
+        storage_ = std::move(other.storage_);
+        return *this;
+    }
+
+    integral_type type() const { return type_; }
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /**
+     * @brief Size of the element data in bytes
+     */
+    std::size_t size_bytes() const { return count_ * integral_type_size(type_); }
+
+    /**
+     * @brief Typed element pointer, or nullptr if T does not match type()
+     */
+    template<typename T>
+    const T* data() const {
+        return integral_type_of<T>::value == type_ ? elements<const T>() : nullptr;
+    }
+
+    template<typename T>
+    T* data() {
+        return integral_type_of<T>::value == type_ ? elements<T>() : nullptr;
+    }
+
+    /**
+     * @brief Call f(const T* data, std::size_t count) with the stored element type
+     */
+    template<typename Visitor>
+    void visit(Visitor&& f) const {
+        dispatch(*this, f);
+    }
+
+    /**
+     * @brief Call f(T* data, std::size_t count) with the stored element type
+     */
+    template<typename Visitor>
+    void visit(Visitor&& f) {
+        dispatch(*this, f);
+    }
+};
+
+namespace detail {
+
+    template<typename To, typename From>
+    void narrow_copy_n(const From* src, std::size_t count, To* dst) {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = static_cast<To>(src[i]);
+        }
+    }
+
+    template<typename From>
+    struct narrow_copy_visitor {
+        const From* src;
+
+        template<typename To>
+        void operator()(To* dst, std::size_t count) const {
+            narrow_copy_n(src, count, dst);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Convert an integer array into the narrowest type holding all of its values
+ *
+ * Scans the array once to select the type (narrowest_integral_type) and
+ * converts it with static_cast, which is lossless for the selected type.
+ */
+template<typename T>
+narrowed_buffer narrow_to_fit(const T* data, std::size_t count) {
+    narrowed_buffer result(narrowest_integral_type(data, count), count);
+    detail::narrow_copy_visitor<T> copy = { data };
+    result.visit(copy);
+    return result;
+}
+
+namespace detail {
+
+    const std::size_t narrow_block_size = 256;   ///< Elements validated and converted per step
+
+    /**
+     * @brief Create count To objects from block at the front of the storage at bytes
+     *
+     * Placement new ends the lifetime of the overlapped From objects, so the
+     * narrowed values are To objects rather than From storage accessed through
+     * a To pointer (which strict aliasing forbids).
+     */
+    template<typename To>
+    void store_narrowed(unsigned char* bytes, std::size_t first, const To* block, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ::new (static_cast<void*>(bytes + (first + i) * sizeof(To))) To(block[i]);
+        }
+    }
+
+    /**
+     * @brief Pointer to the To values stored at the start of a From buffer
+     *
+     * After compaction the storage holds To objects created by store_narrowed.
+     * A same-width sign change writes nothing; the From objects are accessed
+     * through their signed/unsigned counterpart, which aliasing allows.
+     */
+    template<typename To, typename From, bool IsSignChange = is_sign_change<To, From>::value>
+    struct narrowed_storage {
+        static To* data(From* storage) {
+#if defined(__cpp_lib_launder)
+            return std::launder(static_cast<To*>(static_cast<void*>(storage)));
+#else
+            return static_cast<To*>(static_cast<void*>(storage));
+#endif
+        }
+    };
+
+    template<typename To, typename From>
+    struct narrowed_storage<To, From, true> {
+        static To* data(From* storage) {
+            return reinterpret_cast<To*>(storage);
+        }
+    };
+
+    /**
+     * @brief Convert [begin, end) to To and pack it at the front of the buffer
+     *
+     * Each block is read before it is written and the write position
+     * (i * sizeof(To)) never passes the read position (i * sizeof(From)),
+     * so unread source elements are never overwritten. Values must fit To.
+     */
+    template<typename To, typename From>
+    void compact_in_place(From* data, std::size_t begin, std::size_t end) {
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(data);
+        To block[narrow_block_size];
+        for (std::size_t start = begin; start < end; start += narrow_block_size) {
+            std::size_t n = end - start < narrow_block_size ? end - start : narrow_block_size;
+            for (std::size_t i = 0; i < n; ++i) {
+                block[i] = static_cast<To>(data[start + i]);
+            }
+            store_narrowed(bytes, start, block, n);
+        }
+    }
+
+    /**
+     * @brief Undo compact_in_place for the first count elements (back to front)
+     */
+    template<typename To, typename From>
+    void widen_in_place(From* data, std::size_t count) {
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(data);
+        for (std::size_t i = count; i-- > 0;) {
+            To narrow;
+            std::memcpy(&narrow, bytes + i * sizeof(To), sizeof(To));
+            ::new (static_cast<void*>(bytes + i * sizeof(From))) From(static_cast<From>(narrow));
+        }
+    }
+
+    /**
+     * @brief Single pass: validate and compact block by block, undo on failure
+     *
+     * Used for integral pairs, where narrowing a validated value and widening
+     * it back is exact.
+     */
+    template<typename To, typename From>
+    bulk_result narrow_in_place_single_pass(From* data, std::size_t count) {
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(data);
+        To block[narrow_block_size];
+        for (std::size_t start = 0; start < count; start += narrow_block_size) {
+            std::size_t n = count - start < narrow_block_size ? count - start : narrow_block_size;
+            if (!block_fits<To>(data + start, n)) {
+                bulk_result result;
+                result.index = start + find_first_failure<To>(data + start, n);
+                result.error = element_check<To, From>::error(data[result.index]);
+                widen_in_place<To>(data, start);
+                return result;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                block[i] = static_cast<To>(data[start + i]);
+            }
+            store_narrowed(bytes, start, block, n);
+        }
+        bulk_result result = { count, cast_error::none };
+        return result;
+    }
+
+    /**
+     * @brief Same-width sign change: the bits stay as they are, so only validate
+     */
+    template<typename To, typename From>
+    bulk_result narrow_in_place_sign_change(const From* data, std::size_t count) {
+        bulk_result result = { count, cast_error::none };
+        if (!sign_bits_clear(data, count)) {
+            result.index = find_first_failure<To>(data, count);
+            result.error = element_check<To, From>::error(data[result.index]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Two passes: validate everything, then compact
+     *
+     * Used when floating-point rounding makes narrowing irreversible.
+     */
+    template<typename To, typename From>
+    bulk_result narrow_in_place_two_pass(From* data, std::size_t count) {
+        for (std::size_t start = 0; start < count; start += narrow_block_size) {
+            std::size_t n = count - start < narrow_block_size ? count - start : narrow_block_size;
+            if (!block_fits<To>(data + start, n)) {
+                bulk_result result;
+                result.index = start + find_first_failure<To>(data + start, n);
+                result.error = element_check<To, From>::error(data[result.index]);
+                return result;
+            }
+        }
+        compact_in_place<To>(data, 0, count);
+        bulk_result result = { count, cast_error::none };
+        return result;
+    }
+
+    /// Narrowing strategy for a pair of types
+    template<typename To, typename From, bool IsSignChange = is_sign_change<To, From>::value>
+    struct in_place_narrowing {
+        static bulk_result apply(From* data, std::size_t count) {
+            return std::is_integral<To>::value && std::is_integral<From>::value
+                ? narrow_in_place_single_pass<To>(data, count)
+                : narrow_in_place_two_pass<To>(data, count);
+        }
+    };
+
+    template<typename To, typename From>
+    struct in_place_narrowing<To, From, true> {
+        static bulk_result apply(From* data, std::size_t count) {
+            return narrow_in_place_sign_change<To>(data, count);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Narrow an array in place, reusing its storage
+ *
+ * Validates every element with the numeric_cast rules and converts the
+ * array front to back into count To values packed at the start of the same
+ * storage; no second buffer is allocated. The narrowed values are created
+ * as To objects (placement new), so the buffer then holds To, not From,
+ * objects: access them through narrowed_data<To>(data) and do not read
+ * the buffer as From again before assigning it. A same-width sign change
+ * (e.g. int32_t to uint32_t) keeps the bits, so it only validates, with a
+ * single OR-reduction of the sign bits, and writes nothing.
+ *
+ * On failure the buffer holds its original contents (nothing is lost) and
+ * the result reports the first failing index and the reason.
+ *
+ * @tparam To Target type, no larger than From
+ * @param data Array to narrow
+ * @param count Number of elements
+ */
+template<typename To, typename From>
+bulk_result try_narrow_in_place(From* data, std::size_t count) {
+    static_assert(std::is_arithmetic<To>::value && std::is_arithmetic<From>::value,
+                  "in-place narrowing requires built-in arithmetic types");
+    static_assert(sizeof(To) <= sizeof(From) && alignof(To) <= alignof(From),
+                  "in-place narrowing requires a target type no larger than the source type");
+    return detail::in_place_narrowing<To, From>::apply(data, count);
+}
+
+/**
+ * @brief Pointer to the values narrowed by a successful try_narrow_in_place<To>(data, count)
+ */
+template<typename To, typename From>
+To* narrowed_data(From* data) {
+    return detail::narrowed_storage<To, From>::data(data);
+}
+
+/**
+ * @brief Narrow an array in place, throwing on failure
+ *
+ * @return Pointer to the count narrowed values at the start of the buffer
+ * @throws cast_exception with the first failing index; the buffer holds its original contents
+ */
+template<typename To, typename From>
+To* narrow_in_place(From* data, std::size_t count) {
+    bulk_result result = try_narrow_in_place<To>(data, count);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+    return narrowed_data<To>(data);
+}
+
+/**
+ * @brief Container of To values living in the storage of a std::vector<From>
+ *
+ * Returned by narrow_in_place(std::vector<From>&&). It owns the original
+ * vector, so no memory is allocated or freed by the narrowing; the storage
+ * keeps its original capacity.
+ */
+template<typename To, typename From>
+class narrowed_vector {
+private:
+    std::vector<From> storage_;
+    std::size_t size_;
+
+public:
+    typedef To value_type;
+    typedef To* iterator;
+    typedef const To* const_iterator;
+
+    narrowed_vector() : size_(0) {}
+
+    /**
+     * @brief Adopt storage whose first count elements have already been narrowed
+     *
+     * E.g. after a successful try_narrow_in_place<To>(storage.data(), count).
+     */
+    narrowed_vector(std::vector<From>&& storage, std::size_t count)
+        : storage_(std::move(storage)), size_(count) {}
+
+    To* data() { return detail::narrowed_storage<To, From>::data(storage_.data()); }
+    const To* data() const {
+        return detail::narrowed_storage<To, From>::data(const_cast<From*>(storage_.data()));
+    }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+
+    To& operator[](std::size_t index) { return data()[index]; }
+    const To& operator[](std::size_t index) const { return data()[index]; }
+
+    /**
+     * @brief Give the underlying storage back (its bytes hold the narrowed values)
+     *
+     * The elements hold To objects; assign them before reading them as From.
+     */
+    std::vector<From> release() {
+        size_ = 0;
+        return std::move(storage_);
+    }
+};
+
+/**
+ * @brief Narrow a vector in place and take ownership of its storage
+ *
+ * @code
+ * std::vector<std::uint64_t> ids = load_ids();
+ * ncast::narrowed_vector<std::uint32_t, std::uint64_t> ids32 =
+ *     ncast::narrow_in_place<std::uint32_t>(std::move(ids));
+ * @endcode
+ *
+ * @throws cast_exception with the first failing index; values is then left
+ *         unmoved with its original contents
+ */
+template<typename To, typename From>
+narrowed_vector<To, From> narrow_in_place(std::vector<From>&& values) {
+    bulk_result result = try_narrow_in_place<To>(values.data(), values.size());
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+    std::size_t count = values.size();
+    return narrowed_vector<To, From>(std::move(values), count);
+}
+
+namespace detail {
+
+    /// Generic pair: one reserved allocation, appended block by block from a
+    /// checked conversion on the stack, so the new vector is never zero-filled
+    template<typename To, typename From,
+             bool IsSame = std::is_same<To, From>::value,
+             bool IsSignChange = is_sign_change<To, From>::value>
+    struct vector_conversion {
+        static std::vector<To> apply(std::vector<From>&& values) {
+            std::vector<To> converted;
+            converted.reserve(values.size());
+            To block[bulk_block_size];
+            for (std::size_t base = 0; base < values.size(); base += bulk_block_size) {
+                std::size_t n = values.size() - base < bulk_block_size ? values.size() - base : bulk_block_size;
+                bulk_result result = try_numeric_cast_n(values.data() + base, n, block);
+                if (!result.ok()) {
+                    result.index += base;
+                    throw_bulk_error(result, "unknown", 0, "unknown");
+                }
+                converted.insert(converted.end(), block, block + n);
+            }
+            return converted;
+        }
+    };
+
+    /// Same type: the storage is moved
+    template<typename To, typename From>
+    struct vector_conversion<To, From, true, false> {
+        static std::vector<To> apply(std::vector<From>&& values) {
+            return std::move(values);
+        }
+    };
+
+    /// Same-width sign change: one OR-reduction of the sign bits, then the bits
+    /// are copied unchanged into a single allocation
+    template<typename To, typename From>
+    struct vector_conversion<To, From, false, true> {
+        static std::vector<To> apply(std::vector<From>&& values) {
+            bulk_result result = narrow_in_place_sign_change<To>(values.data(), values.size());
+            if (!result.ok()) {
+                throw_bulk_error(result, "unknown", 0, "unknown");
+            }
+            // Signed and unsigned variants of a type may alias each other
+            const To* first = reinterpret_cast<const To*>(values.data());
+            return std::vector<To>(first, first + values.size());
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Convert a vector to std::vector<To> with numeric_cast validation
+ *
+ * - To == From: the vector is moved, no allocation or copy
+ * - Same-width sign change (int32_t <-> uint32_t, int64_t <-> uint64_t, ...):
+ *   validated with one OR-reduction of the sign bits, then copied bit for bit
+ *   into a single allocation
+ * - Other pairs: a single reserved allocation, filled block by block from
+ *   try_numeric_cast_n without zero-filling it first
+ *
+ * A std::vector<To> cannot adopt the buffer of a std::vector<From>; to keep
+ * the storage of a sign change, use narrow_in_place<To>(std::move(values)),
+ * which only validates and returns a narrowed_vector over the same buffer.
+ *
+ * @code
+ * std::vector<std::int32_t> ids = load_ids();
+ * std::vector<std::uint32_t> keys = ncast::convert_vector<std::uint32_t>(std::move(ids));
+ * @endcode
+ *
+ * @throws cast_exception with the first failing index; values is then left
+ *         unmoved with its original contents
+ */
+template<typename To, typename From>
+std::vector<To> convert_vector(std::vector<From>&& values) {
+    static_assert(std::is_arithmetic<To>::value && std::is_arithmetic<From>::value,
+                  "convert_vector requires built-in arithmetic types");
+    return detail::vector_conversion<To, From>::apply(std::move(values));
+}
+
+} // namespace ncast
+
+#endif // NCAST_NARROW_H
@@ -0,0 +1,384 @@
+#ifndef NCAST_PARALLEL_H
+#define NCAST_PARALLEL_H
+
+/**
+ * @file ncast_parallel.h
+ * @brief Multi-threaded checked bulk conversion
+ *
+ * try_numeric_cast_parallel() splits an array into cache-sized chunks and
+ * converts them on a thread_pool with the same vectorized validate-and-convert
+ * loops as try_numeric_cast_n(). The result is deterministic: the lowest
+ * failing index (and its error) is reported however the chunks were scheduled.
+ *
+ * Scheduling: every thread starts with a contiguous range of chunks (the same
+ * static split as first_touch_parallel(), so a NUMA-friendly output buffer is
+ * written mostly by the thread that placed its pages) and works through it
+ * front to back; a thread that runs out steals the back half of another
+ * thread's remaining range. Once a failure is found, chunks beyond it are
+ * skipped.
+ *
+ * Unlike the sequential conversions, on failure only the elements before the
+ * failing index are guaranteed to be written; elements after it may or may not be.
+ *
+ * Only std::thread is used; with pthreads, link with Threads::Threads (-pthread).
+ *
+ * @code
+ * #include <ncast/ncast_parallel.h>
+ *
+ * ncast::thread_pool pool;                        // one thread per hardware thread
+ * std::unique_ptr<std::int32_t[]> out(new std::int32_t[n]);
+ * ncast::first_touch_parallel<std::int64_t>(out.get(), n, pool);   // values is std::int64_t*
+ * ncast::bulk_result r = ncast::try_numeric_cast_parallel(values, n, out.get(), pool);
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ncast {
+
+/**
+ * @brief Minimal fixed-size thread pool running one task on all threads at a time
+ *
+ * A pool of N threads keeps N - 1 workers; the thread calling run() takes part
+ * as thread 0. run() calls must not overlap. An exception thrown by the task
+ * on any thread is rethrown from run() once every thread has finished.
+ */
+class thread_pool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(unsigned)>* task_;
+    unsigned long generation_;
+    unsigned pending_;
+    bool stop_;
+    std::exception_ptr error_;      ///< First exception thrown by the task of the current run()
+
+    void record_error() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+
+    void worker_loop(unsigned index) {
+        unsigned long seen = 0;
+        for (;;) {
+            const std::function<void(unsigned)>* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+                task = task_;
+            }
+            try {
+                (*task)(index);
+            } catch (...) {
+                record_error();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::size_t i = 0; i < workers_.size(); ++i) {
+            workers_[i].join();
+        }
+    }
+
+public:
+    /**
+     * @brief Start a pool
+     * @param threads Total number of threads including the caller; 0 means std::thread::hardware_concurrency()
+     */
+    explicit thread_pool(unsigned threads = 0)
+        : task_(nullptr), generation_(0), pending_(0), stop_(false) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        try {
+            // Reserved up front so push_back never drops a started thread
+            workers_.reserve(threads > 1 ? threads - 1 : 0);
+            for (unsigned i = 1; i < threads; ++i) {
+                workers_.push_back(std::thread(&thread_pool::worker_loop, this, i));
+            }
+        } catch (...) {
+            // The destructor does not run: join the workers started so far
+            stop_workers();
+            throw;
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        stop_workers();
+    }
+
+    /// Number of threads, including the caller of run()
+    unsigned size() const { return static_cast<unsigned>(workers_.size() + 1); }
+
+    /**
+     * @brief Call task(thread_index) once on every thread and wait for all of them
+     *
+     * @throws the first exception thrown by the task on any thread, after all threads have finished
+     */
+    void run(const std::function<void(unsigned)>& task) {
+        if (workers_.empty()) {
+            task(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            pending_ = static_cast<unsigned>(workers_.size());
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        try {
+            task(0);
+        } catch (...) {
+            record_error();
+        }
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&] { return pending_ == 0; });
+            std::swap(error, error_);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+namespace detail {
+
+    /// Source bytes per chunk: half of a typical 512 KB - 2 MB L2, leaving room for the output
+    const std::size_t parallel_chunk_bytes = 256 * 1024;
+
+    /// Elements per chunk, a multiple of bulk_block_size
+    template<typename FromType>
+    std::size_t parallel_chunk_size() {
+        std::size_t blocks = parallel_chunk_bytes / sizeof(FromType) / bulk_block_size;
+        return (blocks == 0 ? 1 : blocks) * bulk_block_size;
+    }
+
+    /// First chunk of thread's initial range in a static split of chunks over threads
+    inline std::size_t initial_chunk(std::size_t chunks, unsigned threads, unsigned thread) {
+        return chunks * thread / threads;
+    }
+
+    /**
+     * @brief Chunk range owned by one thread; padded so that ranges do not share a cache line
+     */
+    struct chunk_range {
+        std::mutex lock;
+        std::size_t next;
+        std::size_t end;
+        char padding[64];
+    };
+
+    /**
+     * @brief Work-stealing chunk scheduler
+     *
+     * The owner takes chunks from the front of its range; thieves take the back
+     * half of a victim's range. Chunks are large, so a mutex per range is cheap.
+     */
+    class chunk_scheduler {
+    private:
+        std::vector<chunk_range> ranges_;
+
+        bool take_front(chunk_range& range, std::size_t& chunk) {
+            std::lock_guard<std::mutex> lock(range.lock);
+            if (range.next == range.end) {
+                return false;
+            }
+            chunk = range.next++;
+            return true;
+        }
+
+        bool steal(unsigned thief, std::size_t& chunk) {
+            const unsigned threads = static_cast<unsigned>(ranges_.size());
+            for (unsigned offset = 1; offset < threads; ++offset) {
+                chunk_range& victim = ranges_[(thief + offset) % threads];
+                std::size_t begin;
+                std::size_t end;
+                {
+                    std::lock_guard<std::mutex> lock(victim.lock);
+                    std::size_t remaining = victim.end - victim.next;
+                    if (remaining == 0) {
+                        continue;
+                    }
+                    end = victim.end;
+                    begin = end - (remaining + 1) / 2;
+                    victim.end = begin;
+                }
+                chunk_range& own = ranges_[thief];
+                std::lock_guard<std::mutex> lock(own.lock);
+                own.next = begin + 1;
+                own.end = end;
+                chunk = begin;
+                return true;
+            }
+            return false;
+        }
+
+    public:
+        chunk_scheduler(std::size_t chunks, unsigned threads) : ranges_(threads) {
+            for (unsigned t = 0; t < threads; ++t) {
+                ranges_[t].next = initial_chunk(chunks, threads, t);
+                ranges_[t].end = initial_chunk(chunks, threads, t + 1);
+            }
+        }
+
+        /// Next chunk for thread; false when no work is left anywhere
+        bool next(unsigned thread, std::size_t& chunk) {
+            return take_front(ranges_[thread], chunk) || steal(thread, chunk);
+        }
+    };
+
+    /**
+     * @brief Lowest failure found so far; chunks starting at or beyond it are skipped
+     */
+    class lowest_failure {
+    private:
+        std::atomic<std::size_t> bound_;
+        std::mutex lock_;
+        bulk_result result_;
+
+    public:
+        explicit lowest_failure(std::size_t count) : bound_(count) {
+            result_.index = count;
+            result_.error = cast_error::none;
+        }
+
+        bool below(std::size_t index) const { return index < bound_.load(std::memory_order_relaxed); }
+
+        void report(const bulk_result& failure) {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (failure.index < result_.index) {
+                result_ = failure;
+                bound_.store(failure.index, std::memory_order_relaxed);
+            }
+        }
+
+        bulk_result result() {
+            std::lock_guard<std::mutex> lock(lock_);
+            return result_;
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Touch a freshly allocated output buffer from the pool's threads
+ *
+ * Zeroes dst with the same static split of chunks over threads that
+ * try_numeric_cast_parallel() starts from, so that on first-touch NUMA
+ * systems each page is placed on the node of the thread that will write it.
+ * Call it once, right after allocation and before the buffer is written,
+ * naming the source type: first_touch_parallel<double>(dst, n, pool).
+ *
+ * @tparam FromType Source type of the later conversion, which sets its chunk size
+ */
+template<typename FromType, typename ToType>
+void first_touch_parallel(ToType* dst, std::size_t count, thread_pool& pool) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "first_touch_parallel requires built-in arithmetic types");
+    const std::size_t chunk_size = detail::parallel_chunk_size<FromType>();
+    const std::size_t chunks = (count + chunk_size - 1) / chunk_size;
+    const unsigned threads = pool.size();
+    pool.run([&](unsigned thread) {
+        std::size_t begin = detail::initial_chunk(chunks, threads, thread) * chunk_size;
+        std::size_t end = detail::initial_chunk(chunks, threads, thread + 1) * chunk_size;
+        end = end < count ? end : count;
+        if (begin < end) {
+            std::memset(static_cast<void*>(dst + begin), 0, (end - begin) * sizeof(ToType));
+        }
+    });
+}
+
+/**
+ * @brief Convert an array on a thread pool, reporting the lowest failing element
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @param pool Threads to run on; arrays of at most one chunk are converted on the calling thread
+ * @return bulk_result with the lowest failing index and its error, or {count, none}
+ */
+template<typename ToType, typename FromType>
+bulk_result try_numeric_cast_parallel(const FromType* src, std::size_t count, ToType* dst, thread_pool& pool) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "try_numeric_cast_parallel requires built-in arithmetic types");
+    const std::size_t chunk_size = detail::parallel_chunk_size<FromType>();
+    if (count <= chunk_size || pool.size() == 1) {
+        return try_numeric_cast_n(src, count, dst);
+    }
+
+    const std::size_t chunks = (count + chunk_size - 1) / chunk_size;
+    detail::chunk_scheduler scheduler(chunks, pool.size());
+    detail::lowest_failure failure(count);
+
+    pool.run([&](unsigned thread) {
+        std::size_t chunk;
+        while (scheduler.next(thread, chunk)) {
+            std::size_t begin = chunk * chunk_size;
+            if (!failure.below(begin)) {
+                continue;
+            }
+            std::size_t n = count - begin < chunk_size ? count - begin : chunk_size;
+            bulk_result r = try_numeric_cast_n(src + begin, n, dst + begin);
+            if (!r.ok()) {
+                r.index += begin;
+                failure.report(r);
+            }
+        }
+    });
+    return failure.result();
+}
+
+/**
+ * @brief Convert an array on a thread pool; throws on the lowest failing element
+ *
+ * @throws cast_exception with the error of the lowest failing element
+ */
+template<typename ToType, typename FromType>
+void numeric_cast_parallel(const FromType* src, std::size_t count, ToType* dst, thread_pool& pool) {
+    bulk_result result = try_numeric_cast_parallel(src, count, dst, pool);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+}
+
+} // namespace ncast
+
+#endif // NCAST_PARALLEL_H
@@ -0,0 +1,1290 @@
+#ifndef NCAST_PARSE_H
+#define NCAST_PARSE_H
+
+/**
+ * @file ncast_parse.h
+ * @brief Fused text parsing and range validation (parse_cast)
+ *
+ * parse_cast<T>(first, last) parses a decimal integer directly into T,
+ * replacing the strtoll + numeric_cast<T> idiom that parses into a 64-bit
+ * value and range-checks it again. Digits are accumulated in T's own
+ * width: the first numeric_limits<T>::digits10 significant digits cannot
+ * overflow and are accumulated without checks, the next one is compared
+ * with a bound precomputed from T's limit, and any digit after it is an
+ * overflow, so the check costs one compare per number instead of one per
+ * digit.
+ *
+ * Long digit runs are taken 8 at a time (SWAR): 8 characters are loaded
+ * as one 64-bit word, checked to be all digits with a few bit operations
+ * and combined with three multiplies, so fixed-width fields such as
+ * timestamps and IDs do not run a per-digit loop. Words count against the
+ * same safe-digit budget, so overflow detection is unchanged. Short fields,
+ * the digits after the last full word and text within 8 characters of the
+ * end use the scalar loop.
+ *
+ * The result mirrors std::from_chars (available in C++11): ptr is the first
+ * character not consumed and error uses the library's error kinds:
+ * - cast_error::invalid_format: no digits at first (ptr == first)
+ * - cast_error::positive_overflow / negative_overflow: the number does not
+ *   fit T; ptr is past all its digits, as in from_chars
+ * - cast_error::negative_to_unsigned: a nonzero negative number for an
+ *   unsigned T
+ *
+ * Accepted syntax is from_chars': an optional '-', then digits; no leading
+ * whitespace or '+'. Parsing is locale-independent and constexpr in C++14+.
+ *
+ * parse_cast<float>, parse_cast<double> and parse_cast<half> replace
+ * strtod + numeric_cast<float> (two roundings, locale-dependent decimal
+ * point) with one correctly rounded conversion (nearest, ties to even):
+ * - Syntax is from_chars' general format: digits with an optional '.', an
+ *   optional exponent, or inf / infinity / nan, case-insensitive
+ * - cast_error::positive_overflow / negative_overflow: the rounded value is
+ *   infinite; cast_error::underflow: a nonzero number rounds to zero
+ * - inf and nan text parse to their values, as numeric_cast converts them
+ *   between floating-point types
+ * Up to 19 significant digits are converted by an exact multiplication in
+ * the target type when both operands are exact (Clinger), otherwise by a
+ * 128-bit power-of-five product (Eisel-Lemire); an exact decimal fallback
+ * decides the rare cases those leave open.
+ *
+ * parse_cast<T, 16>, parse_cast<T, 8> and parse_cast<T, 2> parse integral
+ * T from hexadecimal, octal and binary digits (no prefix; hexadecimal
+ * letters in either case). With SSSE3, 16 characters are classified at
+ * once (nibble lookups through pshufb for hexadecimal), converted to digit
+ * values and combined by multiply-adds. Each digit is a fixed number of
+ * bits, so overflow is decided from the significant digit count and the
+ * leading digit's bit length, without a check per digit.
+ *
+ * @code
+ * #include <ncast/ncast_parse.h>
+ *
+ * ncast::parse_result<std::int16_t> r = ncast::parse_cast<std::int16_t>(field, field_end);
+ * if (!r.ok()) {
+ *     // r.error is cast_error::positive_overflow for "40000"
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_half.h"
+#include "ncast_simd.h"
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace ncast {
+
+/**
+ * @brief Outcome of parse_cast
+ */
+template<typename T>
+struct parse_result {
+    T value;                ///< Parsed value, T() on failure
+    const char* ptr;        ///< First character not consumed
+    cast_error error;       ///< Reason of the failure, cast_error::none on success
+
+    constexpr bool ok() const { return error == cast_error::none; }
+};
+
+namespace detail {
+
+    /// Decimal parsing bounds of an integral type
+    template<typename T>
+    struct decimal_limits {
+        /// Unsigned type with at least the width of unsigned, so arithmetic does not promote to int
+        typedef typename std::common_type<typename std::make_unsigned<T>::type, unsigned>::type accumulator;
+
+        /// Significant digits that always fit
+        static const int safe_digits = std::numeric_limits<T>::digits10;
+
+        static constexpr accumulator max_magnitude(bool negative) {
+            return negative && std::is_signed<T>::value
+                ? static_cast<accumulator>(static_cast<accumulator>(std::numeric_limits<T>::max()) + 1u)
+                : static_cast<accumulator>(std::numeric_limits<T>::max());
+        }
+    };
+
+    NCAST_CONSTEXPR_14 inline bool is_decimal_digit(char c) {
+        return static_cast<unsigned>(c - '0') <= 9u;
+    }
+
+    NCAST_CONSTEXPR_14 inline const char* skip_decimal_digits(const char* first, const char* last) {
+        while (first != last && is_decimal_digit(*first)) {
+            ++first;
+        }
+        return first;
+    }
+
+    /// 8 characters as a little-endian word: the first character in the low byte (compiles to one load)
+    NCAST_CONSTEXPR_14 inline std::uint64_t load_swar_chunk(const char* p) {
+        return static_cast<std::uint64_t>(static_cast<unsigned char>(p[0]))
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[1])) << 8
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[2])) << 16
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[3])) << 24
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[4])) << 32
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[5])) << 40
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[6])) << 48
+             | static_cast<std::uint64_t>(static_cast<unsigned char>(p[7])) << 56;
+    }
+
+    /**
+     * @brief True when all 8 characters of a chunk are digits
+     *
+     * A byte is a digit when neither byte - '0' nor byte + ('9' ^ 0x7f) sets
+     * its high bit (borrows and carries only start at non-digit bytes).
+     */
+    NCAST_CONSTEXPR_14 inline bool is_swar_digits(std::uint64_t chunk) {
+        return (((chunk - 0x3030303030303030ull) | (chunk + 0x4646464646464646ull)) & 0x8080808080808080ull) == 0;
+    }
+
+    /**
+     * @brief Value of a chunk of 8 digit characters
+     *
+     * Adjacent digits, then pairs, then quads are combined with three
+     * multiplies; the first character is the most significant digit.
+     */
+    NCAST_CONSTEXPR_14 inline std::uint32_t swar_digits_value(std::uint64_t chunk) {
+        std::uint64_t v = chunk & 0x0F0F0F0F0F0F0F0Full;
+        v = v * 10u + (v >> 8);
+        v = ((v & 0x000000FF000000FFull) * (100u + (1000000ull << 32))
+           + ((v >> 16) & 0x000000FF000000FFull) * (1u + (10000ull << 32))) >> 32;
+        return static_cast<std::uint32_t>(v);
+    }
+
+    template<typename T>
+    NCAST_CONSTEXPR_14 parse_result<T> make_parse_result(T value, const char* ptr, cast_error error) {
+        parse_result<T> result = { value, ptr, error };
+        return result;
+    }
+
+    /// -magnitude in T, for magnitudes up to max() + 1 (no signed overflow on the way)
+    template<typename T, typename Magnitude>
+    NCAST_CONSTEXPR_14 T negate_magnitude(Magnitude magnitude) {
+        return magnitude == 0 ? T(0) : static_cast<T>(-static_cast<T>(magnitude - 1u) - 1);
+    }
+
+    /**
+     * @brief Parse a decimal integer into T (see parse_cast)
+     */
+    template<typename T>
+    NCAST_CONSTEXPR_14 parse_result<T> parse_decimal(const char* first, const char* last) {
+        typedef typename decimal_limits<T>::accumulator accumulator;
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        if (negative) {
+            ++p;
+        }
+        const char* digits = p;
+        while (p != last && *p == '0') {
+            ++p;
+        }
+
+        // Up to safe_digits significant digits cannot overflow: take them 8 at a
+        // time while 8 digits are readable, then one at a time
+        int budget = decimal_limits<T>::safe_digits;
+        accumulator value = 0;
+        while (budget >= 8 && last - p >= 8) {
+            const std::uint64_t chunk = load_swar_chunk(p);
+            if (!is_swar_digits(chunk)) {
+                break;
+            }
+            value = static_cast<accumulator>(value * 100000000u + static_cast<accumulator>(swar_digits_value(chunk)));
+            p += 8;
+            budget -= 8;
+        }
+        for (; budget > 0 && p != last && is_decimal_digit(*p); ++p, --budget) {
+            value = static_cast<accumulator>(value * 10u + static_cast<accumulator>(*p - '0'));
+        }
+        if (p == digits) {
+            return make_parse_result(T(), first, cast_error::invalid_format);
+        }
+
+        bool overflow = false;
+        if (budget == 0 && p != last && is_decimal_digit(*p)) {
+            // One more digit may fit; any digit after it cannot
+            accumulator digit = static_cast<accumulator>(*p - '0');
+            overflow = value > (decimal_limits<T>::max_magnitude(negative) - digit) / 10u;
+            value = static_cast<accumulator>(value * 10u + digit);
+            ++p;
+            overflow = overflow || (p != last && is_decimal_digit(*p));
+        }
+
+        if (negative && std::is_unsigned<T>::value && (overflow || value != 0)) {
+            return make_parse_result(T(), skip_decimal_digits(p, last), cast_error::negative_to_unsigned);
+        }
+        if (overflow) {
+            return make_parse_result(T(), skip_decimal_digits(p, last),
+                                     negative ? cast_error::negative_overflow : cast_error::positive_overflow);
+        }
+        return make_parse_result(negative ? negate_magnitude<T>(value) : static_cast<T>(value), p, cast_error::none);
+    }
+
+    // =========================================================================
+    // Power-of-two radix parsing (bases 2, 8 and 16)
+    // =========================================================================
+
+    /// Bits per digit of a power-of-two base
+    template<int Base>
+    struct radix_traits;
+
+    template<> struct radix_traits<2> { static const int digit_bits = 1; };
+    template<> struct radix_traits<8> { static const int digit_bits = 3; };
+    template<> struct radix_traits<16> { static const int digit_bits = 4; };
+
+    /// Digit values of the 256 byte values ('a'-'f' and 'A'-'F' are 10-15, non-digits 99)
+    struct radix_digit_table {
+        static const unsigned char* values() {
+            static const unsigned char table[256] = {
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 99, 99, 99, 99, 99, 99,
+                99, 10, 11, 12, 13, 14, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 10, 11, 12, 13, 14, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99
+            };
+            return table;
+        }
+    };
+
+    /// Digit value of c (letters in either case), 99 when c is not a digit of any base up to 16
+    inline unsigned radix_digit(char c) {
+        return radix_digit_table::values()[static_cast<unsigned char>(c)];
+    }
+
+    inline int trailing_zeros(unsigned value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(value);
+#else
+        int count = 0;
+        for (; !(value & 1u); value >>= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /// value followed by bits more bits of digits (value must have room)
+    inline std::uint64_t append_bits(std::uint64_t value, std::uint64_t digits, int bits) {
+        return (bits >= 64 ? 0 : value << bits) | digits;
+    }
+
+#if NCAST_HAS_SSSE3
+    /**
+     * @brief Shuffle control that reverses the first count bytes to the low end and zeroes the rest
+     *
+     * Loaded from offset 16 - count: byte i selects source byte count - 1 - i,
+     * so the last digit lands in byte 0 (least significant).
+     */
+    struct radix_shuffle_table {
+        static const unsigned char* reverse() {
+            static const unsigned char table[32] = {
+                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+            };
+            return table;
+        }
+    };
+
+    inline __m128i reverse_digits(__m128i digits, int count) {
+        const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+            radix_shuffle_table::reverse() + 16 - count));
+        return _mm_shuffle_epi8(digits, control);
+    }
+
+    inline int leading_run(__m128i valid) {
+        const unsigned invalid = ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xFFFFu;
+        return invalid == 0 ? 16 : trailing_zeros(invalid);
+    }
+
+    inline std::uint64_t low_64(__m128i v) {
+        std::uint64_t value;
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&value), v);
+        return value;
+    }
+
+    /**
+     * @brief Decode the run of Base digits at the start of 16 readable bytes
+     *
+     * decode() returns the run length (0 to 16) and stores the value of
+     * those digits. Digits are validated and converted 16 at a time, then
+     * reversed so the last digit is least significant and combined by
+     * multiply-adds.
+     */
+    template<int Base>
+    struct radix_block;
+
+    template<>
+    struct radix_block<16> {
+        static int decode(const char* p, std::uint64_t& value) {
+            const __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const __m128i low = _mm_and_si128(text, nibble_mask);
+            const __m128i high = _mm_and_si128(_mm_srli_epi16(text, 4), nibble_mask);
+            // Class bits by low nibble (1: 0-9, 2: 1-6) and high nibble (1: '0'-'9' row, 2: letter rows)
+            const __m128i low_classes = _mm_setr_epi8(1, 3, 3, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0);
+            const __m128i high_classes = _mm_setr_epi8(0, 0, 0, 1, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+            const __m128i classes = _mm_and_si128(_mm_shuffle_epi8(low_classes, low), _mm_shuffle_epi8(high_classes, high));
+            const int count = leading_run(_mm_xor_si128(_mm_cmpeq_epi8(classes, _mm_setzero_si128()), _mm_set1_epi8(-1)));
+
+            // Letters are their low nibble + 9
+            const __m128i letters = _mm_cmpeq_epi8(classes, _mm_set1_epi8(2));
+            const __m128i digits = reverse_digits(_mm_add_epi8(low, _mm_and_si128(letters, _mm_set1_epi8(9))), count);
+            const __m128i pairs = _mm_maddubs_epi16(digits, _mm_set1_epi16(0x1001));   // d0 + 16 * d1
+            value = low_64(_mm_packus_epi16(pairs, pairs));
+            return count;
+        }
+    };
+
+    template<>
+    struct radix_block<8> {
+        static int decode(const char* p, std::uint64_t& value) {
+            const __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const int count = leading_run(_mm_cmpeq_epi8(_mm_and_si128(text, _mm_set1_epi8(static_cast<char>(0xF8))),
+                                                         _mm_set1_epi8(0x30)));
+            const __m128i digits = reverse_digits(_mm_sub_epi8(text, _mm_set1_epi8(0x30)), count);
+            const __m128i pairs = _mm_maddubs_epi16(digits, _mm_set1_epi16(0x0801));           // 6 bits per lane
+            const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00400001));          // 12 bits per lane
+            const std::uint64_t low = low_64(quads);
+            const std::uint64_t high = low_64(_mm_unpackhi_epi64(quads, quads));
+            value = ((low & 0xFFFu) | (low >> 32) << 12) | ((high & 0xFFFu) | (high >> 32) << 12) << 24;
+            return count;
+        }
+    };
+
+    template<>
+    struct radix_block<2> {
+        static int decode(const char* p, std::uint64_t& value) {
+            const __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const int count = leading_run(_mm_cmpeq_epi8(_mm_and_si128(text, _mm_set1_epi8(static_cast<char>(0xFE))),
+                                                         _mm_set1_epi8(0x30)));
+            const __m128i ones = _mm_cmpeq_epi8(reverse_digits(text, count), _mm_set1_epi8('1'));
+            value = static_cast<std::uint64_t>(_mm_movemask_epi8(ones));
+            return count;
+        }
+    };
+#endif
+
+    /**
+     * @brief Parse an integer in base 2, 8 or 16 into T (see parse_cast)
+     *
+     * Digits are accumulated in 64 bits while their count guarantees room;
+     * longer runs are sized from the significant digit count and the
+     * leading digit's bit length before any arithmetic.
+     */
+    template<typename T, int Base>
+    parse_result<T> parse_radix(const char* first, const char* last) {
+        const int digit_bits = radix_traits<Base>::digit_bits;
+        const std::ptrdiff_t room = 64 / digit_bits;   // digits that always fit in 64 bits
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        if (negative) {
+            ++p;
+        }
+        const char* digits = p;
+
+        std::uint64_t value = 0;
+#if NCAST_HAS_SSSE3
+        while (last - p >= 16 && p - digits <= room) {
+            std::uint64_t block = 0;
+            const int count = radix_block<Base>::decode(p, block);
+            value = append_bits(value, block, count * digit_bits);
+            p += count;
+            if (count != 16) {
+                break;
+            }
+        }
+#endif
+        for (; p != last && p - digits <= room; ++p) {
+            const unsigned digit = radix_digit(*p);
+            if (digit >= static_cast<unsigned>(Base)) {
+                break;
+            }
+            value = (value << digit_bits) | digit;
+        }
+        if (p == digits) {
+            return make_parse_result(T(), first, cast_error::invalid_format);
+        }
+
+        bool overflow = false;
+        if (p - digits > room) {
+            // Too many digits to accumulate blindly: size the number from its significant digits
+            const char* significant = digits;
+            while (significant != last && *significant == '0') {
+                ++significant;
+            }
+            while (p != last && radix_digit(*p) < static_cast<unsigned>(Base)) {
+                ++p;
+            }
+            int leading_bits = 0;
+            for (unsigned d = significant != p ? radix_digit(*significant) : 0u; d != 0; d >>= 1) {
+                ++leading_bits;
+            }
+            overflow = (p - significant - 1) * digit_bits + leading_bits > 64;
+            value = 0;
+            for (const char* d = significant; !overflow && d != p; ++d) {
+                value = (value << digit_bits) | radix_digit(*d);
+            }
+        }
+        overflow = overflow
+            || value > static_cast<std::uint64_t>(decimal_limits<T>::max_magnitude(negative));
+
+        if (negative && std::is_unsigned<T>::value && (overflow || value != 0)) {
+            return make_parse_result(T(), p, cast_error::negative_to_unsigned);
+        }
+        if (overflow) {
+            return make_parse_result(T(), p, negative ? cast_error::negative_overflow : cast_error::positive_overflow);
+        }
+        return make_parse_result(negative ? negate_magnitude<T>(value) : static_cast<T>(value), p, cast_error::none);
+    }
+
+    // =========================================================================
+    // Floating-point parsing
+    // =========================================================================
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    /// float and double arithmetic is evaluated in its own precision (no x87 double rounding)
+    static const bool exact_float_evaluation = true;
+#else
+    static const bool exact_float_evaluation = false;
+#endif
+
+    /**
+     * @brief Binary layout and decimal parsing bounds of a floating-point target
+     *
+     * smallest_power_of_ten / largest_power_of_ten bound the decimal exponent
+     * beyond which any 19-digit mantissa rounds to zero / infinity. Ties can
+     * only occur for decimal exponents in [min, max]_exponent_round_to_even,
+     * except between subnormals when subnormal_ties is set (half: its
+     * subnormal midpoints are multiples of 5^25, small enough for a 19-digit
+     * mantissa).
+     * The fast path is exact when the mantissa and 10^|q| are both exact in T.
+     */
+    template<typename T>
+    struct float_format;
+
+    template<>
+    struct float_format<double> {
+        static const int mantissa_bits = 52;
+        static const int exponent_bits = 11;
+        static const int minimum_exponent = -1023;
+        static const int smallest_power_of_ten = -342;
+        static const int largest_power_of_ten = 308;
+        static const int min_exponent_round_to_even = -4;
+        static const int max_exponent_round_to_even = 23;
+        static const bool subnormal_ties = false;
+        static const bool has_fast_path = exact_float_evaluation;
+        static const int max_exponent_fast_path = 22;
+        static const std::uint64_t max_mantissa_fast_path = std::uint64_t(2) << 52;
+
+        static double exact_power_of_ten(int e) {
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+            return powers[e];
+        }
+
+        static double from_bits(std::uint64_t bits) {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    };
+
+    template<>
+    struct float_format<float> {
+        static const int mantissa_bits = 23;
+        static const int exponent_bits = 8;
+        static const int minimum_exponent = -127;
+        static const int smallest_power_of_ten = -65;
+        static const int largest_power_of_ten = 38;
+        static const int min_exponent_round_to_even = -17;
+        static const int max_exponent_round_to_even = 10;
+        static const bool subnormal_ties = false;
+        static const bool has_fast_path = exact_float_evaluation;
+        static const int max_exponent_fast_path = 10;
+        static const std::uint64_t max_mantissa_fast_path = std::uint64_t(2) << 23;
+
+        static float exact_power_of_ten(int e) {
+            static const float powers[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+            return powers[e];
+        }
+
+        static float from_bits(std::uint64_t bits) {
+            const std::uint32_t narrow = static_cast<std::uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &narrow, sizeof(value));
+            return value;
+        }
+    };
+
+    template<>
+    struct float_format<half> {
+        static const int mantissa_bits = 10;
+        static const int exponent_bits = 5;
+        static const int minimum_exponent = -15;
+        static const int smallest_power_of_ten = -27;
+        static const int largest_power_of_ten = 4;
+        static const int min_exponent_round_to_even = -22;
+        static const int max_exponent_round_to_even = 5;
+        static const bool subnormal_ties = true;
+        static const bool has_fast_path = false;
+
+        static half from_bits(std::uint64_t bits) {
+            return half::from_bits(static_cast<std::uint16_t>(bits));
+        }
+    };
+
+    /// Binary significand (implicit bit removed) and biased exponent; power2 == all ones is infinity, -1 undecided
+    struct adjusted_mantissa {
+        std::uint64_t mantissa;
+        int power2;
+
+        bool operator==(const adjusted_mantissa& other) const {
+            return mantissa == other.mantissa && power2 == other.power2;
+        }
+        bool operator!=(const adjusted_mantissa& other) const { return !(*this == other); }
+    };
+
+    inline adjusted_mantissa make_adjusted_mantissa(std::uint64_t mantissa, int power2) {
+        adjusted_mantissa result = { mantissa, power2 };
+        return result;
+    }
+
+    template<typename Format>
+    adjusted_mantissa infinite_mantissa() {
+        return make_adjusted_mantissa(0, (1 << Format::exponent_bits) - 1);
+    }
+
+    /**
+     * @brief Fixed-width multi-word unsigned integer for building the power-of-five table
+     */
+    struct table_integer {
+        static const int word_count = 56;   ///< 1792 bits, above 2^1728
+        std::uint32_t words[word_count];
+
+        table_integer() {
+            for (int i = 0; i < word_count; ++i) {
+                words[i] = 0;
+            }
+        }
+
+        static table_integer power_of_two(int exponent) {
+            table_integer result;
+            result.words[exponent / 32] = 1u << (exponent % 32);
+            return result;
+        }
+
+        void multiply(std::uint32_t factor) {
+            std::uint64_t carry = 0;
+            for (int i = 0; i < word_count; ++i) {
+                carry += static_cast<std::uint64_t>(words[i]) * factor;
+                words[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+        }
+
+        void divide(std::uint32_t divisor) {
+            std::uint64_t remainder = 0;
+            for (int i = word_count - 1; i >= 0; --i) {
+                remainder = (remainder << 32) | words[i];
+                words[i] = static_cast<std::uint32_t>(remainder / divisor);
+                remainder %= divisor;
+            }
+        }
+
+        void add_one() {
+            for (int i = 0; i < word_count && ++words[i] == 0; ++i) {
+            }
+        }
+
+        int bit_length() const {
+            for (int i = word_count - 1; i >= 0; --i) {
+                for (int bit = 31; bit >= 0; --bit) {
+                    if (words[i] >> bit) {
+                        return i * 32 + bit + 1;
+                    }
+                }
+            }
+            return 0;
+        }
+
+        table_integer shifted_right(int shift) const {
+            table_integer result;
+            const int word_shift = shift / 32;
+            const int bit_shift = shift % 32;
+            for (int i = 0; i + word_shift < word_count; ++i) {
+                std::uint64_t pair = words[i + word_shift];
+                if (i + word_shift + 1 < word_count) {
+                    pair |= static_cast<std::uint64_t>(words[i + word_shift + 1]) << 32;
+                }
+                result.words[i] = static_cast<std::uint32_t>(pair >> bit_shift);
+            }
+            return result;
+        }
+
+        /// The low 128 bits as (high, low)
+        void low_128(std::uint64_t& high, std::uint64_t& low) const {
+            low = words[0] | static_cast<std::uint64_t>(words[1]) << 32;
+            high = words[2] | static_cast<std::uint64_t>(words[3]) << 32;
+        }
+    };
+
+    /**
+     * @brief 128-bit approximations of 5^q for q in [-342, 308] (Eisel-Lemire)
+     *
+     * Positive powers are their 128 leading bits, truncated. A negative power
+     * 5^-k is floor(2^b / 5^k) + 1, truncated to 128 leading bits, with
+     * b = z + 127 for k <= 27 and b = 2z + 128 above, z being the bit length
+     * of 5^k. Built once with exact multi-word arithmetic.
+     */
+    struct power_of_five_table {
+        static const int smallest_power = -342;
+        static const int largest_power = 308;
+
+        std::uint64_t values[2 * (largest_power - smallest_power + 1)];   ///< (high, low) pairs
+
+        power_of_five_table() {
+            table_integer power = table_integer::power_of_two(0);
+            for (int q = 0; q <= largest_power; ++q) {
+                const int length = power.bit_length();
+                std::uint64_t high, low;
+                power.shifted_right(length > 128 ? length - 128 : 0).low_128(high, low);
+                if (length < 128) {
+                    const int shift = 128 - length;
+                    high = shift >= 64 ? low << (shift - 64) : (high << shift) | (low >> (64 - shift));
+                    low = shift >= 64 ? 0 : low << shift;
+                }
+                store(q, high, low);
+                power.multiply(5);
+            }
+
+            const int reciprocal_bits = 1728;
+            table_integer reciprocal = table_integer::power_of_two(reciprocal_bits);   // floor(2^1728 / 5^k)
+            table_integer divisor = table_integer::power_of_two(0);                    // 5^k
+            for (int k = 1; k <= -smallest_power; ++k) {
+                reciprocal.divide(5);
+                divisor.multiply(5);
+                const int z = divisor.bit_length();
+                const int b = k <= 27 ? z + 127 : 2 * z + 128;
+                table_integer value = reciprocal.shifted_right(reciprocal_bits - b);
+                value.add_one();
+                const int length = value.bit_length();
+                if (length > 128) {
+                    value = value.shifted_right(length - 128);
+                }
+                std::uint64_t high, low;
+                value.low_128(high, low);
+                store(-k, high, low);
+            }
+        }
+
+        void store(int q, std::uint64_t high, std::uint64_t low) {
+            values[2 * (q - smallest_power)] = high;
+            values[2 * (q - smallest_power) + 1] = low;
+        }
+
+        static const power_of_five_table& instance() {
+            static const power_of_five_table table;
+            return table;
+        }
+    };
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_type;
+#endif
+
+    /// 64 x 64 -> 128-bit product as (high, low)
+    inline void full_multiplication(std::uint64_t a, std::uint64_t b, std::uint64_t& high, std::uint64_t& low) {
+#if defined(__SIZEOF_INT128__)
+        const uint128_type product = static_cast<uint128_type>(a) * b;
+        low = static_cast<std::uint64_t>(product);
+        high = static_cast<std::uint64_t>(product >> 64);
+#else
+        const std::uint64_t a_low = a & 0xFFFFFFFFu, a_high = a >> 32;
+        const std::uint64_t b_low = b & 0xFFFFFFFFu, b_high = b >> 32;
+        const std::uint64_t low_low = a_low * b_low;
+        const std::uint64_t middle = a_low * b_high + (low_low >> 32) + ((a_high * b_low) & 0xFFFFFFFFu);
+        low = (middle << 32) | (low_low & 0xFFFFFFFFu);
+        high = a_high * b_high + (middle >> 32) + ((a_high * b_low) >> 32);
+#endif
+    }
+
+    inline int leading_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(value);
+#else
+        int count = 0;
+        for (; !(value & (std::uint64_t(1) << 63)); value <<= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief w * 10^q rounded to nearest-even in Format (Eisel-Lemire)
+     *
+     * Exact for any w of up to 19 digits: the 128-bit product with the
+     * power-of-five approximation always has enough correct bits. Subnormal
+     * results of formats with subnormal ties are left undecided.
+     */
+    template<typename Format>
+    adjusted_mantissa eisel_lemire(std::int64_t q, std::uint64_t w, const power_of_five_table& table) {
+        if (w == 0 || q < Format::smallest_power_of_ten) {
+            return make_adjusted_mantissa(0, 0);
+        }
+        if (q > Format::largest_power_of_ten) {
+            return infinite_mantissa<Format>();
+        }
+        const int lz = leading_zeros(w);
+        w <<= lz;
+
+        // mantissa_bits + 3 leading bits: the implicit bit, a rounding bit and one lost to normalization
+        const std::size_t index = static_cast<std::size_t>(2 * (q - power_of_five_table::smallest_power));
+        std::uint64_t high, low;
+        full_multiplication(w, table.values[index], high, low);
+        const std::uint64_t precision_mask = ~std::uint64_t(0) >> (Format::mantissa_bits + 3);
+        if ((high & precision_mask) == precision_mask) {
+            std::uint64_t second_high, second_low;
+            full_multiplication(w, table.values[index + 1], second_high, second_low);
+            low += second_high;
+            if (second_high > low) {
+                ++high;
+            }
+        }
+
+        const int upper_bit = static_cast<int>(high >> 63);
+        const int shift = upper_bit + 64 - Format::mantissa_bits - 3;
+        std::uint64_t mantissa = high >> shift;
+        // floor(log2(10^q)) + 63 via 217706 / 2^16 ~ log2(10)
+        int power2 = ((217706 * static_cast<int>(q)) >> 16) + 63 + upper_bit - lz - Format::minimum_exponent;
+
+        if (power2 <= 0) {
+            if (Format::subnormal_ties) {
+                return make_adjusted_mantissa(0, -1);
+            }
+            // Subnormal: no ties possible this far from q = 0
+            if (-power2 + 1 >= 64) {
+                return make_adjusted_mantissa(0, 0);
+            }
+            mantissa >>= -power2 + 1;
+            mantissa += mantissa & 1u;
+            mantissa >>= 1;
+            // Rounding may carry into the smallest normal
+            return make_adjusted_mantissa(mantissa,
+                                                  mantissa < (std::uint64_t(1) << Format::mantissa_bits) ? 0 : 1);
+        }
+
+        // An exact tie (only zeros shifted out of an exact product) rounds to even, not up
+        if (low <= 1 && q >= Format::min_exponent_round_to_even && q <= Format::max_exponent_round_to_even
+            && (mantissa & 3u) == 1u && (mantissa << shift) == high) {
+            mantissa &= ~std::uint64_t(1);
+        }
+        mantissa += mantissa & 1u;
+        mantissa >>= 1;
+        if (mantissa >= (std::uint64_t(2) << Format::mantissa_bits)) {
+            mantissa = std::uint64_t(1) << Format::mantissa_bits;
+            ++power2;
+        }
+        mantissa &= ~(std::uint64_t(1) << Format::mantissa_bits);
+        if (power2 >= (1 << Format::exponent_bits) - 1) {
+            return infinite_mantissa<Format>();
+        }
+        return make_adjusted_mantissa(mantissa, power2);
+    }
+
+    /**
+     * @brief Arbitrary decimal held digit by digit, for the exact fallback
+     *
+     * Binary scaling is done by shifting the decimal digits (the simple
+     * decimal conversion algorithm); up to 800 significant digits are kept,
+     * enough to decide the rounding of any binary64 value, and dropped
+     * nonzero digits are remembered to break ties upward.
+     */
+    struct decimal_number {
+        static const int max_digits = 800;
+        static const int max_shift = 60;
+
+        unsigned char digits[max_digits + 20];   // Room for the digits a left shift adds
+        int count;              ///< Significant digits in use
+        int decimal_point;      ///< Value is 0.d1d2d3... * 10^decimal_point
+        bool truncated;         ///< Nonzero digits were dropped
+
+        void trim() {
+            while (count > 0 && digits[count - 1] == 0) {
+                --count;
+            }
+            if (count == 0) {
+                decimal_point = 0;
+            }
+        }
+
+        void shift_right(unsigned k) {
+            int read = 0;
+            int write = 0;
+            std::uint64_t n = 0;
+            for (; (n >> k) == 0; ++read) {
+                if (read >= count) {
+                    if (n == 0) {
+                        count = 0;
+                        return;
+                    }
+                    while ((n >> k) == 0) {
+                        n *= 10u;
+                        ++read;
+                    }
+                    break;
+                }
+                n = n * 10u + digits[read];
+            }
+            decimal_point -= read - 1;
+
+            const std::uint64_t mask = (std::uint64_t(1) << k) - 1u;
+            for (; read < count; ++read) {
+                const std::uint64_t digit = n >> k;
+                n &= mask;
+                digits[write++] = static_cast<unsigned char>(digit);
+                n = n * 10u + digits[read];
+            }
+            while (n > 0) {
+                const std::uint64_t digit = n >> k;
+                n &= mask;
+                if (write < max_digits) {
+                    digits[write++] = static_cast<unsigned char>(digit);
+                } else if (digit > 0) {
+                    truncated = true;
+                }
+                n *= 10u;
+            }
+            count = write;
+            trim();
+        }
+
+        void shift_left(unsigned k) {
+            // Write right to left into the spare room, then move to the front
+            const int room = 19;   // 2^60 has 19 digits
+            int write = count + room;
+            std::uint64_t n = 0;
+            for (int read = count - 1; read >= 0; --read) {
+                n += static_cast<std::uint64_t>(digits[read]) << k;
+                digits[--write] = static_cast<unsigned char>(n % 10u);
+                n /= 10u;
+            }
+            while (n > 0) {
+                digits[--write] = static_cast<unsigned char>(n % 10u);
+                n /= 10u;
+            }
+            const int added = room - write;
+            std::memmove(digits, digits + write, static_cast<std::size_t>(count + added));
+            count += added;
+            decimal_point += added;
+            if (count > max_digits) {
+                for (int i = max_digits; i < count; ++i) {
+                    truncated = truncated || digits[i] != 0;
+                }
+                count = max_digits;
+            }
+            trim();
+        }
+
+        void shift(int k) {
+            if (count == 0) {
+                return;
+            }
+            for (; k > max_shift; k -= max_shift) {
+                shift_left(max_shift);
+            }
+            for (; k < -max_shift; k += max_shift) {
+                shift_right(max_shift);
+            }
+            if (k > 0) {
+                shift_left(static_cast<unsigned>(k));
+            } else if (k < 0) {
+                shift_right(static_cast<unsigned>(-k));
+            }
+        }
+
+        /// Integer part, rounded to nearest-even (ties with dropped digits round up)
+        std::uint64_t rounded_integer() const {
+            std::uint64_t n = 0;
+            int i = 0;
+            for (; i < decimal_point && i < count; ++i) {
+                n = n * 10u + digits[i];
+            }
+            for (; i < decimal_point; ++i) {
+                n *= 10u;
+            }
+            const int next = decimal_point;
+            if (next >= 0 && next < count) {
+                const bool round_up = digits[next] == 5 && next + 1 == count
+                    ? truncated || (next > 0 && (digits[next - 1] & 1u))
+                    : digits[next] >= 5;
+                n += round_up ? 1u : 0u;
+            }
+            return n;
+        }
+    };
+
+    /**
+     * @brief Round a decimal_number to Format by binary shifts (exact fallback)
+     */
+    template<typename Format>
+    adjusted_mantissa decimal_to_binary(decimal_number& d) {
+        static const int shift_for_digits[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };   // 2^n < 10^i
+        const int bias = Format::minimum_exponent;
+        const int max_biased_exponent = (1 << Format::exponent_bits) - 1;
+        if (d.count == 0 || d.decimal_point < -330) {
+            return make_adjusted_mantissa(0, 0);
+        }
+        if (d.decimal_point > 310) {
+            return infinite_mantissa<Format>();
+        }
+
+        // Scale into [0.5, 1)
+        int exponent = 0;
+        while (d.decimal_point > 0) {
+            const int n = d.decimal_point >= 9 ? 27 : shift_for_digits[d.decimal_point];
+            d.shift(-n);
+            exponent += n;
+        }
+        while (d.decimal_point < 0 || (d.decimal_point == 0 && d.digits[0] < 5)) {
+            const int n = -d.decimal_point >= 9 ? 27 : shift_for_digits[-d.decimal_point];
+            d.shift(n);
+            exponent -= n;
+        }
+        --exponent;   // [0.5, 1) to [1, 2)
+
+        if (exponent < bias + 1) {
+            const int n = bias + 1 - exponent;
+            d.shift(-n);
+            exponent += n;
+        }
+        if (exponent - bias >= max_biased_exponent) {
+            return infinite_mantissa<Format>();
+        }
+
+        d.shift(1 + Format::mantissa_bits);
+        std::uint64_t mantissa = d.rounded_integer();
+        if (mantissa == (std::uint64_t(2) << Format::mantissa_bits)) {
+            mantissa >>= 1;
+            ++exponent;
+            if (exponent - bias >= max_biased_exponent) {
+                return infinite_mantissa<Format>();
+            }
+        }
+        const bool subnormal = (mantissa & (std::uint64_t(1) << Format::mantissa_bits)) == 0;
+        return make_adjusted_mantissa(mantissa & ((std::uint64_t(1) << Format::mantissa_bits) - 1u),
+                                              subnormal ? 0 : exponent - bias);
+    }
+
+    /// Decimal text of a number split into its parts
+    struct float_text {
+        const char* integer_begin;
+        const char* integer_end;
+        const char* fraction_begin;
+        const char* fraction_end;
+        std::int64_t exponent;      ///< Value of the exponent part, saturated far beyond any format's range
+    };
+
+    template<typename Format>
+    adjusted_mantissa decimal_text_to_binary(const float_text& text) {
+        decimal_number d;
+        d.count = 0;
+        d.decimal_point = 0;
+        d.truncated = false;
+        for (const char* p = text.integer_begin; p != text.integer_end; ++p) {
+            if (d.count == 0 && *p == '0') {
+                continue;
+            }
+            ++d.decimal_point;
+            if (d.count < decimal_number::max_digits) {
+                d.digits[d.count++] = static_cast<unsigned char>(*p - '0');
+            } else {
+                d.truncated = d.truncated || *p != '0';
+            }
+        }
+        for (const char* p = text.fraction_begin; p != text.fraction_end; ++p) {
+            if (d.count == 0 && *p == '0') {
+                --d.decimal_point;
+                continue;
+            }
+            if (d.count < decimal_number::max_digits) {
+                d.digits[d.count++] = static_cast<unsigned char>(*p - '0');
+            } else {
+                d.truncated = d.truncated || *p != '0';
+            }
+        }
+        const std::int64_t decimal_point = d.decimal_point + text.exponent;
+        d.decimal_point = static_cast<int>(decimal_point < -100000 ? -100000 : decimal_point > 100000 ? 100000 : decimal_point);
+        d.trim();
+        return decimal_to_binary<Format>(d);
+    }
+
+    /// T from a sign and an adjusted mantissa
+    template<typename T>
+    T make_float(bool negative, adjusted_mantissa value) {
+        typedef float_format<T> format;
+        std::uint64_t bits = value.mantissa | static_cast<std::uint64_t>(value.power2) << format::mantissa_bits;
+        if (negative) {
+            bits |= std::uint64_t(1) << (format::mantissa_bits + format::exponent_bits);
+        }
+        return format::from_bits(bits);
+    }
+
+    /// Exact w * 10^q in T arithmetic when w and 10^|q| are exact in T (Clinger)
+    template<typename T, bool HasFastPath = float_format<T>::has_fast_path>
+    struct float_fast_path {
+        static bool apply(std::int64_t, std::uint64_t, bool, T&) { return false; }
+    };
+
+    template<typename T>
+    struct float_fast_path<T, true> {
+        static bool apply(std::int64_t q, std::uint64_t w, bool negative, T& value) {
+            typedef float_format<T> format;
+            if (q < -format::max_exponent_fast_path || q > format::max_exponent_fast_path
+                || w > format::max_mantissa_fast_path) {
+                return false;
+            }
+            value = static_cast<T>(w);
+            value = q < 0 ? value / format::exact_power_of_ten(static_cast<int>(-q))
+                          : value * format::exact_power_of_ten(static_cast<int>(q));
+            value = negative ? -value : value;
+            return true;
+        }
+    };
+
+    inline bool matches_word(const char* first, const char* last, const char* lower_case_word) {
+        for (; *lower_case_word; ++first, ++lower_case_word) {
+            if (first == last || (*first | 0x20) != *lower_case_word) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// "inf", "infinity" and "nan" with an optional "(chars)", case-insensitive, after the sign
+    template<typename T>
+    parse_result<T> parse_float_special(const char* first, const char* p, const char* last, bool negative) {
+        typedef float_format<T> format;
+        const std::uint64_t infinity_bits = static_cast<std::uint64_t>((1 << format::exponent_bits) - 1)
+                                          << format::mantissa_bits;
+        const std::uint64_t sign_bit = negative ? std::uint64_t(1) << (format::mantissa_bits + format::exponent_bits) : 0;
+        if (matches_word(p, last, "inf")) {
+            p += matches_word(p, last, "infinity") ? 8 : 3;
+            return make_parse_result(format::from_bits(infinity_bits | sign_bit), p, cast_error::none);
+        }
+        if (matches_word(p, last, "nan")) {
+            p += 3;
+            if (p != last && *p == '(') {
+                const char* close = p + 1;
+                while (close != last && (is_decimal_digit(*close) || *close == '_'
+                                         || static_cast<unsigned>((*close | 0x20) - 'a') < 26u)) {
+                    ++close;
+                }
+                if (close != last && *close == ')') {
+                    p = close + 1;
+                }
+            }
+            const std::uint64_t quiet_bit = std::uint64_t(1) << (format::mantissa_bits - 1);
+            return make_parse_result(format::from_bits(infinity_bits | quiet_bit | sign_bit), p, cast_error::none);
+        }
+        return make_parse_result(T(), first, cast_error::invalid_format);
+    }
+
+    /**
+     * @brief The first 19 significant digits of a longer mantissa as w * 10^q
+     *
+     * truncated is set when a dropped digit is nonzero.
+     */
+    inline void leading_significant_digits(const float_text& text, std::uint64_t& w, std::int64_t& q, bool& truncated) {
+        w = 0;
+        q = text.exponent;
+        int digits = 0;
+        const char* d = text.integer_begin;
+        while (d != text.integer_end && *d == '0') {
+            ++d;
+        }
+        for (; d != text.integer_end; ++d) {
+            if (digits < 19) {
+                w = w * 10u + static_cast<std::uint64_t>(*d - '0');
+                ++digits;
+            } else {
+                ++q;
+                truncated = truncated || *d != '0';
+            }
+        }
+        d = text.fraction_begin;
+        if (digits == 0) {
+            for (; d != text.fraction_end && *d == '0'; ++d) {
+                --q;
+            }
+        }
+        for (; d != text.fraction_end; ++d) {
+            if (digits < 19) {
+                w = w * 10u + static_cast<std::uint64_t>(*d - '0');
+                ++digits;
+                --q;
+            } else {
+                truncated = truncated || *d != '0';
+            }
+        }
+    }
+
+    /**
+     * @brief Parse a decimal floating-point number into T (see parse_cast)
+     */
+    template<typename T>
+    parse_result<T> parse_float(const char* first, const char* last) {
+        typedef float_format<T> format;
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        if (negative) {
+            ++p;
+        }
+
+        // One pass: accumulate every mantissa digit (w wraps past 19 digits and
+        // is then rebuilt), taking fraction digits 8 at a time
+        float_text text;
+        std::uint64_t w = 0;
+        text.integer_begin = p;
+        for (; p != last && is_decimal_digit(*p); ++p) {
+            w = w * 10u + static_cast<std::uint64_t>(*p - '0');
+        }
+        text.integer_end = text.fraction_begin = text.fraction_end = p;
+        if (p != last && *p == '.') {
+            text.fraction_begin = ++p;
+            for (; last - p >= 8; p += 8) {
+                const std::uint64_t chunk = load_swar_chunk(p);
+                if (!is_swar_digits(chunk)) {
+                    break;
+                }
+                w = w * 100000000u + swar_digits_value(chunk);
+            }
+            for (; p != last && is_decimal_digit(*p); ++p) {
+                w = w * 10u + static_cast<std::uint64_t>(*p - '0');
+            }
+            text.fraction_end = p;
+        }
+        const std::ptrdiff_t digit_count = (text.integer_end - text.integer_begin) + (text.fraction_end - text.fraction_begin);
+        if (digit_count == 0) {
+            return parse_float_special<T>(first, text.integer_begin, last, negative);
+        }
+
+        // The exponent is consumed only when it has digits
+        text.exponent = 0;
+        if (p != last && (*p | 0x20) == 'e') {
+            const char* e = p + 1;
+            const bool negative_exponent = e != last && *e == '-';
+            if (e != last && (*e == '-' || *e == '+')) {
+                ++e;
+            }
+            if (e != last && is_decimal_digit(*e)) {
+                for (; e != last && is_decimal_digit(*e); ++e) {
+                    if (text.exponent < 100000000) {
+                        text.exponent = text.exponent * 10 + (*e - '0');
+                    }
+                }
+                text.exponent = negative_exponent ? -text.exponent : text.exponent;
+                p = e;
+            }
+        }
+
+        std::int64_t q = text.exponent - (text.fraction_end - text.fraction_begin);
+        bool truncated = false;
+        if (digit_count > 19) {
+            leading_significant_digits(text, w, q, truncated);
+        }
+
+        if (w == 0) {
+            return make_parse_result(make_float<T>(negative, make_adjusted_mantissa(0, 0)), p, cast_error::none);
+        }
+        T value = T();
+        if (!truncated && float_fast_path<T>::apply(q, w, negative, value)) {
+            return make_parse_result(value, p, cast_error::none);
+        }
+
+        const power_of_five_table& table = power_of_five_table::instance();
+        adjusted_mantissa rounded = eisel_lemire<format>(q, w, table);
+        if (rounded.power2 < 0 || (truncated && rounded != eisel_lemire<format>(q, w + 1u, table))) {
+            // Undecided, or the dropped digits decide the rounding
+            rounded = decimal_text_to_binary<format>(text);
+        }
+
+        if (rounded.power2 == (1 << format::exponent_bits) - 1) {
+            return make_parse_result(T(), p, negative ? cast_error::negative_overflow : cast_error::positive_overflow);
+        }
+        if (rounded.power2 == 0 && rounded.mantissa == 0) {
+            return make_parse_result(T(), p, cast_error::underflow);
+        }
+        return make_parse_result(make_float<T>(negative, rounded), p, cast_error::none);
+    }
+
+    /// Integral targets parse exactly, floating-point targets round to nearest
+    template<typename T, int Base, bool IsIntegral = std::is_integral<T>::value>
+    struct parse_dispatch {
+        static parse_result<T> parse(const char* first, const char* last) {
+            return parse_radix<T, Base>(first, last);
+        }
+    };
+
+    template<typename T>
+    struct parse_dispatch<T, 10, true> {
+        static NCAST_CONSTEXPR_14 parse_result<T> parse(const char* first, const char* last) {
+            return parse_decimal<T>(first, last);
+        }
+    };
+
+    template<typename T>
+    struct parse_dispatch<T, 10, false> {
+        static parse_result<T> parse(const char* first, const char* last) {
+            return parse_float<T>(first, last);
+        }
+    };
+
+    template<typename T>
+    struct is_parse_float_type : std::false_type {};
+
+    template<> struct is_parse_float_type<float> : std::true_type {};
+    template<> struct is_parse_float_type<double> : std::true_type {};
+    template<> struct is_parse_float_type<half> : std::true_type {};
+
+} // namespace detail
+
+/**
+ * @brief Parse a number from [first, last) directly into T
+ *
+ * Integral targets are parsed exactly (decimal parsing is constexpr in
+ * C++14+); float, double and half are rounded to nearest-even. Integral
+ * targets also accept Base 2, 8 and 16 (digits only, no "0x" / "0b" prefix;
+ * hexadecimal letters in either case).
+ *
+ * @tparam T Target type: integral (not bool), float, double or half
+ * @tparam Base 10, or 2, 8 or 16 for integral T
+ * @param first Start of the text
+ * @param last End of the text
+ * @return Value, first unconsumed character and cast_error::none, or the failure reason
+ */
+template<typename T, int Base = 10>
+NCAST_CONSTEXPR_14 parse_result<T> parse_cast(const char* first, const char* last) {
+    static_assert((std::is_integral<T>::value && !std::is_same<T, bool>::value) || detail::is_parse_float_type<T>::value,
+                  "parse_cast requires an integral, float, double or half target type");
+    static_assert(Base == 10 || (std::is_integral<T>::value && (Base == 2 || Base == 8 || Base == 16)),
+                  "parse_cast supports base 10, and bases 2, 8 and 16 for integral target types");
+    return detail::parse_dispatch<T, Base>::parse(first, last);
+}
+
+} // namespace ncast
+
+#endif // NCAST_PARSE_H
@@ -0,0 +1,419 @@
+#ifndef NCAST_POLICY_H
+#define NCAST_POLICY_H
+
+/**
+ * @file ncast_policy.h
+ * @brief Bulk conversion with compile-time replacement policies per error kind
+ *
+ * convert_with_policy<Policy>() never fails: every element that numeric_cast
+ * would reject is replaced according to Policy, chosen separately for each
+ * cast_error kind the validator reports (positive_overflow, negative_overflow,
+ * negative_to_unsigned, nan, infinity). Replacement actions:
+ * - replace::saturate       nearest bound of the target (0 for NaN); the default
+ * - replace::with_default   To()
+ * - replace::with_lowest / replace::with_max
+ * - replace::with_value<T, V>    sentinel V of type T
+ * - replace::with_constant<C>    sentinel C::value (e.g. a floating-point constant)
+ * - replace::with_nan       quiet NaN (floating-point targets)
+ *
+ * The element loop classifies values with comparisons and picks the result
+ * with selects, never branches, so compilers turn it into vector compares and
+ * blends. replace_policy<> (all saturate) matches saturate_cast.
+ *
+ * A sentinel must fit the target type exactly (no overflow, no fraction for
+ * integral targets); one that does not is a compile-time error, raised only
+ * for error kinds the type pair can produce.
+ * replace_cast<Policy, To>(value) applies a policy to a single value.
+ *
+ * @code
+ * #include <ncast/ncast_policy.h>
+ *
+ * // To std::uint16_t: NaN -> 0xFFFE sentinel, overflow saturates, negative -> 0xFFFF marker
+ * typedef ncast::replace_policy<>::on_nan<ncast::replace::with_value<std::uint16_t, 0xFFFE> >
+ *                              ::on_negative_to_unsigned<ncast::replace::with_value<std::uint16_t, 0xFFFF> > Policy;
+ * std::size_t replaced = ncast::convert_with_policy<Policy>(src, n, dst);
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ncast {
+
+namespace detail {
+
+    /**
+     * @brief Compile-time check that a sentinel value fits ToType exactly
+     *
+     * Integral targets take values inside their range without a fraction;
+     * floating-point targets take finite values inside their range, NaN and infinity.
+     */
+    template<typename ToType, typename T,
+             bool IsFloatSentinel = std::is_floating_point<T>::value,
+             bool IsFloatTarget = std::is_floating_point<ToType>::value>
+    struct sentinel_fits;
+
+    template<typename ToType, typename T>
+    struct sentinel_fits<ToType, T, false, false> {
+        static constexpr bool check(T value) {
+            return value < T(0)
+                ? (std::is_signed<ToType>::value &&
+                   static_cast<std::intmax_t>(value) >= static_cast<std::intmax_t>(std::numeric_limits<ToType>::lowest()))
+                : static_cast<std::uintmax_t>(value) <= static_cast<std::uintmax_t>(std::numeric_limits<ToType>::max());
+        }
+    };
+
+    template<typename ToType, typename T>
+    struct sentinel_fits<ToType, T, false, true> {
+        static constexpr bool check(T) { return true; }
+    };
+
+    template<typename ToType, typename T>
+    struct sentinel_fits<ToType, T, true, false> {
+        static constexpr bool check(T value) {
+            return value == value && !float_upper_limit<ToType, T>::exceeds(value) &&
+                   value >= static_cast<T>(std::numeric_limits<ToType>::lowest()) &&
+                   static_cast<T>(static_cast<ToType>(value)) == value;
+        }
+    };
+
+    template<typename ToType, typename T>
+    struct sentinel_fits<ToType, T, true, true> {
+        static constexpr bool check(T value) {
+            return value != value ||
+                   value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity() ||
+                   (static_cast<widening_float_type>(value) <= static_cast<widening_float_type>(std::numeric_limits<ToType>::max()) &&
+                    static_cast<widening_float_type>(value) >= static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest()));
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief Replacement actions for replace_policy
+ *
+ * Each action provides value<To>(kind, negative): the replacement for an
+ * element failing with kind; negative tells the sign for overflow and infinity.
+ */
+namespace replace {
+
+    /// Nearest bound of the target type; NaN becomes 0
+    struct saturate {
+        template<typename To>
+        static To value(cast_error kind, bool negative) {
+            if (kind == cast_error::nan) return To(0);
+            return negative ? std::numeric_limits<To>::lowest() : std::numeric_limits<To>::max();
+        }
+    };
+
+    /// Value-initialized target (0)
+    struct with_default {
+        template<typename To>
+        static To value(cast_error, bool) { return To(); }
+    };
+
+    /// Lowest value of the target type
+    struct with_lowest {
+        template<typename To>
+        static To value(cast_error, bool) { return std::numeric_limits<To>::lowest(); }
+    };
+
+    /// Largest value of the target type
+    struct with_max {
+        template<typename To>
+        static To value(cast_error, bool) { return std::numeric_limits<To>::max(); }
+    };
+
+    /// Fixed sentinel V of type T (e.g. with_value<std::uint64_t, ~0ull>); must fit the target
+    template<typename T, T V>
+    struct with_value {
+        template<typename To>
+        static To value(cast_error, bool) {
+            static_assert(detail::sentinel_fits<To, T>::check(V), "replace::with_value sentinel does not fit the target type");
+            return static_cast<To>(V);
+        }
+    };
+
+    /// Fixed sentinel Constant::value, a static constexpr member of any arithmetic type; must fit the target
+    template<typename Constant>
+    struct with_constant {
+        template<typename To>
+        static To value(cast_error, bool) {
+            typedef typename std::remove_cv<decltype(Constant::value)>::type value_type;
+            static_assert(detail::sentinel_fits<To, value_type>::check(Constant::value),
+                          "replace::with_constant sentinel does not fit the target type");
+            return static_cast<To>(Constant::value);
+        }
+    };
+
+    /// Quiet NaN, for floating-point targets
+    struct with_nan {
+        template<typename To>
+        static To value(cast_error, bool) {
+            static_assert(std::numeric_limits<To>::has_quiet_NaN, "replace::with_nan requires a floating-point target");
+            return std::numeric_limits<To>::quiet_NaN();
+        }
+    };
+
+} // namespace replace
+
+/**
+ * @brief Compile-time replacement policy: one action per cast_error kind
+ *
+ * Build policies from the defaults with the on_* aliases, e.g.
+ * replace_policy<>::on_nan<replace::with_default>::on_overflow<replace::with_value<int, -1> >
+ * for a signed target. A sentinel must fit the target type.
+ */
+template<typename OnPositiveOverflow = replace::saturate,
+         typename OnNegativeOverflow = replace::saturate,
+         typename OnNegativeToUnsigned = replace::saturate,
+         typename OnNaN = replace::saturate,
+         typename OnInfinity = replace::saturate>
+struct replace_policy {
+    typedef OnPositiveOverflow positive_overflow;
+    typedef OnNegativeOverflow negative_overflow;
+    typedef OnNegativeToUnsigned negative_to_unsigned;
+    typedef OnNaN nan;
+    typedef OnInfinity infinity;
+
+    template<typename Action>
+    using on_positive_overflow = replace_policy<Action, OnNegativeOverflow, OnNegativeToUnsigned, OnNaN, OnInfinity>;
+    template<typename Action>
+    using on_negative_overflow = replace_policy<OnPositiveOverflow, Action, OnNegativeToUnsigned, OnNaN, OnInfinity>;
+    /// Both overflow directions
+    template<typename Action>
+    using on_overflow = replace_policy<Action, Action, OnNegativeToUnsigned, OnNaN, OnInfinity>;
+    template<typename Action>
+    using on_negative_to_unsigned = replace_policy<OnPositiveOverflow, OnNegativeOverflow, Action, OnNaN, OnInfinity>;
+    template<typename Action>
+    using on_nan = replace_policy<OnPositiveOverflow, OnNegativeOverflow, OnNegativeToUnsigned, Action, OnInfinity>;
+    template<typename Action>
+    using on_infinity = replace_policy<OnPositiveOverflow, OnNegativeOverflow, OnNegativeToUnsigned, OnNaN, Action>;
+};
+
+namespace detail {
+
+    /**
+     * @brief Replacement values of a policy, evaluated once per conversion
+     */
+    template<typename ToType>
+    struct replacement_values {
+        ToType positive_overflow;
+        ToType below_min;           ///< negative_overflow, or negative_to_unsigned for signed -> unsigned integers
+        ToType nan;
+        ToType positive_infinity;
+        ToType negative_infinity;
+    };
+
+    // Replacement of an action, instantiated only for error kinds the type pair can produce
+    // (so a sentinel that does not fit an impossible kind is not an error)
+    template<typename Action, typename ToType>
+    ToType replacement_value(std::true_type, cast_error kind, bool negative) {
+        return Action::template value<ToType>(kind, negative);
+    }
+
+    template<typename Action, typename ToType>
+    ToType replacement_value(std::false_type, cast_error, bool) {
+        return ToType();
+    }
+
+    /**
+     * @brief Which overflow directions a type pair can produce, at compile time
+     *
+     * Integral pairs use integral_range_limits; a floating-point source
+     * overflows any integral target, other built-in pairs compare lowest/max.
+     * Extension types (e.g. half) are assumed to overflow both ways.
+     */
+    template<typename ToType, typename FromType,
+             bool IsIntegralPair = std::is_integral<ToType>::value && std::is_integral<FromType>::value,
+             bool IsBuiltinPair = std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value>
+    struct possible_overflow {
+        static const bool above_max = true;
+        static const bool below_min = true;
+    };
+
+    template<typename ToType, typename FromType>
+    struct possible_overflow<ToType, FromType, false, true> {
+        static const bool float_to_integral = std::is_floating_point<FromType>::value && !std::is_floating_point<ToType>::value;
+        static const bool above_max = float_to_integral ||
+            static_cast<widening_float_type>(std::numeric_limits<FromType>::max()) >
+            static_cast<widening_float_type>(std::numeric_limits<ToType>::max());
+        static const bool below_min = float_to_integral ||
+            static_cast<widening_float_type>(std::numeric_limits<FromType>::lowest()) <
+            static_cast<widening_float_type>(std::numeric_limits<ToType>::lowest());
+    };
+
+    template<typename ToType, typename FromType>
+    struct possible_overflow<ToType, FromType, true, true> {
+        static const bool above_max = integral_range_limits<ToType, FromType>::can_exceed_max;
+        static const bool below_min = integral_range_limits<ToType, FromType>::can_go_below_min;
+    };
+
+    template<typename Policy, typename ToType, typename FromType>
+    replacement_values<ToType> make_replacement_values() {
+        typedef std::integral_constant<bool, is_float_type<FromType>::value && !is_float_type<ToType>::value> float_to_integral;
+        typedef std::integral_constant<bool, std::is_integral<FromType>::value && std::is_signed<FromType>::value &&
+                                             std::is_unsigned<ToType>::value> negative_to_unsigned;
+        typedef std::integral_constant<bool, possible_overflow<ToType, FromType>::above_max> above_max;
+        typedef std::integral_constant<bool, possible_overflow<ToType, FromType>::below_min> below_min;
+        typedef std::integral_constant<bool, below_min::value && negative_to_unsigned::value> below_min_unsigned;
+        typedef std::integral_constant<bool, below_min::value && !negative_to_unsigned::value> below_min_signed;
+        replacement_values<ToType> values;
+        values.positive_overflow = replacement_value<typename Policy::positive_overflow, ToType>(
+            above_max(), cast_error::positive_overflow, false);
+        values.below_min = negative_to_unsigned::value
+            ? replacement_value<typename Policy::negative_to_unsigned, ToType>(below_min_unsigned(), cast_error::negative_to_unsigned, true)
+            : replacement_value<typename Policy::negative_overflow, ToType>(below_min_signed(), cast_error::negative_overflow, true);
+        values.nan = replacement_value<typename Policy::nan, ToType>(float_to_integral(), cast_error::nan, false);
+        values.positive_infinity = replacement_value<typename Policy::infinity, ToType>(
+            float_to_integral(), cast_error::infinity, false);
+        values.negative_infinity = replacement_value<typename Policy::infinity, ToType>(
+            float_to_integral(), cast_error::infinity, true);
+        return values;
+    }
+
+    /**
+     * @brief Branch-free conversion of one block with replacement; returns the number replaced
+     *
+     * Failing values are swapped for zero before the static_cast, so no
+     * out-of-range value is converted; results are picked with selects.
+     * Classification matches element_check / numeric_cast_validator.
+     */
+    template<typename ToType, typename FromType,
+             bool IsFromFloatingPoint = is_float_type<FromType>::value,
+             bool IsToFloatingPoint = is_float_type<ToType>::value>
+    struct replace_block;
+
+    // Integral source: overflow in either direction
+    template<typename ToType, typename FromType, bool IsToFloatingPoint>
+    struct replace_block<ToType, FromType, false, IsToFloatingPoint> {
+        static unsigned convert(const FromType* src, std::size_t count, ToType* dst,
+                                const replacement_values<ToType>& r) {
+            unsigned replaced = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                FromType value = src[i];
+                bool over = range_limits<ToType, FromType>::exceeds_max(value);
+                bool under = range_limits<ToType, FromType>::below_min(value);
+                ToType out = static_cast<ToType>((over | under) ? FromType(0) : value);
+                out = over ? r.positive_overflow : out;
+                out = under ? r.below_min : out;
+                dst[i] = out;
+                replaced += static_cast<unsigned>(over | under);
+            }
+            return replaced;
+        }
+    };
+
+    // Floating-point source, integral target: NaN, infinity and overflow are replaced
+    template<typename ToType, typename FromType>
+    struct replace_block<ToType, FromType, true, false> {
+        static unsigned convert(const FromType* src, std::size_t count, ToType* dst,
+                                const replacement_values<ToType>& r) {
+            const FromType infinity = std::numeric_limits<FromType>::infinity();
+            unsigned replaced = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                FromType value = src[i];
+                bool is_nan = !(value == value);
+                bool is_inf = (value == infinity) | (value == -infinity);
+                bool over = range_limits<ToType, FromType>::exceeds_max(value);   // includes +infinity
+                bool under = range_limits<ToType, FromType>::below_min(value);    // includes -infinity
+                ToType out = static_cast<ToType>((is_nan | over | under) ? FromType(0) : value);
+                out = over ? (is_inf ? r.positive_infinity : r.positive_overflow) : out;
+                out = under ? (is_inf ? r.negative_infinity : r.below_min) : out;
+                out = is_nan ? r.nan : out;
+                dst[i] = out;
+                replaced += static_cast<unsigned>(is_nan | over | under);
+            }
+            return replaced;
+        }
+    };
+
+    // Floating-point source and target: only finite overflow is replaced, NaN and infinity pass.
+    // Sanitize, convert and replace run as separate passes over the block: when the
+    // conversion feeds a select, GCC (trapping math) sinks it into a branch and keeps the loop scalar.
+    template<typename ToType, typename FromType>
+    struct replace_block<ToType, FromType, true, true> {
+        static bool overflows(FromType value, bool& over, bool& under) {
+            const FromType infinity = std::numeric_limits<FromType>::infinity();
+            bool is_inf = (value == infinity) | (value == -infinity);
+            over = range_limits<ToType, FromType>::exceeds_max(value) & !is_inf;
+            under = range_limits<ToType, FromType>::below_min(value) & !is_inf;
+            return over | under;
+        }
+
+        static unsigned convert(const FromType* src, std::size_t count, ToType* dst,
+                                const replacement_values<ToType>& r) {
+            FromType sanitized[bulk_block_size];
+            for (std::size_t i = 0; i < count; ++i) {
+                bool over, under;
+                sanitized[i] = overflows(src[i], over, under) ? FromType(0) : src[i];
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                dst[i] = static_cast<ToType>(sanitized[i]);
+            }
+            const ToType positive_overflow = r.positive_overflow;
+            const ToType below_min = r.below_min;
+            unsigned replaced = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                bool over, under;
+                replaced += static_cast<unsigned>(overflows(src[i], over, under));
+                ToType out = dst[i];
+                out = over ? positive_overflow : out;
+                out = under ? below_min : out;
+                dst[i] = out;
+            }
+            return replaced;
+        }
+    };
+
+    /// One value with replacement values evaluated beforehand (see make_replacement_values)
+    template<typename ToType, typename FromType>
+    ToType replace_value(FromType value, const replacement_values<ToType>& r) {
+        ToType out;
+        replace_block<ToType, FromType>::convert(&value, 1, &out, r);
+        return out;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert an array, replacing every element numeric_cast would reject
+ *
+ * @tparam Policy replace_policy<...> choosing the replacement per error kind
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @return Number of replaced elements
+ */
+template<typename Policy, typename ToType, typename FromType>
+std::size_t convert_with_policy(const FromType* src, std::size_t count, ToType* dst) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "convert_with_policy requires built-in arithmetic types");
+    const detail::replacement_values<ToType> values = detail::make_replacement_values<Policy, ToType, FromType>();
+    std::size_t replaced = 0;
+
+    // The per-block counter stays small enough for a 32-bit vector accumulator
+    for (std::size_t base = 0; base < count; base += detail::bulk_block_size) {
+        std::size_t n = count - base < detail::bulk_block_size ? count - base : detail::bulk_block_size;
+        replaced += detail::replace_block<ToType, FromType>::convert(src + base, n, dst + base, values);
+    }
+    return replaced;
+}
+
+/**
+ * @brief Convert one value, replacing it according to Policy if numeric_cast would reject it
+ */
+template<typename Policy, typename ToType, typename FromType>
+ToType replace_cast(FromType value) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "replace_cast requires built-in arithmetic types");
+    return detail::replace_value(value, detail::make_replacement_values<Policy, ToType, FromType>());
+}
+
+} // namespace ncast
+
+#endif // NCAST_POLICY_H
@@ -0,0 +1,452 @@
+#ifndef NCAST_RANGE_H
+#define NCAST_RANGE_H
+
+/**
+ * @file ncast_range.h
+ * @brief Single-pass range analysis of numeric arrays
+ *
+ * analyze_range() scans an array once and reports its minimum, maximum and
+ * the presence of NaN, infinity and negative values. fits_in<To>() answers
+ * whether every element would pass numeric_cast<To> using the same limit
+ * checks as the numeric_cast validators, so a column can be validated once
+ * and then copied with a plain static_cast (see convert_if_fits()).
+ *
+ * Scans use AVX2 (all integer widths, float, double) or SSE2 (float, double)
+ * when available and a scalar loop otherwise.
+ *
+ * @code
+ * #include <ncast/ncast_range.h>
+ *
+ * ncast::range_stats<std::int64_t> stats = ncast::analyze_range(ids, n);
+ * if (ncast::fits_in<std::int32_t>(stats)) {
+ *     // every element passes numeric_cast<std::int32_t>
+ * }
+ *
+ * if (!ncast::convert_if_fits(ids, n, ids32)) {
+ *     // some value does not fit, nothing was written
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace ncast {
+
+/**
+ * @brief Result of analyze_range()
+ *
+ * min and max cover finite values only; NaN and infinity are reported by
+ * the flags. When there are no finite values (empty input, or only NaN and
+ * infinity) min > max and empty() returns true.
+ */
+template<typename T>
+struct range_stats {
+    std::size_t count;      ///< Number of elements analyzed
+    T min;                  ///< Smallest finite value
+    T max;                  ///< Largest finite value
+    bool has_nan;           ///< At least one NaN
+    bool has_inf;           ///< At least one positive or negative infinity
+    bool has_negative;      ///< At least one value below zero (-0.0 is not negative)
+
+    bool empty() const { return !(min <= max); }
+};
+
+namespace detail {
+
+    template<typename T>
+    range_stats<T> make_empty_range_stats(std::size_t count) {
+        range_stats<T> stats;
+        stats.count = count;
+        stats.min = std::numeric_limits<T>::max();
+        stats.max = std::numeric_limits<T>::lowest();
+        stats.has_nan = false;
+        stats.has_inf = false;
+        stats.has_negative = false;
+        return stats;
+    }
+
+    /**
+     * @brief Scalar scan of integral values, merged into stats
+     */
+    template<typename T>
+    typename std::enable_if<!std::is_floating_point<T>::value>::type
+    scan_range_scalar(const T* data, std::size_t count, range_stats<T>& stats) {
+        T lo = stats.min;
+        T hi = stats.max;
+        for (std::size_t i = 0; i < count; ++i) {
+            lo = data[i] < lo ? data[i] : lo;
+            hi = data[i] > hi ? data[i] : hi;
+        }
+        stats.min = lo;
+        stats.max = hi;
+        stats.has_negative = stats.has_negative || lo < T(0);
+    }
+
+    /**
+     * @brief Scalar scan of floating-point values, merged into stats
+     */
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    scan_range_scalar(const T* data, std::size_t count, range_stats<T>& stats) {
+        for (std::size_t i = 0; i < count; ++i) {
+            T value = data[i];
+            if (std::isnan(value)) {
+                stats.has_nan = true;
+                continue;
+            }
+            if (value < T(0)) {
+                stats.has_negative = true;
+            }
+            if (std::isinf(value)) {
+                stats.has_inf = true;
+                continue;
+            }
+            stats.min = value < stats.min ? value : stats.min;
+            stats.max = value > stats.max ? value : stats.max;
+        }
+    }
+
+#if NCAST_HAS_SSE2
+    /**
+     * @brief Floating-point vector operations used by the range scan kernel
+     */
+    struct sse2_float_range_ops {
+        typedef float value_type;
+        typedef __m128 vec;
+        static const std::size_t lanes = 4;
+        static vec load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, vec v) { _mm_storeu_ps(p, v); }
+        static vec set1(float v) { return _mm_set1_ps(v); }
+        static vec abs(vec v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+        static vec lt(vec a, vec b) { return _mm_cmplt_ps(a, b); }
+        static vec eq(vec a, vec b) { return _mm_cmpeq_ps(a, b); }
+        static vec unordered(vec v) { return _mm_cmpunord_ps(v, v); }
+        static vec select(vec mask, vec a, vec b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+        static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+        static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+        static vec bit_or(vec a, vec b) { return _mm_or_ps(a, b); }
+        static bool any(vec mask) { return _mm_movemask_ps(mask) != 0; }
+    };
+
+    struct sse2_double_range_ops {
+        typedef double value_type;
+        typedef __m128d vec;
+        static const std::size_t lanes = 2;
+        static vec load(const double* p) { return _mm_loadu_pd(p); }
+        static void store(double* p, vec v) { _mm_storeu_pd(p, v); }
+        static vec set1(double v) { return _mm_set1_pd(v); }
+        static vec abs(vec v) { return _mm_andnot_pd(_mm_set1_pd(-0.0), v); }
+        static vec lt(vec a, vec b) { return _mm_cmplt_pd(a, b); }
+        static vec eq(vec a, vec b) { return _mm_cmpeq_pd(a, b); }
+        static vec unordered(vec v) { return _mm_cmpunord_pd(v, v); }
+        static vec select(vec mask, vec a, vec b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+        static vec min(vec a, vec b) { return _mm_min_pd(a, b); }
+        static vec max(vec a, vec b) { return _mm_max_pd(a, b); }
+        static vec bit_or(vec a, vec b) { return _mm_or_pd(a, b); }
+        static bool any(vec mask) { return _mm_movemask_pd(mask) != 0; }
+    };
+#endif // NCAST_HAS_SSE2
+
+#if NCAST_HAS_AVX2
+    struct avx2_float_range_ops {
+        typedef float value_type;
+        typedef __m256 vec;
+        static const std::size_t lanes = 8;
+        static vec load(const float* p) { return _mm256_loadu_ps(p); }
+        static void store(float* p, vec v) { _mm256_storeu_ps(p, v); }
+        static vec set1(float v) { return _mm256_set1_ps(v); }
+        static vec abs(vec v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+        static vec lt(vec a, vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static vec eq(vec a, vec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        static vec unordered(vec v) { return _mm256_cmp_ps(v, v, _CMP_UNORD_Q); }
+        static vec select(vec mask, vec a, vec b) { return _mm256_blendv_ps(b, a, mask); }
+        static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+        static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+        static vec bit_or(vec a, vec b) { return _mm256_or_ps(a, b); }
+        static bool any(vec mask) { return _mm256_movemask_ps(mask) != 0; }
+    };
+
+    struct avx2_double_range_ops {
+        typedef double value_type;
+        typedef __m256d vec;
+        static const std::size_t lanes = 4;
+        static vec load(const double* p) { return _mm256_loadu_pd(p); }
+        static void store(double* p, vec v) { _mm256_storeu_pd(p, v); }
+        static vec set1(double v) { return _mm256_set1_pd(v); }
+        static vec abs(vec v) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v); }
+        static vec lt(vec a, vec b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static vec eq(vec a, vec b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        static vec unordered(vec v) { return _mm256_cmp_pd(v, v, _CMP_UNORD_Q); }
+        static vec select(vec mask, vec a, vec b) { return _mm256_blendv_pd(b, a, mask); }
+        static vec min(vec a, vec b) { return _mm256_min_pd(a, b); }
+        static vec max(vec a, vec b) { return _mm256_max_pd(a, b); }
+        static vec bit_or(vec a, vec b) { return _mm256_or_pd(a, b); }
+        static bool any(vec mask) { return _mm256_movemask_pd(mask) != 0; }
+    };
+
+    /**
+     * @brief Integer min/max on 256-bit vectors, by lane width and signedness
+     *
+     * AVX2 has no 64-bit min/max; those are built from compare + blend, with
+     * the sign bit flipped for unsigned lanes.
+     */
+    template<std::size_t Size, bool Signed>
+    struct avx2_int_minmax;
+
+    template<> struct avx2_int_minmax<1, true> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi8(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epi8(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<1, false> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<2, true> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi16(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epi16(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<2, false> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<4, true> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<4, false> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+    };
+
+    template<> struct avx2_int_minmax<8, true> {
+        static __m256i min(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    };
+
+    template<> struct avx2_int_minmax<8, false> {
+        static __m256i greater(__m256i a, __m256i b) {
+            const __m256i bias = _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+        static __m256i min(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, greater(a, b)); }
+        static __m256i max(__m256i a, __m256i b) { return _mm256_blendv_epi8(b, a, greater(a, b)); }
+    };
+
+    /**
+     * @brief True for integral types handled by the AVX2 min/max kernel
+     */
+    template<typename T>
+    struct has_avx2_int_range_scan {
+        static const bool value = std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    };
+
+    /**
+     * @brief AVX2 min/max scan of integral values, returns the number of elements consumed
+     */
+    template<typename T>
+    std::size_t scan_int_range_avx2(const T* data, std::size_t count, range_stats<T>& stats) {
+        typedef avx2_int_minmax<sizeof(T), std::is_signed<T>::value> ops;
+        const std::size_t lanes = 32 / sizeof(T);
+        if (count < 2 * lanes) {
+            return 0;
+        }
+
+        // Two accumulator pairs hide the latency of the emulated 64-bit min/max
+        __m256i min0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        __m256i min1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + lanes));
+        __m256i max0 = min0;
+        __m256i max1 = min1;
+        std::size_t i = 2 * lanes;
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + lanes));
+            min0 = ops::min(min0, a);
+            max0 = ops::max(max0, a);
+            min1 = ops::min(min1, b);
+            max1 = ops::max(max1, b);
+        }
+
+        T lane_min[32 / sizeof(T)];
+        T lane_max[32 / sizeof(T)];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_min), ops::min(min0, min1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_max), ops::max(max0, max1));
+        scan_range_scalar(lane_min, lanes, stats);
+        scan_range_scalar(lane_max, lanes, stats);
+        return i;
+    }
+#endif // NCAST_HAS_AVX2
+
+#if NCAST_HAS_SSE2
+    /**
+     * @brief Vectorized scan of floating-point values, returns the number of elements consumed
+     *
+     * Non-finite lanes are replaced by neutral values before the min/max
+     * update, so min and max only see finite values.
+     */
+    template<typename Ops>
+    std::size_t scan_float_range_simd(const typename Ops::value_type* data, std::size_t count,
+                                      range_stats<typename Ops::value_type>& stats) {
+        typedef typename Ops::value_type T;
+        typedef typename Ops::vec vec;
+        if (count < Ops::lanes) {
+            return 0;
+        }
+
+        const vec infinity = Ops::set1(std::numeric_limits<T>::infinity());
+        const vec zero = Ops::set1(T(0));
+        const vec neutral_min = Ops::set1(std::numeric_limits<T>::max());
+        const vec neutral_max = Ops::set1(std::numeric_limits<T>::lowest());
+        vec vmin = neutral_min;
+        vec vmax = neutral_max;
+        vec nan_seen = Ops::set1(T(0));
+        vec inf_seen = nan_seen;
+        vec negative_seen = nan_seen;
+
+        std::size_t i = 0;
+        for (; i + Ops::lanes <= count; i += Ops::lanes) {
+            vec v = Ops::load(data + i);
+            vec magnitude = Ops::abs(v);
+            vec finite = Ops::lt(magnitude, infinity);
+            nan_seen = Ops::bit_or(nan_seen, Ops::unordered(v));
+            inf_seen = Ops::bit_or(inf_seen, Ops::eq(magnitude, infinity));
+            negative_seen = Ops::bit_or(negative_seen, Ops::lt(v, zero));
+            vmin = Ops::min(vmin, Ops::select(finite, v, neutral_min));
+            vmax = Ops::max(vmax, Ops::select(finite, v, neutral_max));
+        }
+
+        T lane_min[Ops::lanes];
+        T lane_max[Ops::lanes];
+        Ops::store(lane_min, vmin);
+        Ops::store(lane_max, vmax);
+        for (std::size_t lane = 0; lane < Ops::lanes; ++lane) {
+            stats.min = lane_min[lane] < stats.min ? lane_min[lane] : stats.min;
+            stats.max = lane_max[lane] > stats.max ? lane_max[lane] : stats.max;
+        }
+        stats.has_nan = stats.has_nan || Ops::any(nan_seen);
+        stats.has_inf = stats.has_inf || Ops::any(inf_seen);
+        stats.has_negative = stats.has_negative || Ops::any(negative_seen);
+        return i;
+    }
+
+#if NCAST_HAS_AVX2
+    typedef avx2_float_range_ops float_range_ops;
+    typedef avx2_double_range_ops double_range_ops;
+#else
+    typedef sse2_float_range_ops float_range_ops;
+    typedef sse2_double_range_ops double_range_ops;
+#endif
+#endif // NCAST_HAS_SSE2
+
+#if NCAST_HAS_AVX2
+    template<typename T>
+    std::size_t scan_range_simd_prefix(const T* data, std::size_t count, range_stats<T>& stats, std::true_type) {
+        return scan_int_range_avx2(data, count, stats);
+    }
+#endif
+
+    template<typename T>
+    std::size_t scan_range_simd_prefix(const T*, std::size_t, range_stats<T>&, std::false_type) {
+        return 0;
+    }
+
+    /**
+     * @brief Scan dispatch: vectorized prefix (when available) plus scalar remainder
+     */
+    template<typename T>
+    void scan_range(const T* data, std::size_t count, range_stats<T>& stats) {
+#if NCAST_HAS_AVX2
+        const bool vectorized = has_avx2_int_range_scan<T>::value;
+#else
+        const bool vectorized = false;
+#endif
+        std::size_t done = scan_range_simd_prefix(data, count, stats, std::integral_constant<bool, vectorized>());
+        scan_range_scalar(data + done, count - done, stats);
+    }
+
+#if NCAST_HAS_SSE2
+    inline void scan_range(const float* data, std::size_t count, range_stats<float>& stats) {
+        std::size_t done = scan_float_range_simd<float_range_ops>(data, count, stats);
+        scan_range_scalar(data + done, count - done, stats);
+    }
+
+    inline void scan_range(const double* data, std::size_t count, range_stats<double>& stats) {
+        std::size_t done = scan_float_range_simd<double_range_ops>(data, count, stats);
+        scan_range_scalar(data + done, count - done, stats);
+    }
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Analyze the value range of an array in a single pass
+ *
+ * @tparam T Built-in arithmetic element type
+ * @param data Array to analyze
+ * @param count Number of elements
+ * @return Minimum and maximum finite value plus NaN / infinity / negative flags
+ */
+template<typename T>
+range_stats<T> analyze_range(const T* data, std::size_t count) {
+    static_assert(std::is_arithmetic<T>::value, "analyze_range requires a built-in arithmetic type");
+    range_stats<T> stats = detail::make_empty_range_stats<T>(count);
+    detail::scan_range(data, count, stats);
+    return stats;
+}
+
+/**
+ * @brief Check whether every analyzed value would pass numeric_cast<To>
+ *
+ * Applies the limit checks of the numeric_cast validators to the analyzed
+ * minimum and maximum: NaN and infinity are rejected unless To is a
+ * floating-point type, and the finite range must lie within To's limits.
+ * As with numeric_cast, fractional parts are truncated by float -> integer
+ * conversions and rounding is allowed between floating-point types.
+ */
+template<typename To, typename From>
+bool fits_in(const range_stats<From>& stats) {
+    if ((stats.has_nan || stats.has_inf) && !detail::is_float_type<To>::value) {
+        return false;
+    }
+    if (stats.empty()) {
+        return true;
+    }
+    return !detail::range_limits<To, From>::below_min(stats.min) &&
+           !detail::range_limits<To, From>::exceeds_max(stats.max);
+}
+
+/**
+ * @brief Convert an array with static_cast after validating its whole range
+ *
+ * Runs analyze_range() and, if every value fits To, converts all elements
+ * with a plain static_cast loop.
+ *
+ * @return true if the array was converted, false if some value does not fit
+ *         (dst is left untouched)
+ */
+template<typename To, typename From>
+bool convert_if_fits(const From* src, std::size_t count, To* dst) {
+    if (!fits_in<To>(analyze_range(src, count))) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<To>(src[i]);
+    }
+    return true;
+}
+
+} // namespace ncast
+
+#endif // NCAST_RANGE_H
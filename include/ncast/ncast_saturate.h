@@ -0,0 +1,398 @@
+#ifndef NCAST_SATURATE_H
+#define NCAST_SATURATE_H
+
+/**
+ * @file ncast_saturate.h
+ * @brief Saturating (clamping) numeric conversions
+ *
+ * saturate_cast<To>(value) never throws: values beyond To's range are
+ * clamped to its lowest / max value using the same limit checks as
+ * numeric_cast, NaN becomes 0 for integral targets, and infinity clamps
+ * to the integral range. Floating-point targets keep NaN and infinity.
+ *
+ * saturate_cast_n() converts whole arrays with the same semantics and can
+ * report how many elements were clamped. The common integer narrowing
+ * pairs use saturating pack instructions:
+ * - int32 -> int16 (packssdw), int32 -> uint16 (packusdw, SSE4.1)
+ * - int32 -> int8 / uint8 (packssdw + packsswb / packuswb)
+ * - int16 -> int8 / uint8 (packsswb / packuswb)
+ *
+ * @code
+ * #include <ncast/ncast_saturate.h>
+ *
+ * std::uint8_t pixel = ncast::saturate_cast<std::uint8_t>(-20);   // 0
+ *
+ * std::size_t clamped = 0;
+ * ncast::saturate_cast_n(samples, n, pixels, &clamped);
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <bitset>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ncast {
+
+namespace detail {
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type is_nan_or_inf(T value) {
+        return std::isnan(value) || std::isinf(value);
+    }
+
+    template<typename T>
+    typename std::enable_if<!std::is_floating_point<T>::value, bool>::type is_nan_or_inf(T) {
+        return false;
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type is_nan(T value) {
+        return std::isnan(value);
+    }
+
+    template<typename T>
+    typename std::enable_if<!std::is_floating_point<T>::value, bool>::type is_nan(T) {
+        return false;
+    }
+
+    /**
+     * @brief Saturating conversion of one value; sets clamped when the value was replaced
+     */
+    template<typename To, typename From>
+    To saturate_value(From value, bool& clamped) {
+        clamped = false;
+        if (std::is_floating_point<To>::value && is_nan_or_inf(value)) {
+            return static_cast<To>(value);
+        }
+        if (is_nan(value)) {
+            clamped = true;
+            return To(0);
+        }
+        if (range_limits<To, From>::exceeds_max(value)) {
+            clamped = true;
+            return std::numeric_limits<To>::max();
+        }
+        if (range_limits<To, From>::below_min(value)) {
+            clamped = true;
+            return std::numeric_limits<To>::lowest();
+        }
+        return static_cast<To>(value);
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert a value, clamping it to the range of the target type
+ *
+ * @tparam To Target type (built-in arithmetic)
+ * @param value Value to convert
+ * @return value if it passes numeric_cast<To>, otherwise the nearest
+ *         bound of To (0 for NaN with an integral target)
+ */
+template<typename To, typename From>
+To saturate_cast(From value) {
+    static_assert(std::is_arithmetic<To>::value && std::is_arithmetic<From>::value,
+                  "saturate_cast requires built-in arithmetic types");
+    bool clamped;
+    return detail::saturate_value<To>(value, clamped);
+}
+
+namespace detail {
+
+    // Number of lanes set in a packed compare mask with To-sized lanes
+    template<typename To>
+    std::size_t count_mask_lanes(int byte_mask) {
+        return std::bitset<32>(static_cast<unsigned>(byte_mask)).count() / sizeof(To);
+    }
+
+    /*
+     * Pack kernels. Out-of-range lanes are counted by packing the compare
+     * masks with the same signed-saturating instructions as the data (all-ones
+     * lanes stay all-ones), so counting costs one movemask per output vector.
+     */
+
+#if NCAST_HAS_SSE2
+    inline __m128i load128(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    inline void store128(void* p, __m128i v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+
+    // Lanes of v outside [lo, hi] (signed 32-bit lanes)
+    inline __m128i out_of_range_epi32(__m128i v, __m128i lo, __m128i hi) {
+        return _mm_or_si128(_mm_cmpgt_epi32(v, hi), _mm_cmplt_epi32(v, lo));
+    }
+
+    // Lanes of v outside [lo, hi] (signed 16-bit lanes)
+    inline __m128i out_of_range_epi16(__m128i v, __m128i lo, __m128i hi) {
+        return _mm_or_si128(_mm_cmpgt_epi16(v, hi), _mm_cmplt_epi16(v, lo));
+    }
+
+    /**
+     * @brief SSE2 int32 -> int16 / uint16 (uint16 needs SSE4.1 packusdw); 8 elements per iteration
+     */
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i32_i16_sse(const std::int32_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m128i lo = _mm_set1_epi32(Unsigned ? 0 : -32768);
+        const __m128i hi = _mm_set1_epi32(Unsigned ? 65535 : 32767);
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m128i a = load128(src + i);
+            __m128i b = load128(src + i + 4);
+#if NCAST_HAS_SSE41
+            store128(out + i * 2, Unsigned ? _mm_packus_epi32(a, b) : _mm_packs_epi32(a, b));
+#else
+            store128(out + i * 2, _mm_packs_epi32(a, b));  // Unsigned is only instantiated with SSE4.1
+#endif
+            if (Count) {
+                __m128i mask = _mm_packs_epi32(out_of_range_epi32(a, lo, hi), out_of_range_epi32(b, lo, hi));
+                clamped += count_mask_lanes<std::int16_t>(_mm_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+
+    /**
+     * @brief SSE2 int32 -> int8 / uint8: packssdw then packsswb / packuswb; 16 elements per iteration
+     *
+     * packssdw keeps the order of values relative to the byte range, so the
+     * second pack clamps exactly.
+     */
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i32_i8_sse(const std::int32_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m128i lo = _mm_set1_epi32(Unsigned ? 0 : -128);
+        const __m128i hi = _mm_set1_epi32(Unsigned ? 255 : 127);
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m128i a = load128(src + i);
+            __m128i b = load128(src + i + 4);
+            __m128i c = load128(src + i + 8);
+            __m128i d = load128(src + i + 12);
+            __m128i ab = _mm_packs_epi32(a, b);
+            __m128i cd = _mm_packs_epi32(c, d);
+            store128(out + i, Unsigned ? _mm_packus_epi16(ab, cd) : _mm_packs_epi16(ab, cd));
+            if (Count) {
+                __m128i mask = _mm_packs_epi16(
+                    _mm_packs_epi32(out_of_range_epi32(a, lo, hi), out_of_range_epi32(b, lo, hi)),
+                    _mm_packs_epi32(out_of_range_epi32(c, lo, hi), out_of_range_epi32(d, lo, hi)));
+                clamped += count_mask_lanes<std::int8_t>(_mm_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+
+    /**
+     * @brief SSE2 int16 -> int8 / uint8: packsswb / packuswb; 16 elements per iteration
+     */
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i16_i8_sse(const std::int16_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m128i lo = _mm_set1_epi16(static_cast<short>(Unsigned ? 0 : -128));
+        const __m128i hi = _mm_set1_epi16(static_cast<short>(Unsigned ? 255 : 127));
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m128i a = load128(src + i);
+            __m128i b = load128(src + i + 8);
+            store128(out + i, Unsigned ? _mm_packus_epi16(a, b) : _mm_packs_epi16(a, b));
+            if (Count) {
+                __m128i mask = _mm_packs_epi16(out_of_range_epi16(a, lo, hi), out_of_range_epi16(b, lo, hi));
+                clamped += count_mask_lanes<std::int8_t>(_mm_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+#endif // NCAST_HAS_SSE2
+
+#if NCAST_HAS_AVX2
+    inline __m256i load256(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    inline void store256(void* p, __m256i v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+
+    inline __m256i out_of_range_epi32(__m256i v, __m256i lo, __m256i hi) {
+        return _mm256_or_si256(_mm256_cmpgt_epi32(v, hi), _mm256_cmpgt_epi32(lo, v));
+    }
+
+    inline __m256i out_of_range_epi16(__m256i v, __m256i lo, __m256i hi) {
+        return _mm256_or_si256(_mm256_cmpgt_epi16(v, hi), _mm256_cmpgt_epi16(lo, v));
+    }
+
+    /*
+     * The AVX2 pack instructions work within 128-bit lanes, so results are
+     * reordered with a cross-lane permute before the store. Masks are only
+     * counted, so they skip the permute.
+     */
+
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i32_i16_avx2(const std::int32_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m256i lo = _mm256_set1_epi32(Unsigned ? 0 : -32768);
+        const __m256i hi = _mm256_set1_epi32(Unsigned ? 65535 : 32767);
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m256i a = load256(src + i);
+            __m256i b = load256(src + i + 8);
+            __m256i packed = Unsigned ? _mm256_packus_epi32(a, b) : _mm256_packs_epi32(a, b);
+            store256(out + i * 2, _mm256_permute4x64_epi64(packed, 0xd8));
+            if (Count) {
+                __m256i mask = _mm256_packs_epi32(out_of_range_epi32(a, lo, hi), out_of_range_epi32(b, lo, hi));
+                clamped += count_mask_lanes<std::int16_t>(_mm256_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i32_i8_avx2(const std::int32_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m256i lo = _mm256_set1_epi32(Unsigned ? 0 : -128);
+        const __m256i hi = _mm256_set1_epi32(Unsigned ? 255 : 127);
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 32 <= count; i += 32) {
+            __m256i a = load256(src + i);
+            __m256i b = load256(src + i + 8);
+            __m256i c = load256(src + i + 16);
+            __m256i d = load256(src + i + 24);
+            __m256i ab = _mm256_packs_epi32(a, b);
+            __m256i cd = _mm256_packs_epi32(c, d);
+            __m256i packed = Unsigned ? _mm256_packus_epi16(ab, cd) : _mm256_packs_epi16(ab, cd);
+            store256(out + i, _mm256_permutevar8x32_epi32(packed, order));
+            if (Count) {
+                __m256i mask = _mm256_packs_epi16(
+                    _mm256_packs_epi32(out_of_range_epi32(a, lo, hi), out_of_range_epi32(b, lo, hi)),
+                    _mm256_packs_epi32(out_of_range_epi32(c, lo, hi), out_of_range_epi32(d, lo, hi)));
+                clamped += count_mask_lanes<std::int8_t>(_mm256_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+
+    template<bool Count, bool Unsigned>
+    std::size_t saturate_i16_i8_avx2(const std::int16_t* src, std::size_t count, void* dst, std::size_t& clamped) {
+        const __m256i lo = _mm256_set1_epi16(static_cast<short>(Unsigned ? 0 : -128));
+        const __m256i hi = _mm256_set1_epi16(static_cast<short>(Unsigned ? 255 : 127));
+        unsigned char* out = static_cast<unsigned char*>(dst);
+        std::size_t i = 0;
+        for (; i + 32 <= count; i += 32) {
+            __m256i a = load256(src + i);
+            __m256i b = load256(src + i + 16);
+            __m256i packed = Unsigned ? _mm256_packus_epi16(a, b) : _mm256_packs_epi16(a, b);
+            store256(out + i, _mm256_permute4x64_epi64(packed, 0xd8));
+            if (Count) {
+                __m256i mask = _mm256_packs_epi16(out_of_range_epi16(a, lo, hi), out_of_range_epi16(b, lo, hi));
+                clamped += count_mask_lanes<std::int8_t>(_mm256_movemask_epi8(mask));
+            }
+        }
+        return i;
+    }
+#endif // NCAST_HAS_AVX2
+
+    /**
+     * @brief Vectorized prefix of saturate_cast_n; returns the number of elements done
+     *
+     * Overloaded for the pairs with pack kernels; other pairs run fully scalar.
+     */
+    template<bool Count, typename To, typename From>
+    std::size_t saturate_simd_prefix(const From*, std::size_t, To*, std::size_t&) {
+        return 0;
+    }
+
+#if NCAST_HAS_SSE2
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int32_t* src, std::size_t count, std::int16_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i32_i16_avx2<Count, false>(src, count, dst, clamped);
+#else
+        return saturate_i32_i16_sse<Count, false>(src, count, dst, clamped);
+#endif
+    }
+
+#if NCAST_HAS_SSE41
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int32_t* src, std::size_t count, std::uint16_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i32_i16_avx2<Count, true>(src, count, dst, clamped);
+#else
+        return saturate_i32_i16_sse<Count, true>(src, count, dst, clamped);
+#endif
+    }
+#endif
+
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int32_t* src, std::size_t count, std::int8_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i32_i8_avx2<Count, false>(src, count, dst, clamped);
+#else
+        return saturate_i32_i8_sse<Count, false>(src, count, dst, clamped);
+#endif
+    }
+
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int32_t* src, std::size_t count, std::uint8_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i32_i8_avx2<Count, true>(src, count, dst, clamped);
+#else
+        return saturate_i32_i8_sse<Count, true>(src, count, dst, clamped);
+#endif
+    }
+
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int16_t* src, std::size_t count, std::int8_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i16_i8_avx2<Count, false>(src, count, dst, clamped);
+#else
+        return saturate_i16_i8_sse<Count, false>(src, count, dst, clamped);
+#endif
+    }
+
+    template<bool Count>
+    std::size_t saturate_simd_prefix(const std::int16_t* src, std::size_t count, std::uint8_t* dst, std::size_t& clamped) {
+#if NCAST_HAS_AVX2
+        return saturate_i16_i8_avx2<Count, true>(src, count, dst, clamped);
+#else
+        return saturate_i16_i8_sse<Count, true>(src, count, dst, clamped);
+#endif
+    }
+#endif // NCAST_HAS_SSE2
+
+    template<bool Count, typename To, typename From>
+    std::size_t saturate_cast_n_impl(const From* src, std::size_t count, To* dst) {
+        std::size_t clamped = 0;
+        std::size_t i = saturate_simd_prefix<Count>(src, count, dst, clamped);
+        for (; i < count; ++i) {
+            bool element_clamped;
+            dst[i] = saturate_value<To>(src[i], element_clamped);
+            clamped += element_clamped ? 1u : 0u;
+        }
+        return clamped;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert an array with saturate_cast semantics
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @param clamped Optional: receives the number of elements that were clamped
+ *        (counting is skipped when null)
+ */
+template<typename To, typename From>
+void saturate_cast_n(const From* src, std::size_t count, To* dst, std::size_t* clamped = nullptr) {
+    static_assert(std::is_arithmetic<To>::value && std::is_arithmetic<From>::value,
+                  "saturate_cast_n requires built-in arithmetic types");
+    if (clamped) {
+        *clamped = detail::saturate_cast_n_impl<true>(src, count, dst);
+    } else {
+        detail::saturate_cast_n_impl<false>(src, count, dst);
+    }
+}
+
+} // namespace ncast
+
+#endif // NCAST_SATURATE_H
@@ -0,0 +1,72 @@
+#ifndef NCAST_SIMD_H
+#define NCAST_SIMD_H
+
+/**
+ * @file ncast_simd.h
+ * @brief Instruction set detection for ncast bulk conversion kernels
+ *
+ * Bulk kernels select their SIMD path at compile time from the instruction
+ * sets the translation unit is compiled for (e.g. -mavx2, -mf16c, /arch:AVX2).
+ * Every kernel has a portable scalar fallback, so the detected flags only
+ * affect speed, never results.
+ *
+ * Control macros:
+ * - NCAST_DISABLE_SIMD: force the scalar fallbacks on all platforms
+ *
+ * Feature flags (always defined, 0 or 1):
+ * - NCAST_HAS_SSE2, NCAST_HAS_SSSE3, NCAST_HAS_SSE41, NCAST_HAS_AVX2, NCAST_HAS_F16C, NCAST_HAS_AVX512
+ */
+
+#if !defined(NCAST_DISABLE_SIMD) && \
+    (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NCAST_HAS_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || (defined(_MSC_VER) && defined(__AVX__))
+#define NCAST_HAS_SSSE3 1
+#endif
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#define NCAST_HAS_SSE41 1
+#endif
+
+#if defined(__AVX2__)
+#define NCAST_HAS_AVX2 1
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define NCAST_HAS_F16C 1
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+#define NCAST_HAS_AVX512 1
+#endif
+
+#if defined(NCAST_HAS_SSE2)
+#include <immintrin.h>
+#endif
+
+#endif // SIMD enabled on x86
+
+#ifndef NCAST_HAS_SSE2
+#define NCAST_HAS_SSE2 0
+#endif
+#ifndef NCAST_HAS_SSSE3
+#define NCAST_HAS_SSSE3 0
+#endif
+#ifndef NCAST_HAS_SSE41
+#define NCAST_HAS_SSE41 0
+#endif
+#ifndef NCAST_HAS_AVX2
+#define NCAST_HAS_AVX2 0
+#endif
+#ifndef NCAST_HAS_F16C
+#define NCAST_HAS_F16C 0
+#endif
+#ifndef NCAST_HAS_AVX512
+#define NCAST_HAS_AVX512 0
+#endif
+
+#endif // NCAST_SIMD_H
@@ -0,0 +1,225 @@
+#ifndef NCAST_STRIDED_H
+#define NCAST_STRIDED_H
+
+/**
+ * @file ncast_strided.h
+ * @brief Validated bulk conversion of strided data (struct fields, interleaved channels)
+ *
+ * Source and destination are addressed by a pointer to the first element
+ * and a byte stride between consecutive elements, so a field of an array
+ * of structs can be converted into a dense column (or the other way round)
+ * without copying the records first.
+ *
+ * Elements are gathered into a dense block on the stack (AVX2 gather
+ * instructions for 4- and 8-byte sources when available), validated with the
+ * numeric_cast rules, converted and scattered to the destination.
+ *
+ * @code
+ * #include <ncast/ncast_strided.h>
+ *
+ * struct Trade { std::int64_t id; double price; char venue[48]; };
+ *
+ * std::vector<std::int32_t> prices(trades.size());
+ * ncast::bulk_result r = ncast::try_numeric_cast_strided(&trades[0].price, sizeof(Trade), trades.size(),
+ *                                                        prices.data());
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace ncast {
+
+namespace detail {
+
+    /// Elements gathered, validated and converted per step
+    const std::size_t strided_block_size = 256;
+
+    inline const unsigned char* byte_pointer(const void* p) { return static_cast<const unsigned char*>(p); }
+    inline unsigned char* byte_pointer(void* p) { return static_cast<unsigned char*>(p); }
+
+    /**
+     * @brief Copy count strided elements into a dense buffer (fields may be unaligned)
+     */
+    template<typename T>
+    void gather_strided_scalar(const unsigned char* src, std::size_t stride, std::size_t count, T* out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::memcpy(&out[i], src + i * stride, sizeof(T));
+        }
+    }
+
+    template<typename T>
+    void scatter_strided(const T* in, std::size_t count, unsigned char* dst, std::size_t stride) {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::memcpy(dst + i * stride, &in[i], sizeof(T));
+        }
+    }
+
+#if NCAST_HAS_AVX2
+    // Byte offsets 0, stride, 2 * stride, ... for the gather index vector
+    inline __m128i stride_offsets4(int stride) {
+        return _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(stride));
+    }
+
+    inline __m256i stride_offsets8(int stride) {
+        return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+    }
+
+    // AVX2 gathers for the common 4- and 8-byte source types; offsets are
+    // relative to each group's first element so they always fit in int32.
+    // The masked forms (all lanes enabled) avoid GCC's uninitialized-source warning.
+    template<typename T>
+    std::size_t gather_strided_avx2(const unsigned char*, int, std::size_t, T*) {
+        return 0;
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, double* out) {
+        const __m128i offsets = stride_offsets4(stride);
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+        const std::size_t step = static_cast<std::size_t>(stride) * 4;
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4, src += step) {
+            _mm256_storeu_pd(out + i, _mm256_mask_i32gather_pd(zero, reinterpret_cast<const double*>(src), offsets, all, 1));
+        }
+        return i;
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, float* out) {
+        const __m256i offsets = stride_offsets8(stride);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        const std::size_t step = static_cast<std::size_t>(stride) * 8;
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8, src += step) {
+            _mm256_storeu_ps(out + i, _mm256_mask_i32gather_ps(zero, reinterpret_cast<const float*>(src), offsets, all, 1));
+        }
+        return i;
+    }
+
+    template<typename T>
+    std::size_t gather_strided_avx2_epi32(const unsigned char* src, int stride, std::size_t count, T* out) {
+        const __m256i offsets = stride_offsets8(stride);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i all = _mm256_set1_epi32(-1);
+        const std::size_t step = static_cast<std::size_t>(stride) * 8;
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8, src += step) {
+            __m256i v = _mm256_mask_i32gather_epi32(zero, reinterpret_cast<const int*>(src), offsets, all, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+        }
+        return i;
+    }
+
+    template<typename T>
+    std::size_t gather_strided_avx2_epi64(const unsigned char* src, int stride, std::size_t count, T* out) {
+        const __m128i offsets = stride_offsets4(stride);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i all = _mm256_set1_epi32(-1);
+        const std::size_t step = static_cast<std::size_t>(stride) * 4;
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4, src += step) {
+            __m256i v = _mm256_mask_i32gather_epi64(zero, reinterpret_cast<const long long*>(src), offsets, all, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+        }
+        return i;
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, std::int32_t* out) {
+        return gather_strided_avx2_epi32(src, stride, count, out);
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, std::uint32_t* out) {
+        return gather_strided_avx2_epi32(src, stride, count, out);
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, std::int64_t* out) {
+        return gather_strided_avx2_epi64(src, stride, count, out);
+    }
+
+    inline std::size_t gather_strided_avx2(const unsigned char* src, int stride, std::size_t count, std::uint64_t* out) {
+        return gather_strided_avx2_epi64(src, stride, count, out);
+    }
+#endif // NCAST_HAS_AVX2
+
+    /**
+     * @brief Gather count strided elements into out, using AVX2 gathers when the stride allows
+     */
+    template<typename T>
+    void gather_strided(const unsigned char* src, std::size_t stride, std::size_t count, T* out) {
+        std::size_t done = 0;
+#if NCAST_HAS_AVX2
+        // Gather offsets are signed 32-bit; 8 elements per gather
+        if (stride <= static_cast<std::size_t>(std::numeric_limits<int>::max() / 8)) {
+            done = gather_strided_avx2(src, static_cast<int>(stride), count, out);
+        }
+#endif
+        gather_strided_scalar(src + done * stride, stride, count - done, out + done);
+    }
+} // namespace detail
+
+/**
+ * @brief Convert strided elements with numeric_cast validation
+ *
+ * Elements before the first failing one are converted; conversion stops
+ * there.
+ *
+ * @param src Address of the first source element (may be a field of a packed struct)
+ * @param src_stride Distance in bytes between consecutive source elements
+ * @param count Number of elements
+ * @param dst Address of the first destination element
+ * @param dst_stride Distance in bytes between destination elements (default: dense)
+ * @return Index and reason of the first failure, or {count, cast_error::none}
+ */
+template<typename To, typename From>
+bulk_result try_numeric_cast_strided(const From* src, std::size_t src_stride, std::size_t count,
+                                     To* dst, std::size_t dst_stride = sizeof(To)) {
+    static_assert(std::is_arithmetic<To>::value && std::is_arithmetic<From>::value,
+                  "try_numeric_cast_strided requires built-in arithmetic types");
+    const unsigned char* in = detail::byte_pointer(src);
+    unsigned char* out = detail::byte_pointer(dst);
+    From gathered[detail::strided_block_size];
+    To converted[detail::strided_block_size];
+
+    for (std::size_t base = 0; base < count; base += detail::strided_block_size) {
+        std::size_t n = count - base < detail::strided_block_size ? count - base : detail::strided_block_size;
+        detail::gather_strided(in + base * src_stride, src_stride, n, gathered);
+        std::size_t valid;
+        if (dst_stride == sizeof(To)) {
+            valid = detail::convert_checked_block(gathered, n, dst + base);
+        } else {
+            valid = detail::convert_checked_block(gathered, n, converted);
+            detail::scatter_strided(converted, valid, out + base * dst_stride, dst_stride);
+        }
+        if (valid != n) {
+            bulk_result failure = { base + valid, detail::element_check<To, From>::error(gathered[valid]) };
+            return failure;
+        }
+    }
+    bulk_result success = { count, cast_error::none };
+    return success;
+}
+
+/**
+ * @brief Convert strided elements with numeric_cast validation, throwing on failure
+ *
+ * @throws cast_exception if an element does not fit; elements before it are converted
+ */
+template<typename To, typename From>
+void numeric_cast_strided(const From* src, std::size_t src_stride, std::size_t count,
+                          To* dst, std::size_t dst_stride = sizeof(To)) {
+    bulk_result result = try_numeric_cast_strided(src, src_stride, count, dst, dst_stride);
+    if (!result.ok()) {
+        detail::throw_bulk_error(result, "unknown", 0, "unknown");
+    }
+}
+
+} // namespace ncast
+
+#endif // NCAST_STRIDED_H
@@ -0,0 +1,173 @@
+#ifndef NCAST_VALIDITY_H
+#define NCAST_VALIDITY_H
+
+/**
+ * @file ncast_validity.h
+ * @brief Bulk conversion that reports every failing element in a validity bitmap
+ *
+ * convert_with_validity() converts a whole array without stopping at bad
+ * elements: each element that passes numeric_cast is converted, each one that
+ * fails is replaced by a caller-supplied sentinel, and a validity bitmap
+ * (1 bit per element, set = valid) records which is which. The number of
+ * failures is returned, so a batch can be accepted as a whole and its bad rows
+ * routed elsewhere.
+ *
+ * The bitmap uses the Apache Arrow layout: bit (i % 8) of byte (i / 8),
+ * least significant bit first; validity_bitmap_bytes(count) bytes are written.
+ *
+ * Work is done in 256-element blocks. A block without failures takes the
+ * same vectorized validate-and-convert path as try_numeric_cast_n(), so the
+ * all-valid case costs the same as first-failure mode; a block with failures
+ * is marked, converted with replacement and packed into bits by branch-free
+ * loops.
+ *
+ * @code
+ * #include <ncast/ncast_validity.h>
+ *
+ * std::vector<std::uint8_t> valid(ncast::validity_bitmap_bytes(n));
+ * std::size_t failures = ncast::convert_with_validity(amounts, n, amounts32, valid.data(), -1);
+ * for (std::size_t i = 0; failures != 0 && i < n; ++i) {
+ *     if (!ncast::is_valid(valid.data(), i)) {
+ *         dead_letter(i);
+ *     }
+ * }
+ * @endcode
+ */
+
+#include "ncast.h"
+#include "ncast_bulk.h"
+#include "ncast_simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ncast {
+
+/**
+ * @brief Number of bytes of a validity bitmap for count elements
+ */
+inline std::size_t validity_bitmap_bytes(std::size_t count) {
+    return (count + 7) / 8;
+}
+
+/**
+ * @brief Test the validity bit of one element
+ */
+inline bool is_valid(const std::uint8_t* validity, std::size_t index) {
+    return ((static_cast<unsigned>(validity[index / 8]) >> (index % 8)) & 1u) != 0;
+}
+
+namespace detail {
+
+    /// Elements per block; a multiple of 8 so that every block starts on a bitmap byte
+    const std::size_t validity_block_size = 256;
+
+    /// Keeps a parameter out of template argument deduction (replacement values like -1)
+    template<typename T>
+    struct non_deduced {
+        typedef T type;
+    };
+
+    /**
+     * @brief Store element_check results as 0/1 bytes; returns the number of failures
+     */
+    template<typename ToType, typename FromType>
+    std::size_t mark_valid(const FromType* src, std::size_t count, unsigned char* valid) {
+        unsigned failures = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            unsigned fits = static_cast<unsigned>(element_check<ToType, FromType>::fits(src[i]));
+            valid[i] = static_cast<unsigned char>(fits);
+            failures += fits ^ 1u;
+        }
+        return failures;
+    }
+
+    /**
+     * @brief Convert valid elements and store replacement for the others, without branches
+     *
+     * Failing source values are swapped for zero before the conversion, so no
+     * out-of-range value is ever converted.
+     */
+    template<typename ToType, typename FromType>
+    void convert_or_replace(const FromType* src, std::size_t count, const unsigned char* valid,
+                            ToType* dst, ToType replacement) {
+        for (std::size_t i = 0; i < count; ++i) {
+            FromType value = valid[i] ? src[i] : FromType(0);
+            ToType converted = static_cast<ToType>(value);
+            dst[i] = valid[i] ? converted : replacement;
+        }
+    }
+
+    /**
+     * @brief Pack 0/1 bytes into bits, least significant bit first; the last byte is zero-padded
+     */
+    inline void pack_validity_bits(const unsigned char* valid, std::size_t count, std::uint8_t* bitmap) {
+        std::size_t i = 0;
+#if NCAST_HAS_SSE2
+        for (; i + 16 <= count; i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(valid + i));
+            // Move bit 0 of each byte to bit 7, where movemask picks it up
+            unsigned bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_slli_epi16(bytes, 7)));
+            bitmap[i / 8] = static_cast<std::uint8_t>(bits);
+            bitmap[i / 8 + 1] = static_cast<std::uint8_t>(bits >> 8);
+        }
+#endif
+        for (; i < count; i += 8) {
+            unsigned bits = 0;
+            for (std::size_t j = 0; j < 8 && i + j < count; ++j) {
+                bits |= static_cast<unsigned>(valid[i + j]) << j;
+            }
+            bitmap[i / 8] = static_cast<std::uint8_t>(bits);
+        }
+    }
+
+    /**
+     * @brief Set the bits of count valid elements; the last byte is zero-padded
+     */
+    inline void fill_validity_bits(std::size_t count, std::uint8_t* bitmap) {
+        std::memset(bitmap, 0xff, count / 8);
+        if (count % 8 != 0) {
+            bitmap[count / 8] = static_cast<std::uint8_t>((1u << (count % 8)) - 1u);
+        }
+    }
+
+} // namespace detail
+
+/**
+ * @brief Convert an array, replacing failing elements and recording validity per element
+ *
+ * @param src Source values
+ * @param count Number of elements
+ * @param dst Destination, must hold count elements
+ * @param validity Bitmap of validity_bitmap_bytes(count) bytes; bit i is set
+ *        if element i passed numeric_cast, unused bits of the last byte are cleared
+ * @param replacement Value stored in dst for failing elements
+ * @return Number of failing elements
+ */
+template<typename ToType, typename FromType>
+std::size_t convert_with_validity(const FromType* src, std::size_t count, ToType* dst,
+                                  std::uint8_t* validity,
+                                  typename detail::non_deduced<ToType>::type replacement = ToType()) {
+    static_assert(std::is_arithmetic<ToType>::value && std::is_arithmetic<FromType>::value,
+                  "convert_with_validity requires built-in arithmetic types");
+    unsigned char valid[detail::validity_block_size];
+    std::size_t failures = 0;
+
+    for (std::size_t base = 0; base < count; base += detail::validity_block_size) {
+        std::size_t n = count - base < detail::validity_block_size ? count - base : detail::validity_block_size;
+        std::uint8_t* bitmap = validity + base / 8;
+        if (detail::convert_checked_block(src + base, n, dst + base) == n) {
+            detail::fill_validity_bits(n, bitmap);
+        } else {
+            failures += detail::mark_valid<ToType>(src + base, n, valid);
+            detail::convert_or_replace(src + base, n, valid, dst + base, replacement);
+            detail::pack_validity_bits(valid, n, bitmap);
+        }
+    }
+    return failures;
+}
+
+} // namespace ncast
+
+#endif // NCAST_VALIDITY_H
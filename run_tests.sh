@@ -26,7 +26,7 @@ else
     tests_total=0
     
     # List of test modules
-    test_modules=("test_ncast_core" "test_ncast_int" "test_ncast_float" "test_ncast_char")
+    test_modules=("test_ncast_core" "test_ncast_int" "test_ncast_float" "test_ncast_char" "test_ncast_half" "test_ncast_bfloat16" "test_ncast_range" "test_ncast_narrow" "test_ncast_saturate" "test_ncast_strided" "test_ncast_bulk" "test_ncast_validity" "test_ncast_policy" "test_ncast_parallel" "test_ncast_iterator" "test_ncast_buffer" "test_ncast_array" "test_ncast_char_view" "test_ncast_parse" "test_ncast_csv" "test_ncast_file" "test_ncast_endian" "test_ncast_iterator_cpp20")
     
     for test in "${test_modules[@]}"; do
         if [ -f "./$test" ]; then
@@ -0,0 +1,27 @@
+/**
+ * @file package_test.cpp
+ * @brief Smoke test for an installed ncast package (find_package(ncast))
+ *
+ * Uses ncast_parallel.h, so it also checks that the exported target brings
+ * its Threads dependency along.
+ */
+
+#include <ncast/ncast.h>
+#include <ncast/ncast_parallel.h>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<double> values(100000, 42.0);
+    std::vector<std::int32_t> out(values.size());
+    ncast::thread_pool pool(2);
+    ncast::numeric_cast_parallel(values.data(), values.size(), out.data(), pool);
+
+    if (out.back() != 42 || ncast::numeric_cast<std::uint8_t>(255) != 255u) {
+        std::cerr << "package test failed" << std::endl;
+        return 1;
+    }
+    std::cout << "package test passed" << std::endl;
+    return 0;
+}
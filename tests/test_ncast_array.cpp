@@ -0,0 +1,172 @@
+#include "../include/ncast/ncast_array.h"
+#include "../include/utest/utest.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using namespace ncast;
+
+// =============================================================================
+// ARRAY AND TUPLE TESTS
+// =============================================================================
+
+#if NCAST_HAS_CONSTEXPR_VALIDATION
+// Lookup tables converted and validated at compile time
+constexpr std::array<int, 5> wide_table = {{ 0, 64, 127, -128, -1 }};
+constexpr std::array<std::int8_t, 5> narrow_table = numeric_cast<std::array<std::int8_t, 5> >(wide_table);
+static_assert(narrow_table[2] == 127 && narrow_table[3] == -128, "array converted at compile time");
+
+constexpr std::tuple<std::uint8_t, std::int16_t, double> packed =
+    numeric_cast<std::tuple<std::uint8_t, std::int16_t, double> >(std::make_tuple(200, -300L, 7.0f));
+static_assert(std::get<0>(packed) == 200 && std::get<1>(packed) == -300, "tuple converted at compile time");
+
+constexpr std::pair<std::uint16_t, float> limits =
+    numeric_cast<std::pair<std::uint16_t, float> >(std::make_pair(65535LL, 2.0));
+static_assert(limits.first == 65535 && limits.second == 2.0f, "pair converted at compile time");
+#endif
+
+// Test element-wise array conversion against numeric_cast
+UTEST_FUNC_DEF(ArrayMatchesNumericCast) {
+    std::array<long long, 6> values = {{ 0, 1, -1, 32767, -32768, 1000 }};
+    std::array<std::int16_t, 6> out = numeric_cast<std::array<std::int16_t, 6> >(values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        UTEST_ASSERT_EQUALS(numeric_cast<std::int16_t>(values[i]), out[i]);
+    }
+
+    std::array<double, 3> reals = {{ 1.0, -2.0, 1024.0 }};
+    std::array<float, 3> floats = numeric_cast<std::array<float, 3> >(reals);
+    UTEST_ASSERT_EQUALS(-2.0f, floats[1]);
+    UTEST_ASSERT_EQUALS(1024.0f, floats[2]);
+
+    // Empty arrays convert too
+    std::array<int, 0> none = {{}};
+    UTEST_ASSERT_EQUALS(0u, (numeric_cast<std::array<char, 0> >(none).size()));
+
+    // Scalars still go through the scalar overload
+    UTEST_ASSERT_EQUALS(42, numeric_cast<std::int8_t>(42));
+}
+
+// Test that a failing element throws with its index
+UTEST_FUNC_DEF(ArrayErrorNamesIndex) {
+    std::array<int, 5> values = {{ 1, 2, 3, 300, -300 }};
+    bool thrown = false;
+    try {
+        numeric_cast<std::array<std::uint8_t, 5> >(values);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 3") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    std::array<int, 2> negative = {{ 7, -1 }};
+    thrown = false;
+    try {
+        numeric_cast<std::array<unsigned, 2> >(negative);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::negative_to_unsigned);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 1") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test heterogeneous tuples and pairs
+UTEST_FUNC_DEF(TupleAndPair) {
+    std::tuple<int, double, unsigned long long> values(-5, 100.0, 65535ULL);
+    std::tuple<std::int8_t, float, std::uint16_t> out =
+        numeric_cast<std::tuple<std::int8_t, float, std::uint16_t> >(values);
+    UTEST_ASSERT_EQUALS(-5, std::get<0>(out));
+    UTEST_ASSERT_EQUALS(100.0f, std::get<1>(out));
+    UTEST_ASSERT_EQUALS(65535u, std::get<2>(out));
+
+    // Structs of arithmetic members convert through std::tie
+    struct sample { long long time; double level; };
+    sample s = { 1234, 12.0 };
+    std::tuple<std::int32_t, std::uint8_t> narrow =
+        numeric_cast<std::tuple<std::int32_t, std::uint8_t> >(std::tie(s.time, s.level));
+    UTEST_ASSERT_EQUALS(1234, std::get<0>(narrow));
+    UTEST_ASSERT_EQUALS(12, std::get<1>(narrow));
+
+    bool thrown = false;
+    try {
+        numeric_cast<std::tuple<int, std::uint8_t, int> >(std::make_tuple(1, 256, 3));
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 1") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    std::pair<std::uint8_t, std::int64_t> p = numeric_cast<std::pair<std::uint8_t, std::int64_t> >(std::make_pair(255, -1));
+    UTEST_ASSERT_EQUALS(255, p.first);
+    UTEST_ASSERT_EQUALS(-1, p.second);
+
+    thrown = false;
+    try {
+        numeric_cast<std::pair<int, std::int8_t> >(std::make_pair(0, 128));
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 1") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test that the first failing element is reported when several fail
+UTEST_FUNC_DEF(FirstFailingElement) {
+    bool thrown = false;
+    try {
+        numeric_cast<std::tuple<std::int8_t, std::int8_t, std::int8_t> >(std::make_tuple(1000, 2000, 3000));
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 0") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    thrown = false;
+    try {
+        numeric_cast<std::tuple<int, std::uint8_t, std::uint8_t> >(std::make_tuple(1, -1, 256));
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::negative_to_unsigned);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 1") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    thrown = false;
+    try {
+        numeric_cast<std::pair<std::uint8_t, std::int8_t> >(std::make_pair(-1, 128));
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::negative_to_unsigned);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 0") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    std::array<std::int64_t, 3> values = {{ std::int64_t(1) << 40, -(std::int64_t(1) << 40), 5 }};
+    thrown = false;
+    try {
+        numeric_cast<std::array<std::int32_t, 3> >(values);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("element 0") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Array and tuple tests
+    UTEST_FUNC(ArrayMatchesNumericCast);
+    UTEST_FUNC(ArrayErrorNamesIndex);
+    UTEST_FUNC(TupleAndPair);
+    UTEST_FUNC(FirstFailingElement);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include "../include/ncast/ncast_bfloat16.h"
+#include "../include/utest/utest.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// BFLOAT16 TYPE TESTS
+// =============================================================================
+
+// Test basic conversions, rounding and NaN handling of the raw conversion
+UTEST_FUNC_DEF(BFloat16BasicConversions) {
+    UTEST_ASSERT_EQUALS(0x3f80, bfloat16(1.0f).bits());
+    UTEST_ASSERT_EQUALS(0xc000, bfloat16(-2.0f).bits());
+    UTEST_ASSERT_EQUALS(0x4348, bfloat16(200).bits());
+    UTEST_ASSERT_EQUALS(1.0f, static_cast<float>(bfloat16::from_bits(0x3f80)));
+    UTEST_ASSERT_EQUALS(-2, static_cast<int>(bfloat16::from_bits(0xc000)));
+
+    // Round to nearest, ties to even
+    UTEST_ASSERT_EQUALS(0x3f80, bfloat16(1.0f + std::ldexp(1.0f, -8)).bits());
+    UTEST_ASSERT_EQUALS(0x3f82, bfloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)).bits());
+    UTEST_ASSERT_EQUALS(0x3f81, bfloat16(1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20)).bits());
+
+    // double -> bfloat16 rounds once (no double rounding through float)
+    double above_tie = 1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -40);
+    UTEST_ASSERT_EQUALS(0x3f81, bfloat16(above_tie).bits());
+    UTEST_ASSERT_EQUALS(0x3f80, bfloat16(1.0 + std::ldexp(1.0, -8)).bits());
+    UTEST_ASSERT_EQUALS(0x7f80, bfloat16(1.0e39).bits());
+    UTEST_ASSERT_EQUALS(0x0000, bfloat16(1.0e-300).bits());
+
+    // NaN with a payload only in the low bits must stay NaN, not become infinity
+    float low_payload_nan = detail::bits_to_float(0x7f800001u);
+    UTEST_ASSERT_TRUE(std::isnan(static_cast<float>(bfloat16(low_payload_nan))));
+    UTEST_ASSERT_TRUE(std::isnan(static_cast<float>(bfloat16(std::numeric_limits<double>::quiet_NaN()))));
+
+    // Largest finite value rounds up to infinity
+    UTEST_ASSERT_EQUALS(0x7f80, bfloat16(std::numeric_limits<float>::max()).bits());
+}
+
+// =============================================================================
+// NUMERIC_CAST INTEGRATION TESTS
+// =============================================================================
+
+// Test numeric_cast to and from bfloat16
+UTEST_FUNC_DEF(BFloat16NumericCast) {
+    UTEST_ASSERT_EQUALS(0x3e20, numeric_cast<bfloat16>(0.15625f).bits());
+    UTEST_ASSERT_EQUALS(0x4348, numeric_cast<bfloat16>(200).bits());
+    UTEST_ASSERT_EQUALS(0x3f80, numeric_cast<bfloat16>(1.001).bits());
+    UTEST_ASSERT_EQUALS(0x7f7f, numeric_cast<bfloat16>(static_cast<float>(std::numeric_limits<bfloat16>::max())).bits());
+
+    // Range: floats above bfloat16's maximum are rejected
+    UTEST_ASSERT_THROWS([](){ numeric_cast<bfloat16>(std::numeric_limits<float>::max()); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<bfloat16>(-std::numeric_limits<float>::max()); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<bfloat16>(1.0e300); });
+
+    // NaN and infinity pass through, NaN stays NaN
+    UTEST_ASSERT_TRUE(std::isnan(static_cast<float>(numeric_cast<bfloat16>(std::numeric_limits<float>::quiet_NaN()))));
+    UTEST_ASSERT_EQUALS(0xff80, numeric_cast<bfloat16>(-std::numeric_limits<float>::infinity()).bits());
+
+    // bfloat16 source
+    bfloat16 b(123.0f);
+    UTEST_ASSERT_EQUALS(123.0f, numeric_cast<float>(b));
+    UTEST_ASSERT_EQUALS(123, numeric_cast<int>(b));
+    UTEST_ASSERT_EQUALS(123u, numeric_cast<unsigned char>(b));
+    bfloat16 big(1.0e10f);
+    bfloat16 nan = std::numeric_limits<bfloat16>::quiet_NaN();
+    bfloat16 negative(-1.0f);
+    UTEST_ASSERT_THROWS([big](){ numeric_cast<int>(big); });
+    UTEST_ASSERT_THROWS([nan](){ numeric_cast<long>(nan); });
+    UTEST_ASSERT_THROWS([negative](){ numeric_cast<unsigned int>(negative); });
+
+    try {
+        bfloat16 result = NUMERIC_CAST(bfloat16, 1.0e39);
+        (void)result;
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("test_ncast_bfloat16.cpp") != std::string::npos);
+    }
+
+#if NCAST_HAS_FLOAT16
+    // _Float16 <-> bfloat16: binary16's range is narrower, bfloat16's precision is
+    UTEST_ASSERT_TRUE(numeric_cast<_Float16>(bfloat16(-1.5f)) == static_cast<_Float16>(-1.5f));
+    UTEST_ASSERT_TRUE(numeric_cast<_Float16>(bfloat16(65280.0f)) == static_cast<_Float16>(65280.0f));
+    bfloat16 beyond_half(1.0e5f);
+    UTEST_ASSERT_THROWS([beyond_half](){ numeric_cast<_Float16>(beyond_half); });
+    UTEST_ASSERT_EQUALS(0x4040, numeric_cast<bfloat16>(static_cast<_Float16>(3.0f)).bits());
+    UTEST_ASSERT_EQUALS(0x4780, numeric_cast<bfloat16>(static_cast<_Float16>(65504.0f)).bits());   // rounds up to 65536
+#endif
+}
+
+// =============================================================================
+// BULK CONVERSION TESTS
+// =============================================================================
+
+static std::vector<float> make_bfloat16_test_data() {
+    std::vector<float> data;
+    for (int i = -700; i < 700; ++i) {
+        data.push_back(static_cast<float>(i) * 0.0371f);
+        data.push_back(std::ldexp(static_cast<float>(i) + 0.5f, -135));
+        data.push_back(detail::bits_to_float(0x3f808000u + static_cast<std::uint32_t>(i + 700) * 0x10000u));
+    }
+    data.push_back(std::numeric_limits<float>::infinity());
+    data.push_back(detail::bits_to_float(0xff800001u));
+    data.push_back(std::numeric_limits<float>::quiet_NaN());
+    return data;
+}
+
+// Test unchecked bulk conversion against the scalar path
+UTEST_FUNC_DEF(BFloat16BulkConversions) {
+    std::vector<float> src = make_bfloat16_test_data();
+    src.push_back(std::numeric_limits<float>::max());
+
+    std::vector<bfloat16> out(src.size());
+    float_to_bfloat16_n(src.data(), src.size(), out.data());
+    for (size_t i = 0; i < src.size(); ++i) {
+        UTEST_ASSERT_EQUALS(bfloat16(src[i]).bits(), out[i].bits());
+    }
+
+    std::vector<float> back(out.size());
+    bfloat16_to_float_n(out.data(), out.size(), back.data());
+    for (size_t i = 0; i < out.size(); ++i) {
+        UTEST_ASSERT_EQUALS(static_cast<std::uint32_t>(out[i].bits()) << 16, detail::float_to_bits(back[i]));
+    }
+}
+
+// Test checked bulk conversion: first failure index and error kind
+UTEST_FUNC_DEF(BFloat16CheckedBulk) {
+    std::vector<float> src = make_bfloat16_test_data();
+    std::vector<bfloat16> out(src.size());
+
+    // Range checks only: everything here is in range
+    bulk_result r = try_float_to_bfloat16_n(src.data(), src.size(), out.data());
+    UTEST_ASSERT_TRUE(r.ok());
+    UTEST_ASSERT_EQUALS(src.size(), r.index);
+    for (size_t i = 0; i < src.size(); ++i) {
+        UTEST_ASSERT_EQUALS(bfloat16(src[i]).bits(), out[i].bits());
+    }
+
+    // Overflow is reported at its exact index, for every position within a SIMD block
+    for (size_t pos = 0; pos < 40; ++pos) {
+        std::vector<float> data(40, 1.0f);
+        data[pos] = -std::numeric_limits<float>::max();
+        std::vector<bfloat16> dst(data.size());
+        bulk_result overflow = try_float_to_bfloat16_n(data.data(), data.size(), dst.data());
+        UTEST_ASSERT_EQUALS(pos, overflow.index);
+        UTEST_ASSERT_TRUE(overflow.error == cast_error::negative_overflow);
+        for (size_t i = 0; i < pos; ++i) {
+            UTEST_ASSERT_EQUALS(0x3f80, dst[i].bits());
+        }
+    }
+
+    // Optional checks
+    std::vector<float> data(64, 0.5f);
+    data[37] = 1.0f + std::ldexp(1.0f, -9);
+    bulk_result exact = try_float_to_bfloat16_n(data.data(), data.size(), out.data(), float_checks::exact);
+    UTEST_ASSERT_EQUALS(37u, exact.index);
+    UTEST_ASSERT_TRUE(exact.error == cast_error::precision_loss);
+    UTEST_ASSERT_TRUE(try_float_to_bfloat16_n(data.data(), data.size(), out.data()).ok());
+
+    data[37] = 0.5f;
+    data[21] = std::numeric_limits<float>::quiet_NaN();
+    data[50] = std::numeric_limits<float>::infinity();
+    UTEST_ASSERT_TRUE(try_float_to_bfloat16_n(data.data(), data.size(), out.data(), float_checks::exact).ok());
+    bulk_result nan = try_float_to_bfloat16_n(data.data(), data.size(), out.data(), float_checks::reject_nan);
+    UTEST_ASSERT_EQUALS(21u, nan.index);
+    UTEST_ASSERT_TRUE(nan.error == cast_error::nan);
+    bulk_result inf = try_float_to_bfloat16_n(data.data(), data.size(), out.data(), float_checks::reject_infinity);
+    UTEST_ASSERT_EQUALS(50u, inf.index);
+    UTEST_ASSERT_TRUE(inf.error == cast_error::infinity);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // bfloat16 type tests
+    UTEST_FUNC(BFloat16BasicConversions);
+
+    // numeric_cast integration tests
+    UTEST_FUNC(BFloat16NumericCast);
+
+    // Bulk conversion tests
+    UTEST_FUNC(BFloat16BulkConversions);
+    UTEST_FUNC(BFloat16CheckedBulk);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
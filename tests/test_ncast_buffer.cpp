@@ -0,0 +1,273 @@
+#include "../include/ncast/ncast_buffer.h"
+#include "../include/utest/utest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// OUTPUT BUFFER TESTS
+// =============================================================================
+
+// Test batching through the output iterator into std::back_inserter
+UTEST_FUNC_DEF(BufferMatchesNumericCast) {
+    std::vector<std::int64_t> values;
+    for (std::int64_t i = 0; i < 1000; ++i) {
+        values.push_back((i - 500) * 4000000);
+    }
+    std::vector<std::int32_t> out;
+    auto buffer = make_cast_output_buffer<std::int32_t, std::int64_t>(std::back_inserter(out));
+    std::copy(values.begin(), values.end(), buffer.inserter());
+
+    // Full batches are already converted, the rest waits for flush()
+    UTEST_ASSERT_EQUALS(1000u % detail::bulk_block_size, buffer.pending());
+    UTEST_ASSERT_EQUALS(1000u - buffer.pending(), out.size());
+    UTEST_ASSERT_EQUALS(1000u, buffer.pushed());
+    buffer.flush();
+    UTEST_ASSERT_EQUALS(0u, buffer.pending());
+    UTEST_ASSERT_EQUALS(values.size(), out.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        UTEST_ASSERT_EQUALS(numeric_cast<std::int32_t>(values[i]), out[i]);
+    }
+
+    // Floating-point targets keep NaN
+    std::vector<float> floats;
+    {
+        auto float_buffer = make_cast_output_buffer<float, double, 8>(std::back_inserter(floats));
+        for (int i = 0; i < 20; ++i) {
+            float_buffer.push(i == 13 ? std::numeric_limits<double>::quiet_NaN() : i * 0.5);
+        }
+    }   // destructor flushes the last 4 values
+    UTEST_ASSERT_EQUALS(20u, floats.size());
+    UTEST_ASSERT_TRUE(std::isnan(floats[13]));
+    UTEST_ASSERT_EQUALS(9.5f, floats[19]);
+}
+
+// Test that errors report the global index and the buffer keeps working afterwards
+UTEST_FUNC_DEF(BufferGlobalErrorIndex) {
+    std::vector<std::int16_t> out;
+    cast_output_buffer<std::int16_t, std::back_insert_iterator<std::vector<std::int16_t> >, int, 16>
+        buffer(std::back_inserter(out));
+
+    bool thrown = false;
+    for (int i = 0; i < 48; ++i) {
+        try {
+            buffer.push(i == 37 ? 40000 : i);
+        } catch (const cast_exception& e) {
+            thrown = true;
+            UTEST_ASSERT_EQUALS(47, i);  // the third batch converts when it fills
+            UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+            UTEST_ASSERT_TRUE(std::string(e.what()).find("index 37") != std::string::npos);
+        }
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_EQUALS(37u, out.size());   // values before the failure
+    UTEST_ASSERT_EQUALS(36, out.back());
+    UTEST_ASSERT_EQUALS(10u, buffer.pending());   // only the failing value is dropped
+
+    // Later values keep their global index
+    buffer.push(1);
+    buffer.push(-40000);
+    bulk_result result = buffer.try_flush();
+    UTEST_ASSERT_EQUALS(49u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::negative_overflow);
+    UTEST_ASSERT_EQUALS(48u, out.size());
+    UTEST_ASSERT_EQUALS(47, out[46]);
+    UTEST_ASSERT_EQUALS(1, out.back());
+
+    buffer.push(5);
+    result = buffer.try_flush();
+    UTEST_ASSERT_TRUE(result.ok());
+    UTEST_ASSERT_EQUALS(51u, result.index);
+    UTEST_ASSERT_EQUALS(51u, buffer.pushed());
+    UTEST_ASSERT_EQUALS(49u, out.size());
+
+    // Dead-letter loop: several failures in one batch are skipped one at a time
+    std::vector<size_t> dead;
+    for (int i = 0; i < 10; ++i) {
+        buffer.push(i % 3 == 0 ? 70000 : i);
+    }
+    for (bulk_result r = buffer.try_flush(); !r.ok(); r = buffer.try_flush()) {
+        dead.push_back(r.index);
+    }
+    UTEST_ASSERT_EQUALS(4u, dead.size());
+    UTEST_ASSERT_EQUALS(51u, dead[0]);
+    UTEST_ASSERT_EQUALS(60u, dead[3]);
+    UTEST_ASSERT_EQUALS(55u, out.size());
+    UTEST_ASSERT_EQUALS(8, out.back());
+}
+
+// Output iterator that throws when the counter runs out
+struct throwing_output {
+    int* remaining;
+
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    throwing_output& operator=(int) {
+        if ((*remaining)-- == 0) {
+            throw std::runtime_error("output full");
+        }
+        return *this;
+    }
+    throwing_output& operator*() { return *this; }
+    throwing_output& operator++() { return *this; }
+    throwing_output& operator++(int) { return *this; }
+};
+
+// Test that the destructor skips failing values and swallows output exceptions
+UTEST_FUNC_DEF(BufferDestructor) {
+    std::vector<std::uint8_t> out;
+    {
+        auto buffer = make_cast_output_buffer<std::uint8_t, int, 8>(std::back_inserter(out));
+        buffer.push(1);
+        buffer.push(-1);
+        buffer.push(2);
+        buffer.push(300);
+        buffer.push(3);
+    }   // destructor writes 1, 2, 3
+    UTEST_ASSERT_EQUALS(3u, out.size());
+    UTEST_ASSERT_EQUALS(3, out[2]);
+
+    int remaining = 2;
+    bool thrown = false;
+    try {
+        throwing_output sink = { &remaining };
+        auto buffer = make_cast_output_buffer<int, long, 8>(sink);
+        for (long i = 0; i < 5; ++i) {
+            buffer.push(i);
+        }
+        try {
+            buffer.flush();
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        UTEST_ASSERT_EQUALS(5u, buffer.pending());   // pending values are kept when the output throws
+    }   // the destructor's flush throws again and must not terminate
+    catch (...) {
+        UTEST_ASSERT_TRUE(false);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test that a buffer left full by a throwing output flushes before storing the next value
+UTEST_FUNC_DEF(BufferThrowingOutputWhenFull) {
+    int remaining = 2;
+    throwing_output sink = { &remaining };
+    auto buffer = make_cast_output_buffer<int, long, 4>(sink);
+    for (long i = 0; i < 3; ++i) {
+        buffer.push(i);
+    }
+    bool thrown = false;
+    try {
+        buffer.push(3);   // fills the batch, the output throws at the third value
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_EQUALS(4u, buffer.pending());
+
+    // The output accepts values again: the full batch is written first
+    remaining = 100;
+    buffer.push(4);
+    UTEST_ASSERT_EQUALS(1u, buffer.pending());
+    UTEST_ASSERT_EQUALS(5u, buffer.pushed());
+    UTEST_ASSERT_EQUALS(96, remaining);
+
+    // The output throws again while the buffer is full: the new value is not added
+    buffer.push(5);
+    buffer.push(6);
+    remaining = 0;
+    thrown = false;
+    try {
+        buffer.push(7);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_EQUALS(4u, buffer.pending());
+    remaining = 0;
+    thrown = false;
+    try {
+        buffer.push(8);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_EQUALS(4u, buffer.pending());
+    UTEST_ASSERT_EQUALS(8u, buffer.pushed());
+
+    // A failing value in the full batch is reported and the new value is kept
+    long bad = std::numeric_limits<long>::max();
+    remaining = 100;
+    throwing_output failing_sink = { &remaining };
+    auto failing = make_cast_output_buffer<int, long, 4>(failing_sink);
+    failing.push(0);
+    failing.push(bad);
+    failing.push(2);
+    remaining = 0;
+    thrown = false;
+    try {
+        failing.push(3);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    remaining = 100;
+    thrown = false;
+    try {
+        failing.push(4);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("index 1") != std::string::npos);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_EQUALS(3u, failing.pending());   // 2, 3 and the new value
+    UTEST_ASSERT_EQUALS(5u, failing.pushed());
+}
+
+// Test plain pointers as output and moving a buffer with pending values
+UTEST_FUNC_DEF(BufferPointerOutput) {
+    std::vector<std::uint8_t> out(100, 0xee);
+    auto buffer = make_cast_output_buffer<std::uint8_t, double, 32>(out.data());
+    for (int i = 0; i < 70; ++i) {
+        buffer.push(static_cast<double>(i * 3));
+    }
+    UTEST_ASSERT_TRUE(buffer.output() == out.data() + 64);
+
+    auto moved = std::move(buffer);
+    UTEST_ASSERT_EQUALS(0u, buffer.pending());
+    UTEST_ASSERT_EQUALS(6u, moved.pending());
+    moved.push(-1.0);
+    bulk_result result = moved.try_flush();
+    UTEST_ASSERT_EQUALS(70u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::negative_overflow);
+    UTEST_ASSERT_TRUE(moved.output() == out.data() + 70);
+    UTEST_ASSERT_EQUALS(207, out[69]);
+    UTEST_ASSERT_EQUALS(0xee, out[70]);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Output buffer tests
+    UTEST_FUNC(BufferMatchesNumericCast);
+    UTEST_FUNC(BufferGlobalErrorIndex);
+    UTEST_FUNC(BufferPointerOutput);
+    UTEST_FUNC(BufferDestructor);
+    UTEST_FUNC(BufferThrowingOutputWhenFull);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+#include "../include/ncast/ncast_bulk.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// try_numeric_cast_n against element-wise numeric_cast: failure index and kind,
+// converted prefix, untouched rest
+template<typename To, typename From>
+static bool check_first_failure(const std::vector<From>& values) {
+    std::vector<To> dst(values.size(), To(3));
+    bulk_result result = try_numeric_cast_n(values.data(), values.size(), dst.data());
+    size_t expected = values.size();
+    for (size_t i = 0; i < values.size() && expected == values.size(); ++i) {
+        expected = passes_reference_cast<To>(values[i]) ? values.size() : i;
+    }
+    if (result.index != expected || result.ok() != (expected == values.size())) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (dst[i] != (i < expected ? static_cast<To>(values[i]) : To(3))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Same-width sign changes: a failure at every position of arrays spanning several blocks
+template<typename To, typename From>
+static bool check_sign_change(From bad) {
+    for (size_t size = 0; size < 700; size += 13) {
+        std::vector<From> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = static_cast<From>(i % 100);
+        }
+        if (!check_first_failure<To>(values)) {
+            return false;
+        }
+        for (size_t pos = 0; pos < size; pos += 7) {
+            std::vector<From> failing(values);
+            failing[pos] = bad;
+            if (!check_first_failure<To>(failing)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Exact reference: the value survives a round trip through To (long double holds any 64-bit integer)
+template<typename To, typename From>
+static bool is_exact(From value) {
+    return static_cast<long double>(static_cast<To>(value)) == static_cast<long double>(value);
+}
+
+// try_numeric_cast_n with float_checks::exact against the round-trip reference
+template<typename To, typename From>
+static bool check_exact(const std::vector<From>& values) {
+    std::vector<To> dst(values.size(), To(3));
+    bulk_result result = try_numeric_cast_n(values.data(), values.size(), dst.data(), float_checks::exact);
+    size_t expected = values.size();
+    for (size_t i = 0; i < values.size() && expected == values.size(); ++i) {
+        expected = is_exact<To>(values[i]) ? values.size() : i;
+    }
+    if (result.index != expected ||
+        result.error != (expected == values.size() ? cast_error::none : cast_error::precision_loss)) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (dst[i] != (i < expected ? static_cast<To>(values[i]) : To(3))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reference classification of double -> float under float_checks, built on numeric_cast
+static cast_error expected_double_to_float(double value, float_checks checks) {
+    if (std::isnan(value)) {
+        return has_check(checks, float_checks::reject_nan) ? cast_error::nan : cast_error::none;
+    }
+    if (std::isinf(value)) {
+        return has_check(checks, float_checks::reject_infinity) ? cast_error::infinity : cast_error::none;
+    }
+    if (!passes_reference_cast<float>(value)) {
+        return value < 0 ? cast_error::negative_overflow : cast_error::positive_overflow;
+    }
+    if (has_check(checks, float_checks::reject_underflow) && value != 0.0 &&
+        std::fabs(value) < static_cast<double>(std::numeric_limits<float>::min())) {
+        return cast_error::underflow;
+    }
+    if (has_check(checks, float_checks::exact) && static_cast<double>(static_cast<float>(value)) != value) {
+        return cast_error::precision_loss;
+    }
+    return cast_error::none;
+}
+
+static bool same_float(float a, float b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// try_numeric_cast_n double -> float with float_checks against the reference:
+// first failure, converted prefix and untouched remainder
+static bool check_double_to_float(const std::vector<double>& values, float_checks checks) {
+    std::vector<float> dst(values.size(), 3.0f);
+    bulk_result result = try_numeric_cast_n(values.data(), values.size(), dst.data(), checks);
+    size_t expected = values.size();
+    cast_error expected_error = cast_error::none;
+    for (size_t i = 0; i < values.size() && expected == values.size(); ++i) {
+        expected_error = expected_double_to_float(values[i], checks);
+        expected = expected_error == cast_error::none ? values.size() : i;
+    }
+    if (result.index != expected || result.error != expected_error) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (!same_float(dst[i], i < expected ? static_cast<float>(values[i]) : 3.0f)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Values around the significand limit, shifted through the whole range, one at a time and in blocks
+template<typename To, typename From>
+static bool check_exact_patterns() {
+    const int digits = std::numeric_limits<To>::digits;
+    const int bits = std::numeric_limits<From>::digits;
+    std::vector<From> candidates;
+    candidates.push_back(0);
+    candidates.push_back(std::numeric_limits<From>::max());
+    candidates.push_back(std::numeric_limits<From>::min());
+    for (int shift = 0; shift + digits < bits + 1 && digits < bits; ++shift) {
+        std::uint64_t limit = std::uint64_t(1) << digits;
+        const std::uint64_t near[] = { limit - 1, limit, limit + 1, limit + 2, 2 * limit - 1, 2 * limit + 1 };
+        for (std::uint64_t value : near) {
+            std::uint64_t shifted = value << shift;
+            if ((shifted >> shift) == value && shifted <= static_cast<std::uint64_t>(std::numeric_limits<From>::max())) {
+                candidates.push_back(static_cast<From>(shifted));
+                if (std::numeric_limits<From>::is_signed) {
+                    candidates.push_back(static_cast<From>(0 - static_cast<From>(shifted)));
+                }
+            }
+        }
+    }
+    for (From value : candidates) {
+        if (!check_exact<To>(std::vector<From>(1, value))) {
+            return false;
+        }
+    }
+    std::vector<From> values(600, static_cast<From>(1 << 20));
+    if (!check_exact<To>(values)) {
+        return false;
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        std::vector<From> failing(values);
+        failing[(i * 37) % failing.size()] = candidates[i];
+        if (!check_exact<To>(failing)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// FIRST-FAILURE MODE TESTS
+// =============================================================================
+
+// Test the generic checked conversion that stops at the first failure
+UTEST_FUNC_DEF(TryNumericCastN) {
+    std::vector<double> values(1000, 2.5);
+    std::vector<std::int8_t> narrow(values.size(), 9);
+    bulk_result result = try_numeric_cast_n(values.data(), values.size(), narrow.data());
+    UTEST_ASSERT_TRUE(result.ok());
+    UTEST_ASSERT_EQUALS(2, narrow[999]);
+
+    values[600] = std::numeric_limits<double>::quiet_NaN();
+    values[700] = 300.0;
+    std::vector<std::int8_t> partial(values.size(), 9);
+    result = try_numeric_cast_n(values.data(), values.size(), partial.data());
+    UTEST_ASSERT_EQUALS(600u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::nan);
+    UTEST_ASSERT_EQUALS(2, partial[599]);
+    UTEST_ASSERT_EQUALS(9, partial[600]);
+
+    bool thrown = false;
+    try {
+        numeric_cast_n(values.data() + 601, values.size() - 601, partial.data());
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test the sign-bit OR-reduction path of same-width signed <-> unsigned conversions
+UTEST_FUNC_DEF(TryNumericCastNSignChange) {
+    UTEST_ASSERT_TRUE((check_sign_change<std::uint8_t, std::int8_t>(-1)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::int8_t, std::uint8_t>(128)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::uint16_t, std::int16_t>(std::numeric_limits<std::int16_t>::min())));
+    UTEST_ASSERT_TRUE((check_sign_change<std::int16_t, std::uint16_t>(0xffff)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::uint32_t, std::int32_t>(-5)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::int32_t, std::uint32_t>(0x80000000u)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::uint64_t, std::int64_t>(-1)));
+    UTEST_ASSERT_TRUE((check_sign_change<std::int64_t, std::uint64_t>(~std::uint64_t(0))));
+
+    std::vector<std::int32_t> values(1000, 7);
+    values[513] = -1;
+    std::vector<std::uint32_t> out(values.size());
+    bulk_result result = try_numeric_cast_n(values.data(), values.size(), out.data());
+    UTEST_ASSERT_EQUALS(513u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::negative_to_unsigned);
+
+    std::vector<std::uint64_t> big(100, 1u);
+    big[99] = std::uint64_t(1) << 63;
+    std::vector<std::int64_t> signed_big(big.size());
+    result = try_numeric_cast_n(big.data(), big.size(), signed_big.data());
+    UTEST_ASSERT_EQUALS(99u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::positive_overflow);
+
+    // Misaligned source and destination
+    std::vector<std::int16_t> shorts(2000, 3);
+    shorts[1500] = -3;
+    std::vector<std::uint16_t> ushorts(2001, 9);
+    result = try_numeric_cast_n(shorts.data() + 1, shorts.size() - 1, ushorts.data() + 1);
+    UTEST_ASSERT_EQUALS(1499u, result.index);
+    UTEST_ASSERT_EQUALS(9, ushorts[0]);
+    UTEST_ASSERT_EQUALS(3, ushorts[1499]);
+    UTEST_ASSERT_EQUALS(9, ushorts[1500]);
+}
+
+// Test the exactness mode of integer -> floating-point bulk conversion
+UTEST_FUNC_DEF(TryNumericCastNExact) {
+    UTEST_ASSERT_TRUE((check_exact_patterns<float, std::int32_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<float, std::uint32_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<float, std::int64_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<double, std::int64_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<double, std::uint64_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<double, std::int32_t>()));
+    UTEST_ASSERT_TRUE((check_exact_patterns<float, std::int16_t>()));
+
+    std::vector<std::int32_t> ids(1000, 16777216);   // 2^24
+    ids[10] = -16777216;
+    ids[800] = 16777217;                             // 2^24 + 1 rounds in float
+    std::vector<float> out(ids.size(), -1.0f);
+    bulk_result result = try_numeric_cast_n(ids.data(), ids.size(), out.data(), float_checks::exact);
+    UTEST_ASSERT_EQUALS(800u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::precision_loss);
+    UTEST_ASSERT_EQUALS(-16777216.0f, out[10]);
+    UTEST_ASSERT_EQUALS(-1.0f, out[800]);
+
+    // Large values with enough trailing zeros are exact
+    ids[800] = 16777217 * 64;
+    UTEST_ASSERT_TRUE(try_numeric_cast_n(ids.data(), ids.size(), out.data(), float_checks::exact).index == 800u);
+    ids[800] = 16777216 * 64 + 128;
+    UTEST_ASSERT_TRUE(try_numeric_cast_n(ids.data(), ids.size(), out.data(), float_checks::exact).ok());
+
+    // Without exact, rounding is allowed as with numeric_cast
+    ids[800] = 16777217;
+    UTEST_ASSERT_TRUE(try_numeric_cast_n(ids.data(), ids.size(), out.data(), float_checks::none).ok());
+
+    std::vector<std::int64_t> big(5, (std::int64_t(1) << 53) + 1);
+    std::vector<double> doubles(big.size());
+    bool thrown = false;
+    try {
+        numeric_cast_n(big.data(), big.size(), doubles.data(), float_checks::exact);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::precision_loss);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test double -> float bulk narrowing with overflow, underflow, NaN, infinity and exactness checks
+UTEST_FUNC_DEF(TryNumericCastNDoubleToFloat) {
+    const double flt_max = static_cast<double>(std::numeric_limits<float>::max());
+    const double flt_min = static_cast<double>(std::numeric_limits<float>::min());
+    const double specials[] = {
+        std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+        flt_max, -flt_max, std::nextafter(flt_max, 1e300), -std::nextafter(flt_max, 1e300), 1e39, -1e300,
+        flt_min, -flt_min, std::nextafter(flt_min, 0.0), -1e-39, 1e-50, std::numeric_limits<double>::denorm_min(),
+        0.0, -0.0, 0.1, -2.5, 16777217.0
+    };
+    const float_checks modes[] = {
+        float_checks::none, float_checks::exact, float_checks::reject_nan, float_checks::reject_infinity,
+        float_checks::reject_underflow,
+        float_checks::exact | float_checks::reject_nan | float_checks::reject_infinity | float_checks::reject_underflow
+    };
+    // Every special value at every position of arrays covering whole SIMD steps and tails
+    for (float_checks checks : modes) {
+        for (double special : specials) {
+            for (size_t size = 1; size <= 40; ++size) {
+                for (size_t position = 0; position < size; ++position) {
+                    std::vector<double> values(size, 1.5);
+                    values[position] = special;
+                    UTEST_ASSERT_TRUE(check_double_to_float(values, checks));
+                }
+            }
+        }
+    }
+
+    // Large batch: the first of several failures, later groups untouched
+    std::vector<double> features(10000, 0.25);
+    features[7001] = 1e-45;
+    features[9000] = 1e40;
+    UTEST_ASSERT_TRUE(check_double_to_float(features, float_checks::none));
+    UTEST_ASSERT_TRUE(check_double_to_float(features, float_checks::reject_underflow));
+    std::vector<float> stored(features.size());
+    bulk_result result = try_numeric_cast_n(features.data(), features.size(), stored.data(), float_checks::reject_underflow);
+    UTEST_ASSERT_EQUALS(7001u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::underflow);
+
+    // Misaligned source and destination
+    std::vector<double> shifted(features.begin(), features.begin() + 7002);
+    std::vector<float> shifted_out(shifted.size(), 3.0f);
+    result = try_numeric_cast_n(shifted.data() + 1, shifted.size() - 1, shifted_out.data() + 1, float_checks::reject_underflow);
+    UTEST_ASSERT_EQUALS(7000u, result.index);
+    UTEST_ASSERT_EQUALS(3.0f, shifted_out[0]);
+    UTEST_ASSERT_EQUALS(0.25f, shifted_out[7000]);
+    UTEST_ASSERT_EQUALS(3.0f, shifted_out[7001]);
+
+    bool thrown = false;
+    try {
+        numeric_cast_n(features.data(), features.size(), stored.data(), float_checks::reject_underflow);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::underflow);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // First-failure mode tests
+    UTEST_FUNC(TryNumericCastN);
+    UTEST_FUNC(TryNumericCastNSignChange);
+    UTEST_FUNC(TryNumericCastNExact);
+    UTEST_FUNC(TryNumericCastNDoubleToFloat);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
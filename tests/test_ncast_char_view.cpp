@@ -0,0 +1,123 @@
+#include "../include/ncast/ncast_char_view.h"
+#include "../include/utest/utest.h"
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// CHAR VIEW TESTS
+// =============================================================================
+
+// Result types: the target char type, const when the source is const
+static_assert(std::is_same<decltype(char_cast_view<unsigned char>(std::declval<std::string&>())),
+                           char_span<unsigned char> >::value, "mutable string gives a mutable view");
+static_assert(std::is_same<decltype(char_cast_view<unsigned char>(std::declval<const std::string&>())),
+                           char_span<const unsigned char> >::value, "const string gives a const view");
+static_assert(std::is_same<decltype(char_cast_view<signed char>(std::declval<std::vector<unsigned char>&>())),
+                           char_span<signed char> >::value, "vector of bytes gives a signed char view");
+static_assert(std::is_same<decltype(char_cast_view<const char>(std::declval<std::vector<signed char>&>())),
+                           char_span<const char> >::value, "a const target type gives a const view");
+static_assert(std::is_convertible<char_span<char>, char_span<const char> >::value, "views add const");
+static_assert(!std::is_convertible<char_span<const char>, char_span<char> >::value, "views never drop const");
+
+// Every element of the view equals char_cast of the source element
+template<typename To, typename Span, typename Source>
+static bool matches_char_cast(Span view, const Source& source) {
+    if (view.size() != source.size()) {
+        return false;
+    }
+    size_t i = 0;
+    for (auto c : view) {
+        if (c != char_cast<To>(source[i++])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Test views over strings: no copy, same elements as char_cast
+UTEST_FUNC_DEF(StringViews) {
+    std::string text("ncast \x80\xff\x7f bytes");
+    char_span<unsigned char> bytes = char_cast_view<unsigned char>(text);
+    UTEST_ASSERT_TRUE(static_cast<const void*>(bytes.data()) == static_cast<const void*>(text.data()));
+    UTEST_ASSERT_TRUE((matches_char_cast<unsigned char>(bytes, text)));
+    UTEST_ASSERT_EQUALS(0x80, bytes[6]);
+    UTEST_ASSERT_EQUALS(0xff, bytes[7]);
+
+    // Writes through a mutable view change the string
+    bytes[0] = static_cast<unsigned char>('N');
+    UTEST_ASSERT_EQUALS('N', text[0]);
+
+    const std::string& constant = text;
+    char_span<const signed char> signed_bytes = char_cast_view<signed char>(constant);
+    UTEST_ASSERT_TRUE((matches_char_cast<signed char>(signed_bytes, text)));
+    UTEST_ASSERT_EQUALS(-1, signed_bytes[7]);
+
+    std::string empty;
+    UTEST_ASSERT_TRUE(char_cast_view<unsigned char>(empty).empty());
+    UTEST_ASSERT_EQUALS(0u, char_cast_view<unsigned char>(empty).size());
+
+#if NCAST_HAS_CPP17
+    std::string_view view = text;
+    char_span<const unsigned char> from_view = char_cast_view<unsigned char>(view.substr(6, 3));
+    UTEST_ASSERT_EQUALS(3u, from_view.size());
+    UTEST_ASSERT_EQUALS(0x7f, from_view[2]);
+#endif
+}
+
+// Test views over byte buffers, arrays and other views
+UTEST_FUNC_DEF(BufferViews) {
+    std::vector<unsigned char> buffer;
+    for (int i = 0; i < 256; ++i) {
+        buffer.push_back(static_cast<unsigned char>(i));
+    }
+    char_span<char> chars = char_cast_view<char>(buffer);
+    UTEST_ASSERT_TRUE((matches_char_cast<char>(chars, buffer)));
+    UTEST_ASSERT_TRUE(static_cast<void*>(chars.data()) == static_cast<void*>(buffer.data()));
+
+    const std::vector<unsigned char>& constant = buffer;
+    char_span<const signed char> signed_chars = char_cast_view<signed char>(constant);
+    UTEST_ASSERT_TRUE((matches_char_cast<signed char>(signed_chars, buffer)));
+    UTEST_ASSERT_EQUALS(-128, signed_chars[128]);
+
+    // Pointer and length
+    char_span<const unsigned char> header = char_cast_view<unsigned char>(signed_chars.data(), 4);
+    UTEST_ASSERT_EQUALS(4u, header.size());
+    UTEST_ASSERT_EQUALS(3, header[3]);
+
+    // Arrays keep their full extent, including a literal's terminating zero
+    char_span<const unsigned char> literal = char_cast_view<unsigned char>("abc");
+    UTEST_ASSERT_EQUALS(4u, literal.size());
+    UTEST_ASSERT_EQUALS(0, literal[3]);
+    signed char raw[3] = { -1, 0, 1 };
+    char_span<unsigned char> raw_bytes = char_cast_view<unsigned char>(raw);
+    UTEST_ASSERT_EQUALS(255, raw_bytes[0]);
+
+    // Views of views, sub-ranges and const conversion
+    char_span<unsigned char> again = char_cast_view<unsigned char>(chars);
+    UTEST_ASSERT_TRUE(again.data() == buffer.data());
+    char_span<unsigned char> middle = again.subspan(100, 10);
+    UTEST_ASSERT_EQUALS(10u, middle.size());
+    UTEST_ASSERT_EQUALS(109, middle[9]);
+    UTEST_ASSERT_EQUALS(6u, again.subspan(250).size());
+    char_span<const unsigned char> read_only = middle;
+    UTEST_ASSERT_EQUALS(100, read_only[0]);
+
+    char_span<char> none;
+    UTEST_ASSERT_TRUE(none.empty() && none.begin() == none.end());
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    UTEST_FUNC(StringViews);
+    UTEST_FUNC(BufferViews);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -83,6 +83,27 @@ UTEST_FUNC_DEF(MacroExceptionInfo) {
     UTEST_ASSERT_EQUALS(42, valid_result);
 }
 
+// Test that exceptions report the reason of the failure
+UTEST_FUNC_DEF(ExceptionErrorKinds) {
+    auto error_of = [](void (*f)()) {
+        try {
+            f();
+        } catch (const cast_exception& e) {
+            return e.getError();
+        }
+        return cast_error::none;
+    };
+    
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<unsigned int>(-1); }) == cast_error::negative_to_unsigned);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<signed char>(1000); }) == cast_error::positive_overflow);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<short>(-100000L); }) == cast_error::negative_overflow);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<float>(1.0e300); }) == cast_error::positive_overflow);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<int>(std::numeric_limits<double>::quiet_NaN()); }) == cast_error::nan);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<int>(std::numeric_limits<float>::infinity()); }) == cast_error::infinity);
+    UTEST_ASSERT_TRUE(error_of([](){ NUMERIC_CAST(unsigned char, 256); }) == cast_error::positive_overflow);
+    UTEST_ASSERT_TRUE(error_of([](){ numeric_cast<int>(42u); }) == cast_error::none);
+}
+
 // =============================================================================
 // INTEGRATION TESTS
 // =============================================================================
@@ -125,6 +146,7 @@ int main() {
     // Macro tests
     UTEST_FUNC(MacroVersions);
     UTEST_FUNC(MacroExceptionInfo);
+    UTEST_FUNC(ExceptionErrorKinds);
     
     // Integration tests
     UTEST_FUNC(IntegrationTests);
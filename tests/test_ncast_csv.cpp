@@ -0,0 +1,184 @@
+#include "../include/ncast/ncast_csv.h"
+#include "../include/utest/utest.h"
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+static csv_result parse_text(const csv_columns& columns, const std::string& text) {
+    return columns.parse(text.data(), text.size());
+}
+
+static bool has_error(const csv_result& r, size_t index, size_t row, size_t column, cast_error error) {
+    return index < r.errors.size() && r.errors[index].row == row && r.errors[index].column == column
+        && r.errors[index].error == error;
+}
+
+// Rows of sensor readings (id, label, level, temperature) with a few bad fields spread over the text
+static std::string generate_readings(size_t rows, std::vector<size_t>& bad_rows) {
+    std::mt19937 gen(7);
+    std::string text = "id,label,level,temperature\n";
+    char line[128];
+    for (size_t row = 0; row < rows; ++row) {
+        const bool bad = gen() % 5000u == 0;
+        if (bad) {
+            bad_rows.push_back(row);
+            std::snprintf(line, sizeof(line), "%u,sensor %u,%s,%.2f\n", static_cast<unsigned>(row),
+                          static_cast<unsigned>(row % 97), "40000", static_cast<double>(gen() % 10000u) / 100.0);
+        } else {
+            std::snprintf(line, sizeof(line), "%u,sensor %u,%d,%.2f\n", static_cast<unsigned>(row),
+                          static_cast<unsigned>(row % 97), static_cast<int>(gen() % 60001u) - 30000,
+                          static_cast<double>(gen() % 10000u) / 100.0);
+        }
+        text += line;
+    }
+    return text;
+}
+
+// =============================================================================
+// CSV TESTS
+// =============================================================================
+
+// Test values, error kinds and positions on a small text
+UTEST_FUNC_DEF(CsvColumns) {
+    std::vector<std::uint32_t> ids;
+    std::vector<std::int16_t> levels;
+    std::vector<float> temperatures;
+    csv_columns columns(',', true);
+    columns.add(2, levels).add(0, ids).add(3, temperatures);
+
+    const std::string text =
+        "id,label,level,temperature\r\n"
+        "1,north,-120,21.5\r\n"
+        "2,south,40000,19\n"          // overflow
+        "3,east,12kg,1e40\n"          // text after the number, float overflow
+        "-4,west,7\n"                 // negative id, missing temperature
+        "5,,,\n"                      // empty level and temperature
+        "\n"                          // empty line
+        "6,\"quoted, label\",8,0.25";  // no quoting: the quoted comma still separates fields
+    csv_result r = parse_text(columns, text);
+
+    UTEST_ASSERT_EQUALS(7u, r.rows);
+    UTEST_ASSERT_EQUALS(7u, ids.size());
+    UTEST_ASSERT_EQUALS(7u, levels.size());
+    UTEST_ASSERT_EQUALS(7u, temperatures.size());
+    UTEST_ASSERT_EQUALS(1u, ids[0]);
+    UTEST_ASSERT_EQUALS(-120, levels[0]);
+    UTEST_ASSERT_TRUE(temperatures[0] == 21.5f);
+    UTEST_ASSERT_TRUE(temperatures[1] == 19.0f);
+    UTEST_ASSERT_EQUALS(0, levels[1]);
+
+    UTEST_ASSERT_EQUALS(11u, r.errors.size());
+    UTEST_ASSERT_TRUE(has_error(r, 0, 1, 2, cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE(has_error(r, 1, 2, 2, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 2, 2, 3, cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE(has_error(r, 3, 3, 0, cast_error::negative_to_unsigned));
+    UTEST_ASSERT_TRUE(has_error(r, 4, 3, 3, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 5, 4, 2, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 6, 4, 3, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 7, 5, 0, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 8, 5, 2, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 9, 5, 3, cast_error::invalid_format));
+    UTEST_ASSERT_TRUE(has_error(r, 10, 6, 2, cast_error::invalid_format));
+    UTEST_ASSERT_EQUALS(7, levels[3]);
+    UTEST_ASSERT_EQUALS(6u, ids[6]);
+
+    // Fields are counted by delimiters: field 3 of the last row is "8"
+    UTEST_ASSERT_EQUALS(0, levels[6]);
+    UTEST_ASSERT_TRUE(temperatures[6] == 8.0f);
+    UTEST_ASSERT_FALSE(r.ok());
+}
+
+// Test delimiters, repeated bindings, headerless and empty texts
+UTEST_FUNC_DEF(CsvOptions) {
+    std::vector<std::int64_t> a;
+    std::vector<std::uint8_t> b;
+    std::vector<half> c;
+    csv_columns columns(';');
+    columns.add(1, b).add(0, a).add(1, c);
+
+    csv_result r = parse_text(columns, "9000000000;255;1.5\n-1;256\n");
+    UTEST_ASSERT_EQUALS(2u, r.rows);
+    UTEST_ASSERT_EQUALS(9000000000LL, a[0]);
+    UTEST_ASSERT_EQUALS(255, b[0]);
+    UTEST_ASSERT_TRUE(c[0] == half(255.0f));
+    UTEST_ASSERT_EQUALS(-1, a[1]);
+    UTEST_ASSERT_EQUALS(1u, r.errors.size());
+    UTEST_ASSERT_TRUE(has_error(r, 0, 1, 1, cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE(c[1] == half(256.0f));
+
+    // Contents are replaced, not appended
+    r = parse_text(columns, "1;2");
+    UTEST_ASSERT_TRUE(r.ok());
+    UTEST_ASSERT_EQUALS(1u, a.size());
+    UTEST_ASSERT_EQUALS(2, b[0]);
+
+    r = parse_text(columns, "");
+    UTEST_ASSERT_TRUE(r.ok() && r.rows == 0 && a.empty() && b.empty());
+
+    csv_columns with_header(',', true);
+    with_header.add(0, a);
+    r = parse_text(with_header, "only a header");
+    UTEST_ASSERT_TRUE(r.ok() && r.rows == 0);
+}
+
+// Test a multi-chunk text: every thread count gives the same columns and errors
+UTEST_FUNC_DEF(CsvChunks) {
+    std::vector<size_t> bad_rows;
+    const std::string text = generate_readings(150000, bad_rows);
+    UTEST_ASSERT_TRUE(text.size() > 3 * detail::csv_chunk_bytes);
+    UTEST_ASSERT_FALSE(bad_rows.empty());
+
+    std::vector<std::uint32_t> ids;
+    std::vector<std::int16_t> levels;
+    std::vector<double> temperatures;
+    csv_columns columns(',', true);
+    columns.add(0, ids).add(2, levels).add(3, temperatures);
+    csv_result sequential = parse_text(columns, text);
+    UTEST_ASSERT_EQUALS(150000u, sequential.rows);
+    UTEST_ASSERT_EQUALS(bad_rows.size(), sequential.errors.size());
+    for (size_t i = 0; i < bad_rows.size(); ++i) {
+        UTEST_ASSERT_TRUE(has_error(sequential, i, bad_rows[i], 2, cast_error::positive_overflow));
+    }
+    for (size_t row = 0; row < ids.size(); ++row) {
+        UTEST_ASSERT_EQUALS(row, ids[row]);
+    }
+
+    const std::vector<std::int16_t> expected_levels = levels;
+    const std::vector<double> expected_temperatures = temperatures;
+    for (unsigned threads = 2; threads <= 5; ++threads) {
+        thread_pool pool(threads);
+        csv_result r = columns.parse(text.data(), text.size(), pool);
+        UTEST_ASSERT_EQUALS(sequential.rows, r.rows);
+        UTEST_ASSERT_EQUALS(sequential.errors.size(), r.errors.size());
+        for (size_t i = 0; i < r.errors.size(); ++i) {
+            UTEST_ASSERT_TRUE(has_error(r, i, sequential.errors[i].row, 2, cast_error::positive_overflow));
+        }
+        UTEST_ASSERT_TRUE(levels == expected_levels);
+        UTEST_ASSERT_TRUE(temperatures == expected_temperatures);
+        for (size_t row = 0; row < ids.size(); ++row) {
+            UTEST_ASSERT_EQUALS(row, ids[row]);
+        }
+    }
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    UTEST_FUNC(CsvColumns);
+    UTEST_FUNC(CsvOptions);
+    UTEST_FUNC(CsvChunks);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
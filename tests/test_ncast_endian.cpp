@@ -0,0 +1,228 @@
+#include "../include/ncast/ncast_endian.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Big-endian bytes of value, written most significant byte first
+template<typename T>
+static void store_be(T value, unsigned char* out) {
+    typename detail::wire_bits<sizeof(T)>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    for (size_t k = 0; k < sizeof(T); ++k) {
+        out[sizeof(T) - 1 - k] = static_cast<unsigned char>(bits >> (8 * k));
+    }
+}
+
+// Wire buffer of values at a byte offset, so that fields are unaligned
+template<typename T>
+static std::vector<unsigned char> to_wire(const std::vector<T>& values, size_t offset) {
+    std::vector<unsigned char> bytes(offset + values.size() * sizeof(T) + 1, 0xee);
+    for (size_t i = 0; i < values.size(); ++i) {
+        store_be(values[i], &bytes[offset + i * sizeof(T)]);
+    }
+    return bytes;
+}
+
+// Convert values from a wire buffer at every offset 0-3 and compare with element-wise numeric_cast;
+// the destination past the failing element must be untouched
+template<typename To, typename Wire>
+static bool check_wire(const std::vector<Wire>& values) {
+    const bulk_result expected = reference_result<To>(values);
+    for (size_t offset = 0; offset < 4; ++offset) {
+        std::vector<unsigned char> bytes = to_wire(values, offset);
+        std::vector<To> out(values.size() + 1, static_cast<To>(42));
+        bulk_result r = try_load_be_cast_n<To, Wire>(&bytes[offset], values.size(), out.data());
+        if (r.index != expected.index || r.error != expected.error) {
+            return false;
+        }
+        for (size_t i = 0; i < out.size(); ++i) {
+            if (i < r.index ? out[i] != static_cast<To>(values[i]) : out[i] != static_cast<To>(42)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Values around every limit of To, shuffled into random in-range values
+template<typename To, typename Wire>
+static std::vector<Wire> limit_values(std::mt19937_64& gen, size_t count) {
+    const long double lo = static_cast<long double>(std::numeric_limits<To>::lowest());
+    const long double hi = static_cast<long double>(std::numeric_limits<To>::max());
+    std::vector<Wire> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<Wire>(std::numeric_limits<To>::max() / 3);
+    }
+    const Wire wire_lo = std::numeric_limits<Wire>::lowest();
+    const Wire wire_hi = std::numeric_limits<Wire>::max();
+    const long double edges[] = { lo - 1, lo, lo + 1, -1, 0, 1, hi - 1, hi, hi + 1 };
+    for (long double edge : edges) {
+        if (edge >= static_cast<long double>(wire_lo) && edge <= static_cast<long double>(wire_hi)) {
+            values[gen() % count] = static_cast<Wire>(edge);
+        }
+    }
+    values[gen() % count] = wire_lo;
+    values[gen() % count] = wire_hi;
+    return values;
+}
+
+// Every prefix length up to a few SIMD loads, then the limit values one at a time
+template<typename To, typename Wire>
+static bool check_pair(std::mt19937_64& gen) {
+    std::vector<Wire> values(40);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<Wire>(std::numeric_limits<To>::max() / 5 + static_cast<To>(i));
+    }
+    for (size_t n = 0; n <= values.size(); ++n) {
+        if (!check_wire<To>(std::vector<Wire>(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n)))) {
+            return false;
+        }
+    }
+    for (int round = 0; round < 40; ++round) {
+        if (!check_wire<To>(limit_values<To, Wire>(gen, 600))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// ENDIAN TESTS
+// =============================================================================
+
+// Test single fields: byte order, unaligned addresses, floating-point wire types, exceptions
+UTEST_FUNC_DEF(EndianScalar) {
+    const unsigned char bytes[] = { 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80 };
+    UTEST_ASSERT_EQUALS(0x0102030405060708ull, load_be<std::uint64_t>(bytes + 1));
+    UTEST_ASSERT_EQUALS(0x02030405u, load_be<std::uint32_t>(bytes + 2));
+    UTEST_ASSERT_EQUALS(0x0880, load_be<std::uint16_t>(bytes + 8));
+    UTEST_ASSERT_EQUALS(-1, load_be<std::int8_t>(bytes));
+    UTEST_ASSERT_EQUALS(-255, load_be<std::int16_t>(bytes));   // 0xff01
+
+    unsigned char wire[9];
+    store_be(std::int64_t(-5), wire + 1);
+    UTEST_ASSERT_EQUALS(-5, (load_be_cast<std::int32_t, std::int64_t>(wire + 1)));
+    UTEST_ASSERT_EQUALS(-5, (load_be_cast<std::int8_t, std::int64_t>(wire + 1)));
+    store_be(std::uint64_t(65535), wire);
+    UTEST_ASSERT_EQUALS(65535, (load_be_cast<std::uint16_t, std::uint64_t>(wire)));
+
+    store_be(1.5e10, wire);
+    UTEST_ASSERT_TRUE(load_be<double>(wire) == 1.5e10);
+    UTEST_ASSERT_EQUALS(15000000000LL, (load_be_cast<std::int64_t, double>(wire)));
+    store_be(-0.25f, wire + 3);
+    UTEST_ASSERT_TRUE((load_be_cast<double, float>(wire + 3) == -0.25));
+
+    cast_error errors[3] = { cast_error::none, cast_error::none, cast_error::none };
+    store_be(std::int64_t(-1), wire);
+    try { load_be_cast<std::uint32_t, std::int64_t>(wire); } catch (const cast_exception& e) { errors[0] = e.getError(); }
+    store_be(std::uint32_t(70000), wire);
+    try { load_be_cast<std::int16_t, std::uint32_t>(wire); } catch (const cast_exception& e) { errors[1] = e.getError(); }
+    store_be(std::nan(""), wire);
+    try { load_be_cast<std::int32_t, double>(wire); } catch (const cast_exception& e) { errors[2] = e.getError(); }
+    UTEST_ASSERT_TRUE(errors[0] == cast_error::negative_to_unsigned);
+    UTEST_ASSERT_TRUE(errors[1] == cast_error::positive_overflow);
+    UTEST_ASSERT_TRUE(errors[2] == cast_error::nan);
+}
+
+// Test every integral narrowing pair (fused kernel) and widening / float pairs (block path) against numeric_cast
+UTEST_FUNC_DEF(EndianBulk) {
+    std::mt19937_64 gen(17);
+    UTEST_ASSERT_TRUE((check_pair<std::int32_t, std::int64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint32_t, std::int64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int32_t, std::uint64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint32_t, std::uint64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int16_t, std::int64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint16_t, std::uint64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int8_t, std::int64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint8_t, std::int64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int16_t, std::int32_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint16_t, std::int32_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int16_t, std::uint32_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int8_t, std::uint32_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int8_t, std::int16_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint8_t, std::int16_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int8_t, std::uint16_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint8_t, std::uint16_t>(gen)));
+
+    // Same width, widening and floating-point wire types
+    UTEST_ASSERT_TRUE((check_pair<std::int64_t, std::uint64_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::uint32_t, std::int32_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int8_t, std::uint8_t>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int32_t, double>(gen)));
+    UTEST_ASSERT_TRUE((check_pair<std::int16_t, float>(gen)));
+
+    std::vector<std::int16_t> small(1000);
+    for (size_t i = 0; i < small.size(); ++i) {
+        small[i] = static_cast<std::int16_t>(static_cast<int>(i) * 61 - 30000);
+    }
+    UTEST_ASSERT_TRUE((check_wire<std::int64_t>(small)));
+    UTEST_ASSERT_TRUE((check_wire<std::uint32_t>(small)));
+    std::vector<double> prices(1000, 12.5);
+    prices[3] = -2.5;
+    prices[650] = 1e39;
+    UTEST_ASSERT_TRUE((check_wire<float>(prices)));
+    prices[500] = std::nan("");
+    UTEST_ASSERT_TRUE((check_wire<std::int64_t>(prices)));
+}
+
+// Test failure positions across SIMD loads and blocks, and the throwing variant
+UTEST_FUNC_DEF(EndianFailures) {
+    const size_t size = 1000;
+    const size_t positions[] = { 0, 1, 2, 3, 255, 256, 257, 511, 998, 999 };
+    for (size_t position : positions) {
+        std::vector<std::int64_t> values(size, -7);
+        values[position] = std::int64_t(1) << 31;
+        values.back() = std::int64_t(1) << 40;     // a later failure is never reached
+        UTEST_ASSERT_TRUE((check_wire<std::int32_t>(values)));
+
+        std::vector<std::uint32_t> ids(size, 65535u);
+        ids[position] = 65536u;
+        UTEST_ASSERT_TRUE((check_wire<std::uint16_t>(ids)));
+    }
+
+    std::vector<std::int64_t> values(size, 100);
+    values[300] = -129;
+    std::vector<unsigned char> bytes = to_wire(values, 1);
+    std::vector<std::int8_t> out(size);
+    bulk_result r = try_load_be_cast_n<std::int8_t, std::int64_t>(&bytes[1], size, out.data());
+    UTEST_ASSERT_EQUALS(300u, r.index);
+    UTEST_ASSERT_TRUE(r.error == cast_error::negative_overflow);
+
+    bool thrown = false;
+    try {
+        load_be_cast_n<std::int8_t, std::int64_t>(&bytes[1], size, out.data());
+    } catch (const cast_exception& e) {
+        thrown = e.getError() == cast_error::negative_overflow;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    values[300] = 127;
+    bytes = to_wire(values, 1);
+    load_be_cast_n<std::int8_t, std::int64_t>(&bytes[1], size, out.data());
+    UTEST_ASSERT_EQUALS(127, out[300]);
+    UTEST_ASSERT_TRUE((try_load_be_cast_n<std::int8_t, std::int64_t>(&bytes[1], 0, out.data()).ok()));
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    UTEST_FUNC(EndianScalar);
+    UTEST_FUNC(EndianBulk);
+    UTEST_FUNC(EndianFailures);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include "../include/ncast/ncast_file.h"
+#include "../include/utest/utest.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+static const char* INPUT = "test_ncast_file_input.bin";
+static const char* OUTPUT = "test_ncast_file_output.bin";
+
+// Small windows so that a few hundred KB span many of them
+static const size_t WINDOW = 64 * 1024;
+
+template<typename T>
+static void write_column(const char* path, const std::vector<T>& values) {
+    std::FILE* file = std::fopen(path, "wb");
+    if (!values.empty()) {
+        std::fwrite(values.data(), sizeof(T), values.size(), file);
+    }
+    std::fclose(file);
+}
+
+template<typename T>
+static std::vector<T> read_column(const char* path) {
+    std::vector<T> values;
+    std::FILE* file = std::fopen(path, "rb");
+    T value;
+    while (std::fread(&value, sizeof(T), 1, file) == 1) {
+        values.push_back(value);
+    }
+    std::fclose(file);
+    return values;
+}
+
+static std::vector<std::int64_t> ramp(size_t count) {
+    std::vector<std::int64_t> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<std::int64_t>(i % 100000) - 50000;
+    }
+    return values;
+}
+
+// =============================================================================
+// FILE TESTS
+// =============================================================================
+
+// Test first-failure mode: output contents, failing index across windows, throwing variant
+UTEST_FUNC_DEF(FileFirstFailure) {
+    std::vector<std::int64_t> values = ramp(100000);   // 800 KB: 13 windows
+    write_column(INPUT, values);
+    file_cast_result r = try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT, OUTPUT, WINDOW);
+    UTEST_ASSERT_TRUE(r.ok());
+    UTEST_ASSERT_EQUALS(100000u, r.count);
+    UTEST_ASSERT_EQUALS(100000u, r.first_index);
+    std::vector<std::int32_t> out = read_column<std::int32_t>(OUTPUT);
+    UTEST_ASSERT_EQUALS(values.size(), out.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        UTEST_ASSERT_EQUALS(values[i], out[i]);
+    }
+
+    // Failures in the first window, at a window boundary and in the last element
+    const size_t positions[] = { 3, WINDOW / 8, WINDOW / 8 - 1, 5 * WINDOW / 8 + 17, values.size() - 1 };
+    for (size_t position : positions) {
+        std::vector<std::int64_t> bad = values;
+        bad[position] = std::numeric_limits<std::int64_t>::min();
+        if (position + 1 < bad.size()) {
+            bad.back() = 1LL << 40;     // a later failure is never reached
+        }
+        write_column(INPUT, bad);
+        r = try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT, OUTPUT, WINDOW);
+        UTEST_ASSERT_EQUALS(1u, r.failures);
+        UTEST_ASSERT_EQUALS(position, r.first_index);
+        UTEST_ASSERT_TRUE(r.first_error == cast_error::negative_overflow);
+        out = read_column<std::int32_t>(OUTPUT);
+        UTEST_ASSERT_EQUALS(position, out.size());
+        UTEST_ASSERT_TRUE(out.empty() || out.back() == bad[position - 1]);
+    }
+
+    // Float source and unsigned target
+    std::vector<double> readings(20000, 2.5);
+    readings[12345] = std::nan("");
+    write_column(INPUT, readings);
+    r = try_numeric_cast_file<std::uint16_t, double>(INPUT, OUTPUT, WINDOW);
+    UTEST_ASSERT_TRUE(r.first_index == 12345u && r.first_error == cast_error::nan);
+
+    bool thrown = false;
+    try {
+        numeric_cast_file<std::uint16_t, double>(INPUT, OUTPUT, WINDOW);
+    } catch (const cast_exception& e) {
+        thrown = e.getError() == cast_error::nan;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    std::remove(INPUT);
+    std::remove(OUTPUT);
+}
+
+// Test every-failure mode: replacements, every index reported in order, float narrowing
+UTEST_FUNC_DEF(FileEveryFailure) {
+    std::vector<double> values(50000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<double>(i) * 0.25;
+    }
+    std::vector<std::pair<std::uint64_t, cast_error> > expected;
+    const size_t positions[] = { 0, 7, 8, 8191, 8192, 30000, 49999 };
+    for (size_t position : positions) {
+        const bool negative = position % 2 == 1;
+        values[position] = negative ? -1e300 : 1e300;
+        expected.push_back(std::make_pair(static_cast<std::uint64_t>(position),
+                                          negative ? cast_error::negative_overflow : cast_error::positive_overflow));
+    }
+    values[100] = std::numeric_limits<double>::infinity();   // infinity and NaN pass through to float
+    values[101] = std::nan("");
+    write_column(INPUT, values);
+
+    std::vector<std::pair<std::uint64_t, cast_error> > reported;
+    file_cast_result r = convert_file_with_failures<float, double>(INPUT, OUTPUT,
+        [&](std::uint64_t index, cast_error error) { reported.push_back(std::make_pair(index, error)); },
+        -1.0f, WINDOW);
+    UTEST_ASSERT_EQUALS(50000u, r.count);
+    UTEST_ASSERT_EQUALS(expected.size(), r.failures);
+    UTEST_ASSERT_EQUALS(0u, r.first_index);
+    UTEST_ASSERT_TRUE(r.first_error == cast_error::positive_overflow);
+    UTEST_ASSERT_TRUE(reported == expected);
+
+    std::vector<float> out = read_column<float>(OUTPUT);
+    UTEST_ASSERT_EQUALS(values.size(), out.size());
+    UTEST_ASSERT_TRUE(out[8] == -1.0f && out[9] == static_cast<float>(values[9]));
+    UTEST_ASSERT_TRUE(std::isinf(out[100]) && std::isnan(out[101]));
+    UTEST_ASSERT_TRUE(out[49998] == static_cast<float>(values[49998]));
+
+    // Integral narrowing with a sentinel
+    std::vector<std::int64_t> ids = ramp(40000);
+    ids[9000] = 70000;
+    ids[9001] = -70000;
+    write_column(INPUT, ids);
+    reported.clear();
+    r = convert_file_with_failures<std::int16_t, std::int64_t>(INPUT, OUTPUT,
+        [&](std::uint64_t index, cast_error error) { reported.push_back(std::make_pair(index, error)); },
+        std::numeric_limits<std::int16_t>::min(), WINDOW);
+    // The ramp starts at -50000: its values below -32768 fail too
+    size_t ramp_failures = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ramp_failures += ids[i] < -32768 || ids[i] > 32767;
+    }
+    UTEST_ASSERT_EQUALS(ramp_failures, r.failures);
+    UTEST_ASSERT_EQUALS(ramp_failures, reported.size());
+    UTEST_ASSERT_TRUE(reported[0].first == 0u && reported[0].second == cast_error::negative_overflow);
+    std::vector<std::int16_t> narrowed = read_column<std::int16_t>(OUTPUT);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int16_t>::min(), narrowed[9000]);
+    UTEST_ASSERT_EQUALS(ids[20000], narrowed[20000]);
+    std::remove(INPUT);
+    std::remove(OUTPUT);
+}
+
+// Test empty files, truncated elements and I/O errors
+UTEST_FUNC_DEF(FileErrors) {
+    write_column(INPUT, std::vector<std::int64_t>());
+    file_cast_result r = try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT, OUTPUT);
+    UTEST_ASSERT_TRUE(r.ok() && r.count == 0);
+    UTEST_ASSERT_TRUE(read_column<std::int32_t>(OUTPUT).empty());
+
+    // 3 bytes are not a whole int64
+    write_column(INPUT, std::vector<char>(3, 'x'));
+    bool invalid = false;
+    try {
+        try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT, OUTPUT);
+    } catch (const cast_exception& e) {
+        invalid = e.getError() == cast_error::invalid_format;
+    }
+    UTEST_ASSERT_TRUE(invalid);
+
+    std::remove(INPUT);
+    bool missing = false;
+    try {
+        try_numeric_cast_file<std::int32_t, std::int64_t>(INPUT, OUTPUT);
+    } catch (const std::system_error& e) {
+        missing = e.code() == std::errc::no_such_file_or_directory;
+    }
+    UTEST_ASSERT_TRUE(missing);
+    std::remove(OUTPUT);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    UTEST_FUNC(FileFirstFailure);
+    UTEST_FUNC(FileEveryFailure);
+    UTEST_FUNC(FileErrors);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
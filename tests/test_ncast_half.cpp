@@ -0,0 +1,247 @@
+#include "../include/ncast/ncast_half.h"
+#include "../include/utest/utest.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HALF TYPE TESTS
+// =============================================================================
+
+// Test basic conversions and bit patterns
+UTEST_FUNC_DEF(HalfBasicConversions) {
+    UTEST_ASSERT_EQUALS(0x0000, half(0.0f).bits());
+    UTEST_ASSERT_EQUALS(0x8000, half(-0.0f).bits());
+    UTEST_ASSERT_EQUALS(0x3c00, half(1.0f).bits());
+    UTEST_ASSERT_EQUALS(0xc000, half(-2.0f).bits());
+    UTEST_ASSERT_EQUALS(0x3800, half(0.5).bits());
+    UTEST_ASSERT_EQUALS(0x7bff, half(65504.0f).bits());
+    UTEST_ASSERT_EQUALS(0x0001, half(std::ldexp(1.0f, -24)).bits());
+    UTEST_ASSERT_EQUALS(0x5640, half(100).bits());
+
+    UTEST_ASSERT_EQUALS(1.0f, static_cast<float>(half::from_bits(0x3c00)));
+    UTEST_ASSERT_EQUALS(65504.0, static_cast<double>(half::from_bits(0x7bff)));
+    UTEST_ASSERT_EQUALS(-2, static_cast<int>(half::from_bits(0xc000)));
+    UTEST_ASSERT_EQUALS(std::ldexp(1.0f, -24), static_cast<float>(half::from_bits(0x0001)));
+
+    UTEST_ASSERT_TRUE(std::isinf(static_cast<float>(half::from_bits(0x7c00))));
+    UTEST_ASSERT_TRUE(std::isnan(static_cast<float>(half::from_bits(0x7e00))));
+}
+
+// Test round-to-nearest-even and overflow to infinity of the raw conversion
+UTEST_FUNC_DEF(HalfRounding) {
+    // Ties round to the even mantissa
+    UTEST_ASSERT_EQUALS(0x3c00, half(1.0f + std::ldexp(1.0f, -11)).bits());
+    UTEST_ASSERT_EQUALS(0x3c02, half(1.0f + 3.0f * std::ldexp(1.0f, -11)).bits());
+    UTEST_ASSERT_EQUALS(0x3c01, half(1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -30)).bits());
+
+    // Subnormal boundary: exactly half of denorm_min rounds to zero, anything above rounds up
+    UTEST_ASSERT_EQUALS(0x0000, half(std::ldexp(1.0f, -25)).bits());
+    UTEST_ASSERT_EQUALS(0x0001, half(std::ldexp(1.5f, -25)).bits());
+    UTEST_ASSERT_EQUALS(0x0000, half(std::ldexp(1.0, -25)).bits());
+    UTEST_ASSERT_EQUALS(0x0001, half(std::ldexp(1.5, -25)).bits());
+
+    // Largest finite value and overflow
+    UTEST_ASSERT_EQUALS(0x7bff, half(65519.0f).bits());
+    UTEST_ASSERT_EQUALS(0x7c00, half(65520.0f).bits());
+    UTEST_ASSERT_EQUALS(0x7c00, half(65520.0).bits());
+    UTEST_ASSERT_EQUALS(0xfc00, half(-1.0e10).bits());
+    UTEST_ASSERT_EQUALS(0x7c00, half(100000).bits());
+
+    // double -> half rounds once (no double rounding through float)
+    double just_above_tie = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40);
+    UTEST_ASSERT_EQUALS(0x3c01, half(just_above_tie).bits());
+}
+
+// Test the lookup tables against the reference conversions for every half value
+UTEST_FUNC_DEF(HalfTablesExhaustive) {
+    const detail::half_tables& tables = detail::half_tables::instance();
+    for (std::uint32_t i = 0; i < 0x10000u; ++i) {
+        std::uint16_t bits = static_cast<std::uint16_t>(i);
+        float f = detail::half_bits_to_float_table(bits, tables);
+        bool is_nan = (bits & 0x7fffu) > 0x7c00u;
+        UTEST_ASSERT_EQUALS(is_nan, std::isnan(f));
+        if (is_nan) {
+            UTEST_ASSERT_TRUE((detail::float_to_half_bits_table(f, tables) & 0x7e00u) == 0x7e00u);
+            continue;
+        }
+        UTEST_ASSERT_EQUALS(bits, detail::float_to_half_bits_table(f, tables));
+        UTEST_ASSERT_EQUALS(bits, detail::double_to_half_bits(static_cast<double>(f)));
+        UTEST_ASSERT_EQUALS(f, detail::half_bits_to_float(bits));
+    }
+
+    // Midpoints between neighbouring finite values must agree across all paths
+    for (std::uint32_t i = 0; i < 0x7bffu; ++i) {
+        float lo = detail::half_bits_to_float_table(static_cast<std::uint16_t>(i), tables);
+        float hi = detail::half_bits_to_float_table(static_cast<std::uint16_t>(i + 1), tables);
+        float mid = lo + (hi - lo) * 0.5f;
+        std::uint16_t expected = static_cast<std::uint16_t>((i & 1u) ? i + 1 : i);
+        UTEST_ASSERT_EQUALS(expected, detail::float_to_half_bits_table(mid, tables));
+        UTEST_ASSERT_EQUALS(expected, detail::float_to_half_bits(mid));
+        UTEST_ASSERT_EQUALS(expected, detail::double_to_half_bits(static_cast<double>(mid)));
+    }
+}
+
+// =============================================================================
+// NUMERIC_CAST INTEGRATION TESTS
+// =============================================================================
+
+// Test numeric_cast into half
+UTEST_FUNC_DEF(NumericCastToHalf) {
+    UTEST_ASSERT_EQUALS(0x3e00, numeric_cast<half>(1.5f).bits());
+    UTEST_ASSERT_EQUALS(0x7bff, numeric_cast<half>(65504.0).bits());
+    UTEST_ASSERT_EQUALS(0xfbff, numeric_cast<half>(-65504).bits());
+    UTEST_ASSERT_EQUALS(0x5640, numeric_cast<half>(100u).bits());
+
+    // Precision loss is allowed, as for double -> float
+    UTEST_ASSERT_EQUALS(0x3c00, numeric_cast<half>(1.0001f).bits());
+    UTEST_ASSERT_EQUALS(0x0000, numeric_cast<half>(1.0e-10).bits());
+
+    // Values that would overflow to infinity are rejected
+    UTEST_ASSERT_THROWS([](){ numeric_cast<half>(70000.0f); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<half>(-65505.0); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<half>(65505); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<half>(std::numeric_limits<long long>::min()); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<half>(std::numeric_limits<double>::max()); });
+
+    // NaN and infinity pass through between floating-point types
+    UTEST_ASSERT_TRUE(std::isnan(static_cast<float>(numeric_cast<half>(std::numeric_limits<float>::quiet_NaN()))));
+    UTEST_ASSERT_EQUALS(0x7c00, numeric_cast<half>(std::numeric_limits<double>::infinity()).bits());
+    UTEST_ASSERT_EQUALS(0xfc00, numeric_cast<half>(-std::numeric_limits<float>::infinity()).bits());
+}
+
+// Test numeric_cast out of half
+UTEST_FUNC_DEF(NumericCastFromHalf) {
+    half h(1234.0f);
+    UTEST_ASSERT_EQUALS(1234.0f, numeric_cast<float>(h));
+    UTEST_ASSERT_EQUALS(1234.0, numeric_cast<double>(h));
+    UTEST_ASSERT_EQUALS(1234, numeric_cast<int>(h));
+    UTEST_ASSERT_EQUALS(1234u, numeric_cast<unsigned short>(h));
+    UTEST_ASSERT_EQUALS(-2, numeric_cast<int>(half(-2.75f)));
+    UTEST_ASSERT_EQUALS(0x3c00, numeric_cast<half>(half(1.0f)).bits());
+
+    // Range and special values are validated for integral targets
+    half big(40000.0f);
+    half exact_limit(32768.0f);
+    half negative(-1.0f);
+    half nan = std::numeric_limits<half>::quiet_NaN();
+    half inf = std::numeric_limits<half>::infinity();
+    UTEST_ASSERT_THROWS([big](){ numeric_cast<short>(big); });
+    UTEST_ASSERT_THROWS([exact_limit](){ numeric_cast<short>(exact_limit); });
+    UTEST_ASSERT_THROWS([negative](){ numeric_cast<unsigned int>(negative); });
+    UTEST_ASSERT_THROWS([big](){ numeric_cast<signed char>(big); });
+    UTEST_ASSERT_THROWS([nan](){ numeric_cast<int>(nan); });
+    UTEST_ASSERT_THROWS([inf](){ numeric_cast<long>(inf); });
+
+    UTEST_ASSERT_TRUE(std::isnan(numeric_cast<double>(nan)));
+    UTEST_ASSERT_TRUE(std::isinf(numeric_cast<float>(inf)));
+}
+
+// Test macro version and exception details
+UTEST_FUNC_DEF(HalfMacroAndLimits) {
+    UTEST_ASSERT_EQUALS(0x4500, NUMERIC_CAST(half, 5).bits());
+    try {
+        half result = NUMERIC_CAST(half, 1.0e6);
+        (void)result;
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        std::string what_msg = e.what();
+        UTEST_ASSERT_TRUE(what_msg.find("65504") != std::string::npos);
+        UTEST_ASSERT_TRUE(what_msg.find("test_ncast_half.cpp") != std::string::npos);
+    }
+
+    UTEST_ASSERT_EQUALS(65504.0f, static_cast<float>(std::numeric_limits<half>::max()));
+    UTEST_ASSERT_EQUALS(-65504.0f, static_cast<float>(std::numeric_limits<half>::lowest()));
+    UTEST_ASSERT_EQUALS(std::ldexp(1.0f, -14), static_cast<float>(std::numeric_limits<half>::min()));
+    UTEST_ASSERT_EQUALS(std::ldexp(1.0f, -10), static_cast<float>(std::numeric_limits<half>::epsilon()));
+    UTEST_ASSERT_EQUALS(std::ldexp(1.0f, -24), static_cast<float>(std::numeric_limits<half>::denorm_min()));
+}
+
+// =============================================================================
+// BULK CONVERSION TESTS
+// =============================================================================
+
+// Test bulk float <-> half conversion against the scalar path, including tails
+UTEST_FUNC_DEF(HalfBulkConversions) {
+    std::vector<float> src;
+    for (int i = -500; i < 500; ++i) {
+        src.push_back(static_cast<float>(i) * 131.37f);
+        src.push_back(std::ldexp(static_cast<float>(i), -30));
+    }
+    src.push_back(std::numeric_limits<float>::infinity());
+    src.push_back(-std::numeric_limits<float>::infinity());
+    src.push_back(std::numeric_limits<float>::quiet_NaN());
+    src.push_back(1.0e30f);
+    src.push_back(65520.0f);
+
+    std::vector<half> halves(src.size());
+    float_to_half_n(src.data(), src.size(), halves.data());
+    for (size_t i = 0; i < src.size(); ++i) {
+        UTEST_ASSERT_EQUALS(half(src[i]).bits(), halves[i].bits());
+    }
+
+    std::vector<float> back(src.size());
+    half_to_float_n(halves.data(), halves.size(), back.data());
+    for (size_t i = 0; i < src.size(); ++i) {
+        float expected = static_cast<float>(halves[i]);
+        if (std::isnan(expected)) {
+            UTEST_ASSERT_TRUE(std::isnan(back[i]));
+        } else {
+            UTEST_ASSERT_EQUALS(expected, back[i]);
+        }
+    }
+
+    // Short arrays use the scalar path only
+    float small[3] = { 1.0f, 2.0f, 70000.0f };
+    half small_out[3];
+    float_to_half_n(small, 3, small_out);
+    UTEST_ASSERT_EQUALS(0x3c00, small_out[0].bits());
+    UTEST_ASSERT_EQUALS(0x4000, small_out[1].bits());
+    UTEST_ASSERT_EQUALS(0x7c00, small_out[2].bits());
+}
+
+#if NCAST_HAS_FLOAT16
+// Test numeric_cast with the compiler-provided _Float16 type
+UTEST_FUNC_DEF(Float16Support) {
+    _Float16 f16 = numeric_cast<_Float16>(2.5f);
+    UTEST_ASSERT_EQUALS(2.5f, static_cast<float>(f16));
+    UTEST_ASSERT_EQUALS(2, numeric_cast<int>(f16));
+    UTEST_ASSERT_EQUALS(2.5, numeric_cast<double>(f16));
+    UTEST_ASSERT_EQUALS(0x4100, numeric_cast<half>(f16).bits());
+    UTEST_ASSERT_EQUALS(2.5f, static_cast<float>(numeric_cast<_Float16>(half(2.5f))));
+    UTEST_ASSERT_EQUALS(300.0f, static_cast<float>(numeric_cast<_Float16>(300)));
+
+    UTEST_ASSERT_THROWS([](){ numeric_cast<_Float16>(1.0e6f); });
+    UTEST_ASSERT_THROWS([](){ numeric_cast<_Float16>(100000); });
+    _Float16 negative = static_cast<_Float16>(-3.0f);
+    UTEST_ASSERT_THROWS([negative](){ numeric_cast<unsigned char>(negative); });
+}
+#endif
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Half type tests
+    UTEST_FUNC(HalfBasicConversions);
+    UTEST_FUNC(HalfRounding);
+    UTEST_FUNC(HalfTablesExhaustive);
+
+    // numeric_cast integration tests
+    UTEST_FUNC(NumericCastToHalf);
+    UTEST_FUNC(NumericCastFromHalf);
+    UTEST_FUNC(HalfMacroAndLimits);
+
+    // Bulk conversion tests
+    UTEST_FUNC(HalfBulkConversions);
+#if NCAST_HAS_FLOAT16
+    UTEST_FUNC(Float16Support);
+#endif
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include "../include/ncast/ncast_iterator.h"
+#include "../include/ncast/ncast_saturate.h"
+#include "../include/utest/utest.h"
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// ITERATOR TESTS
+// =============================================================================
+
+// Test feeding converted values into std::accumulate, and throwing on dereference
+UTEST_FUNC_DEF(IteratorAccumulate) {
+    std::vector<std::int64_t> values;
+    for (std::int64_t i = -500; i < 1500; ++i) {
+        values.push_back(i * 1000);
+    }
+    long long total = std::accumulate(make_checked_cast_iterator<std::int32_t>(values.begin()),
+                                      make_checked_cast_iterator<std::int32_t>(values.end()), 0LL);
+    UTEST_ASSERT_EQUALS(std::accumulate(values.begin(), values.end(), 0LL), total);
+
+    // The failing element throws when it is read, not when the iterator is formed
+    values[700] = std::int64_t(1) << 40;
+    checked_cast_iterator<std::int32_t, std::vector<std::int64_t>::iterator> it(values.begin());
+    UTEST_ASSERT_EQUALS(-300000, it[200]);
+    bool thrown = false;
+    try {
+        std::accumulate(it, it + static_cast<std::ptrdiff_t>(values.size()), 0LL);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+    UTEST_ASSERT_TRUE(it.base() == values.begin());
+}
+
+// Test the iterator categories (prvalue reference: input) and the random-access operations
+UTEST_FUNC_DEF(IteratorCategories) {
+    typedef checked_cast_iterator<short, std::vector<long>::iterator> VectorIt;
+    typedef checked_cast_iterator<short, const double*> PointerIt;
+    typedef checked_cast_iterator<short, std::list<int>::iterator> ListIt;
+    typedef checked_cast_iterator<short, std::forward_list<int>::iterator> ForwardIt;
+    typedef checked_cast_iterator<short, std::istream_iterator<int> > InputIt;
+    UTEST_ASSERT_TRUE((std::is_same<std::input_iterator_tag, std::iterator_traits<VectorIt>::iterator_category>::value));
+    UTEST_ASSERT_TRUE((std::is_same<std::input_iterator_tag, std::iterator_traits<PointerIt>::iterator_category>::value));
+    UTEST_ASSERT_TRUE((std::is_same<std::input_iterator_tag, std::iterator_traits<ListIt>::iterator_category>::value));
+    UTEST_ASSERT_TRUE((std::is_same<std::input_iterator_tag, std::iterator_traits<ForwardIt>::iterator_category>::value));
+    UTEST_ASSERT_TRUE((std::is_same<std::input_iterator_tag, std::iterator_traits<InputIt>::iterator_category>::value));
+    UTEST_ASSERT_TRUE((std::is_same<short, std::iterator_traits<VectorIt>::reference>::value));
+#if NCAST_HAS_CPP20
+    static_assert(std::random_access_iterator<VectorIt> && std::random_access_iterator<PointerIt>);
+    static_assert(std::bidirectional_iterator<ListIt> && !std::random_access_iterator<ListIt>);
+    static_assert(std::forward_iterator<ForwardIt> && !std::bidirectional_iterator<ForwardIt>);
+    static_assert(std::input_iterator<InputIt> && !std::forward_iterator<InputIt>);
+#endif
+    UTEST_ASSERT_TRUE((std::is_same<short, std::iterator_traits<PointerIt>::value_type>::value));
+
+    const double sorted[] = { -3.0, -1.0, 0.0, 2.0, 7.0, 100.0, 30000.0 };
+    PointerIt first(sorted);
+    PointerIt last(sorted + 7);
+    UTEST_ASSERT_EQUALS(7, std::distance(first, last));
+    UTEST_ASSERT_EQUALS(2, *(first + 3));
+    UTEST_ASSERT_EQUALS(100, *(last - 2));
+    UTEST_ASSERT_EQUALS(-1, (2 + first)[-1]);
+    UTEST_ASSERT_TRUE(first < last && last > first && first <= first && last >= first && first != last);
+    PointerIt middle = first;
+    std::advance(middle, 4);
+    UTEST_ASSERT_EQUALS(7, *middle--);
+    UTEST_ASSERT_EQUALS(2, *middle);
+    UTEST_ASSERT_EQUALS(3, middle - first);
+
+    std::istringstream text("1 2 40000");
+    InputIt numbers((std::istream_iterator<int>(text)));
+    UTEST_ASSERT_EQUALS(1, *numbers);
+    ++numbers;
+    UTEST_ASSERT_EQUALS(2, *numbers++);
+    bool thrown = false;
+    try {
+        short value = *numbers;
+        (void)value;
+    } catch (const cast_exception&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test replacement policies on dereference
+UTEST_FUNC_DEF(IteratorReplacePolicy) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    const double values[] = { 12.5, -40.0, 300.0, nan, inf, -inf, 255.0 };
+    typedef replace_policy<>::on_nan<replace::with_value<int, 7> > Policy;
+
+    checked_cast_iterator<std::uint8_t, const double*, replace_policy<> > saturated(values);
+    checked_cast_iterator<std::uint8_t, const double*, Policy> sentinel(values);
+    for (std::ptrdiff_t i = 0; i < 7; ++i) {
+        UTEST_ASSERT_EQUALS(saturate_cast<std::uint8_t>(values[i]), saturated[i]);
+        UTEST_ASSERT_EQUALS((replace_cast<Policy, std::uint8_t>(values[i])), sentinel[i]);
+    }
+    UTEST_ASSERT_EQUALS(7, sentinel[3]);
+    UTEST_ASSERT_EQUALS(0, sentinel[1]);
+    UTEST_ASSERT_EQUALS(255, sentinel[2]);
+
+    // Only kinds the pair can produce are evaluated: int8 -> int32 never overflows
+    const std::int8_t small[] = { -128, 127 };
+    checked_cast_iterator<std::int32_t, const std::int8_t*,
+                          replace_policy<>::on_overflow<replace::with_value<long long, (1LL << 40)> > > widened(small);
+    UTEST_ASSERT_EQUALS(-128, widened[0]);
+    UTEST_ASSERT_EQUALS(127, widened[1]);
+
+    std::list<int> signed_values;
+    signed_values.push_back(-1);
+    signed_values.push_back(70000);
+    std::list<unsigned short> narrowed(make_checked_cast_iterator<unsigned short, replace_policy<> >(signed_values.begin()),
+                                       make_checked_cast_iterator<unsigned short, replace_policy<> >(signed_values.end()));
+    UTEST_ASSERT_EQUALS(0, narrowed.front());
+    UTEST_ASSERT_EQUALS(65535, narrowed.back());
+    UTEST_ASSERT_EQUALS(-1.0f, (replace_cast<replace_policy<>, float>(-1)));
+}
+
+// Test algorithms that use converted values as keys
+UTEST_FUNC_DEF(IteratorAlgorithms) {
+    std::vector<double> prices;
+    for (int i = 0; i < 1000; ++i) {
+        prices.push_back(static_cast<double>((i * 7919) % 1000));
+    }
+    typedef checked_cast_iterator<int, std::vector<double>::const_iterator> PriceIt;
+    PriceIt first(prices.cbegin());
+    PriceIt last(prices.cend());
+    UTEST_ASSERT_EQUALS(999, *std::max_element(first, last));
+    UTEST_ASSERT_EQUALS(0, *std::min_element(first, last));
+    UTEST_ASSERT_EQUALS(1, std::count(first, last, 500));
+
+    // Sort an index by the converted key without materializing the keys
+    std::vector<int> order(prices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return first[a] < first[b]; });
+    UTEST_ASSERT_EQUALS(0, first[order.front()]);
+    UTEST_ASSERT_EQUALS(999, first[order.back()]);
+
+    std::vector<int> copy(first, last);
+    UTEST_ASSERT_EQUALS(prices.size(), copy.size());
+    UTEST_ASSERT_TRUE(std::equal(copy.begin(), copy.end(), first));
+}
+
+#if NCAST_HAS_CPP20
+// Test the views::cast range adaptor
+UTEST_FUNC_DEF(CastViewRanges) {
+    std::vector<std::int64_t> values = { 1, 2, 3, 300, -5 };
+    auto view = values | views::cast<std::int16_t>;
+    static_assert(std::ranges::random_access_range<decltype(view)>);
+    static_assert(std::ranges::sized_range<decltype(view)>);
+    static_assert(std::ranges::common_range<decltype(view)>);
+    static_assert(std::ranges::borrowed_range<decltype(view)>);
+    UTEST_ASSERT_EQUALS(5u, view.size());
+    UTEST_ASSERT_EQUALS(300, view[3]);
+    UTEST_ASSERT_EQUALS(3, std::ranges::lower_bound(view.begin(), view.begin() + 4, std::int16_t(50)) - view.begin());
+    UTEST_ASSERT_EQUALS(301, std::accumulate(view.begin(), view.end(), 0));
+
+    auto bytes = views::cast<std::uint8_t, replace_policy<> >(values);
+    UTEST_ASSERT_EQUALS(255, bytes[3]);
+    UTEST_ASSERT_EQUALS(0, bytes[4]);
+
+    bool thrown = false;
+    try {
+        std::ranges::for_each(values | views::cast<std::int8_t>, [](std::int8_t) {});
+    } catch (const cast_exception&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+
+    // Non-common and forward-only ranges
+    auto counted = std::views::iota(0) | std::views::take_while([](int i) { return i < 5; }) | views::cast<double>;
+    static_assert(!std::ranges::common_range<decltype(counted)>);
+    double sum = 0.0;
+    for (double d : counted) {
+        sum += d;
+    }
+    UTEST_ASSERT_EQUALS(10.0, sum);
+    std::forward_list<int> list = { 1, -3 };
+    auto unsigned_view = list | views::cast<unsigned, replace_policy<> >;
+    static_assert(std::ranges::forward_range<decltype(unsigned_view)> &&
+                  !std::ranges::bidirectional_range<decltype(unsigned_view)>);
+    UTEST_ASSERT_EQUALS(0u, *std::next(unsigned_view.begin()));
+    UTEST_ASSERT_EQUALS(4u, (std::views::iota(0, 4) | views::cast<short>).size());
+}
+#endif
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Iterator tests
+    UTEST_FUNC(IteratorAccumulate);
+    UTEST_FUNC(IteratorCategories);
+    UTEST_FUNC(IteratorReplacePolicy);
+    UTEST_FUNC(IteratorAlgorithms);
+
+#if NCAST_HAS_CPP20
+    // C++20 range adaptor tests
+    UTEST_FUNC(CastViewRanges);
+#endif
+
+    UTEST_EPILOG();
+
+    return 0;
+}
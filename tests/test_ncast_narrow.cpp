@@ -0,0 +1,367 @@
+#include "../include/ncast/ncast_narrow.h"
+#include "../include/utest/utest.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Checks that a narrowed buffer holds exactly the source values
+struct equals_source {
+    const std::vector<std::int64_t>* source;
+    bool* equal;
+
+    template<typename T>
+    void operator()(const T* data, std::size_t count) const {
+        *equal = count == source->size();
+        for (std::size_t i = 0; *equal && i < count; ++i) {
+            *equal = static_cast<std::int64_t>(data[i]) == (*source)[i];
+        }
+    }
+};
+
+static integral_type narrowest_of(std::int64_t a, std::int64_t b) {
+    std::vector<std::int64_t> data(33, a);
+    data[17] = b;
+    return narrowest_integral_type(data.data(), data.size());
+}
+
+// =============================================================================
+// NARROWEST_INTEGRAL_TYPE TESTS
+// =============================================================================
+
+// Test type selection at every boundary
+UTEST_FUNC_DEF(NarrowestTypeBoundaries) {
+    UTEST_ASSERT_TRUE(narrowest_of(0, 0) == integral_type::uint8);
+    UTEST_ASSERT_TRUE(narrowest_of(0, 255) == integral_type::uint8);
+    UTEST_ASSERT_TRUE(narrowest_of(0, 256) == integral_type::uint16);
+    UTEST_ASSERT_TRUE(narrowest_of(0, 65535) == integral_type::uint16);
+    UTEST_ASSERT_TRUE(narrowest_of(0, 65536) == integral_type::uint32);
+    UTEST_ASSERT_TRUE(narrowest_of(1, 4294967295LL) == integral_type::uint32);
+    UTEST_ASSERT_TRUE(narrowest_of(1, 4294967296LL) == integral_type::uint64);
+
+    UTEST_ASSERT_TRUE(narrowest_of(-1, 127) == integral_type::int8);
+    UTEST_ASSERT_TRUE(narrowest_of(-128, 0) == integral_type::int8);
+    UTEST_ASSERT_TRUE(narrowest_of(-1, 128) == integral_type::int16);
+    UTEST_ASSERT_TRUE(narrowest_of(-129, 0) == integral_type::int16);
+    UTEST_ASSERT_TRUE(narrowest_of(-32768, 32767) == integral_type::int16);
+    UTEST_ASSERT_TRUE(narrowest_of(-32769, 0) == integral_type::int32);
+    UTEST_ASSERT_TRUE(narrowest_of(-1, 2147483647LL) == integral_type::int32);
+    UTEST_ASSERT_TRUE(narrowest_of(-2147483648LL, 0) == integral_type::int32);
+    UTEST_ASSERT_TRUE(narrowest_of(-1, 2147483648LL) == integral_type::int64);
+    UTEST_ASSERT_TRUE(narrowest_of(std::numeric_limits<std::int64_t>::min(), 0) == integral_type::int64);
+
+    // Unsigned sources above the int64 range
+    std::vector<std::uint64_t> big(5, 1u);
+    big[3] = std::numeric_limits<std::uint64_t>::max();
+    UTEST_ASSERT_TRUE(narrowest_integral_type(big.data(), big.size()) == integral_type::uint64);
+
+    // Empty input
+    UTEST_ASSERT_TRUE(narrowest_integral_type(static_cast<const std::int64_t*>(nullptr), 0) == integral_type::uint8);
+
+    UTEST_ASSERT_EQUALS(2u, integral_type_size(integral_type::int16));
+    UTEST_ASSERT_EQUALS(std::string("uint32"), std::string(integral_type_name(integral_type::uint32)));
+}
+
+// =============================================================================
+// NARROW_TO_FIT TESTS
+// =============================================================================
+
+// Test that narrowed buffers hold the original values in the selected type
+UTEST_FUNC_DEF(NarrowToFit) {
+    std::vector<std::int64_t> small;
+    for (int i = 0; i < 1000; ++i) {
+        small.push_back(i % 200);
+    }
+    narrowed_buffer bytes = narrow_to_fit(small.data(), small.size());
+    UTEST_ASSERT_TRUE(bytes.type() == integral_type::uint8);
+    UTEST_ASSERT_EQUALS(small.size(), bytes.size());
+    UTEST_ASSERT_EQUALS(small.size(), bytes.size_bytes());
+    UTEST_ASSERT_TRUE(bytes.data<std::uint8_t>() != nullptr);
+    UTEST_ASSERT_TRUE(bytes.data<std::int8_t>() == nullptr);
+    UTEST_ASSERT_EQUALS(199u, bytes.data<std::uint8_t>()[199]);
+
+    bool equal = false;
+    equals_source check = { &small, &equal };
+    bytes.visit(check);
+    UTEST_ASSERT_TRUE(equal);
+
+    // Skewed data: mostly small, rare large negative outlier
+    std::vector<std::int64_t> skewed(777, 3);
+    skewed[500] = -100000;
+    narrowed_buffer ints = narrow_to_fit(skewed.data(), skewed.size());
+    UTEST_ASSERT_TRUE(ints.type() == integral_type::int32);
+    UTEST_ASSERT_EQUALS(777u * 4u, ints.size_bytes());
+    equal = false;
+    check.source = &skewed;
+    ints.visit(check);
+    UTEST_ASSERT_TRUE(equal);
+    UTEST_ASSERT_EQUALS(-100000, ints.data<std::int32_t>()[500]);
+
+    // Mutable access
+    ints.data<std::int32_t>()[0] = 42;
+    UTEST_ASSERT_EQUALS(42, ints.data<std::int32_t>()[0]);
+
+    // Copies own their elements
+    narrowed_buffer copy = ints;
+    copy.data<std::int32_t>()[0] = 7;
+    UTEST_ASSERT_EQUALS(42, ints.data<std::int32_t>()[0]);
+    UTEST_ASSERT_EQUALS(-100000, copy.data<std::int32_t>()[500]);
+
+    narrowed_buffer none = narrow_to_fit(static_cast<const std::int64_t*>(nullptr), 0);
+    UTEST_ASSERT_TRUE(none.empty());
+
+    // A byte size overflowing std::size_t is rejected before allocating
+    bool thrown = false;
+    try {
+        narrowed_buffer huge(integral_type::int32, std::numeric_limits<std::size_t>::max() / 2);
+    } catch (const std::bad_array_new_length&) {
+        thrown = true;
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// =============================================================================
+// IN-PLACE NARROWING TESTS
+// =============================================================================
+
+// Test in-place narrowing of raw buffers: values, failure index and restored contents
+UTEST_FUNC_DEF(NarrowInPlaceBuffer) {
+    std::vector<std::uint64_t> data;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        data.push_back(i * 4000000u + 7u);
+    }
+    std::vector<std::uint64_t> original = data;
+
+    bulk_result ok = try_narrow_in_place<std::uint32_t>(data.data(), data.size());
+    UTEST_ASSERT_TRUE(ok.ok());
+    UTEST_ASSERT_EQUALS(data.size(), ok.index);
+    const std::uint32_t* narrowed = narrowed_data<std::uint32_t>(data.data());
+    for (size_t i = 0; i < original.size(); ++i) {
+        UTEST_ASSERT_EQUALS(original[i], narrowed[i]);
+    }
+
+    // A failure anywhere (first block, block boundaries, tail) restores the original contents
+    const size_t positions[] = { 0, 1, 255, 256, 257, 511, 600, 998, 999 };
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); ++p) {
+        data = original;
+        data[positions[p]] = 0x100000000ull;
+        std::vector<std::uint64_t> before = data;
+        bulk_result failed = try_narrow_in_place<std::uint32_t>(data.data(), data.size());
+        UTEST_ASSERT_EQUALS(positions[p], failed.index);
+        UTEST_ASSERT_TRUE(failed.error == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(data == before);
+    }
+
+    // Signed to unsigned of the same size, and error kinds
+    std::vector<std::int16_t> shorts(300, 5);
+    shorts[290] = -3;
+    std::vector<std::int16_t> shorts_before = shorts;
+    bulk_result negative = try_narrow_in_place<std::uint16_t>(shorts.data(), shorts.size());
+    UTEST_ASSERT_EQUALS(290u, negative.index);
+    UTEST_ASSERT_TRUE(negative.error == cast_error::negative_to_unsigned);
+    UTEST_ASSERT_TRUE(shorts == shorts_before);
+    bulk_result below = try_narrow_in_place<std::int8_t>(shorts.data(), shorts.size());
+    UTEST_ASSERT_TRUE(below.ok());
+
+    std::vector<std::int64_t> wide(10, -129);
+    bulk_result underflow = try_narrow_in_place<std::int8_t>(wide.data(), wide.size());
+    UTEST_ASSERT_EQUALS(0u, underflow.index);
+    UTEST_ASSERT_TRUE(underflow.error == cast_error::negative_overflow);
+
+    // Throwing variant
+    std::vector<std::int64_t> values(40, -7);
+    std::int8_t* bytes = narrow_in_place<std::int8_t>(values.data(), values.size());
+    UTEST_ASSERT_EQUALS(-7, bytes[39]);
+    values.assign(40, 1);
+    values[33] = 1000;
+    try {
+        narrow_in_place<std::int8_t>(values.data(), values.size());
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("index 33") != std::string::npos);
+    }
+    UTEST_ASSERT_EQUALS(1000, values[33]);
+    UTEST_ASSERT_EQUALS(1, values[0]);
+}
+
+// Test in-place narrowing of floating-point buffers
+UTEST_FUNC_DEF(NarrowInPlaceFloatingPoint) {
+    std::vector<double> doubles;
+    for (int i = 0; i < 700; ++i) {
+        doubles.push_back(static_cast<double>(i) * 0.1 - 30.0);
+    }
+    doubles[5] = std::numeric_limits<double>::infinity();
+    doubles[6] = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> original = doubles;
+    float* floats = narrow_in_place<float>(doubles.data(), doubles.size());
+    for (size_t i = 0; i < original.size(); ++i) {
+        if (i == 6) {
+            UTEST_ASSERT_TRUE(std::isnan(floats[i]));
+        } else {
+            UTEST_ASSERT_EQUALS(static_cast<float>(original[i]), floats[i]);
+        }
+    }
+
+    // Rounding is irreversible, so the buffer must be untouched on failure
+    doubles = original;
+    doubles[650] = 1.0e300;
+    bulk_result overflow = try_narrow_in_place<float>(doubles.data(), doubles.size());
+    UTEST_ASSERT_EQUALS(650u, overflow.index);
+    UTEST_ASSERT_TRUE(overflow.error == cast_error::positive_overflow);
+    UTEST_ASSERT_EQUALS(original[300], doubles[300]);
+    UTEST_ASSERT_EQUALS(1.0e300, doubles[650]);
+
+    std::vector<double> to_int(100, 2.5);
+    to_int[70] = std::numeric_limits<double>::quiet_NaN();
+    bulk_result nan = try_narrow_in_place<std::int32_t>(to_int.data(), to_int.size());
+    UTEST_ASSERT_EQUALS(70u, nan.index);
+    UTEST_ASSERT_TRUE(nan.error == cast_error::nan);
+    to_int[70] = -std::numeric_limits<double>::infinity();
+    bulk_result inf = try_narrow_in_place<std::int32_t>(to_int.data(), to_int.size());
+    UTEST_ASSERT_TRUE(inf.error == cast_error::infinity);
+    to_int[70] = 1.0;
+    std::int32_t* ints = narrow_in_place<std::int32_t>(to_int.data(), to_int.size());
+    UTEST_ASSERT_EQUALS(2, ints[0]);
+    UTEST_ASSERT_EQUALS(1, ints[70]);
+}
+
+// Test narrowing a vector into a narrowed_vector that owns the original storage
+UTEST_FUNC_DEF(NarrowInPlaceVector) {
+    std::vector<std::uint64_t> ids;
+    for (std::uint64_t i = 0; i < 5000; ++i) {
+        ids.push_back(i * 3u);
+    }
+    const std::uint64_t* storage = ids.data();
+    narrowed_vector<std::uint32_t, std::uint64_t> ids32 = narrow_in_place<std::uint32_t>(std::move(ids));
+    UTEST_ASSERT_EQUALS(5000u, ids32.size());
+    UTEST_ASSERT_TRUE(static_cast<const void*>(ids32.data()) == static_cast<const void*>(storage));
+    UTEST_ASSERT_EQUALS(14997u, ids32[4999]);
+    std::uint64_t sum = 0;
+    for (std::uint32_t id : ids32) {
+        sum += id;
+    }
+    UTEST_ASSERT_EQUALS(3ull * 4999ull * 5000ull / 2ull, sum);
+
+    std::vector<std::uint64_t> released = ids32.release();
+    UTEST_ASSERT_TRUE(released.data() == storage);
+    UTEST_ASSERT_TRUE(ids32.empty());
+
+    // Failure: the vector is not moved from and keeps its contents
+    std::vector<std::int32_t> values(100, 1);
+    values[64] = 70000;
+    try {
+        narrow_in_place<std::int16_t>(std::move(values));
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+    }
+    UTEST_ASSERT_EQUALS(100u, values.size());
+    UTEST_ASSERT_EQUALS(70000, values[64]);
+    UTEST_ASSERT_EQUALS(1, values[63]);
+}
+
+// Test convert_vector: moves same types, sign-bit check for same-width sign changes
+UTEST_FUNC_DEF(ConvertVector) {
+    std::vector<std::int32_t> ids;
+    for (std::int32_t i = 0; i < 3000; ++i) {
+        ids.push_back(i * 7);
+    }
+    const std::int32_t* storage = ids.data();
+    std::vector<std::int32_t> same = convert_vector<std::int32_t>(std::move(ids));
+    UTEST_ASSERT_TRUE(same.data() == storage);
+
+    std::vector<std::uint32_t> keys = convert_vector<std::uint32_t>(std::move(same));
+    UTEST_ASSERT_EQUALS(3000u, keys.size());
+    UTEST_ASSERT_EQUALS(20993u, keys[2999]);
+
+    // Unsigned to signed fails on the top bit; the source keeps its contents
+    std::vector<std::uint64_t> big(1000, 5u);
+    big[700] = std::uint64_t(1) << 63;
+    big[900] = ~std::uint64_t(0);
+    try {
+        convert_vector<std::int64_t>(std::move(big));
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("index 700") != std::string::npos);
+    }
+    UTEST_ASSERT_EQUALS(1000u, big.size());
+
+    std::vector<std::int16_t> negative(10, 1);
+    negative[9] = -1;
+    try {
+        convert_vector<std::uint16_t>(std::move(negative));
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::negative_to_unsigned);
+    }
+
+    // Sign changes in place validate only; the bits are reused as they are
+    negative[9] = 32767;
+    const std::int16_t* shorts = negative.data();
+    narrowed_vector<std::uint16_t, std::int16_t> unsigned_shorts = narrow_in_place<std::uint16_t>(std::move(negative));
+    UTEST_ASSERT_TRUE(static_cast<const void*>(unsigned_shorts.data()) == static_cast<const void*>(shorts));
+    UTEST_ASSERT_EQUALS(32767, unsigned_shorts[9]);
+
+    // Other pairs: checked bulk conversion into a new vector
+    std::vector<double> reals(50, 2.0);
+    std::vector<std::uint8_t> bytes = convert_vector<std::uint8_t>(std::move(reals));
+    UTEST_ASSERT_EQUALS(50u, bytes.size());
+    UTEST_ASSERT_EQUALS(2, bytes[49]);
+    reals.assign(50, 300.0);
+    try {
+        convert_vector<std::uint8_t>(std::move(reals));
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("index 0") != std::string::npos);
+    }
+
+    // Several blocks: the global index of a failure past the first block
+    std::vector<std::int64_t> wide(1000);
+    for (size_t i = 0; i < wide.size(); ++i) {
+        wide[i] = static_cast<std::int64_t>(i) - 500;
+    }
+    std::vector<std::int16_t> narrow = convert_vector<std::int16_t>(std::vector<std::int64_t>(wide));
+    UTEST_ASSERT_EQUALS(1000u, narrow.size());
+    UTEST_ASSERT_EQUALS(-500, narrow[0]);
+    UTEST_ASSERT_EQUALS(499, narrow[999]);
+    wide[700] = 40000;
+    try {
+        convert_vector<std::int16_t>(std::move(wide));
+        UTEST_ASSERT_TRUE(false);
+    } catch (const cast_exception& e) {
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+        UTEST_ASSERT_TRUE(std::string(e.what()).find("index 700") != std::string::npos);
+    }
+    UTEST_ASSERT_EQUALS(1000u, wide.size());
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // narrowest_integral_type tests
+    UTEST_FUNC(NarrowestTypeBoundaries);
+
+    // narrow_to_fit tests
+    UTEST_FUNC(NarrowToFit);
+
+    // In-place narrowing tests
+    UTEST_FUNC(NarrowInPlaceBuffer);
+    UTEST_FUNC(NarrowInPlaceFloatingPoint);
+    UTEST_FUNC(NarrowInPlaceVector);
+    UTEST_FUNC(ConvertVector);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
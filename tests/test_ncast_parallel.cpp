@@ -0,0 +1,171 @@
+#include "../include/ncast/ncast_parallel.h"
+#include "../include/utest/utest.h"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Elements per chunk of an int64 source; failures are placed relative to it
+static const size_t CHUNK = detail::parallel_chunk_size<std::int64_t>();
+
+static std::vector<std::int64_t> ramp(size_t count) {
+    std::vector<std::int64_t> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<std::int64_t>(i % 100000) - 50000;
+    }
+    return values;
+}
+
+// =============================================================================
+// THREAD POOL TESTS
+// =============================================================================
+
+// Test that run() calls the task once per thread, repeatedly
+UTEST_FUNC_DEF(ThreadPoolRunsEveryThread) {
+    thread_pool pool(4);
+    UTEST_ASSERT_EQUALS(4u, pool.size());
+    for (int round = 0; round < 50; ++round) {
+        std::vector<int> calls(pool.size(), 0);
+        pool.run([&](unsigned thread) { ++calls[thread]; });
+        for (size_t t = 0; t < calls.size(); ++t) {
+            UTEST_ASSERT_EQUALS(1, calls[t]);
+        }
+    }
+
+    thread_pool single(1);
+    int calls = 0;
+    single.run([&](unsigned thread) { calls += static_cast<int>(thread) + 1; });
+    UTEST_ASSERT_EQUALS(1, calls);
+    UTEST_ASSERT_TRUE(thread_pool().size() >= 1u);
+}
+
+// Test that an exception on any thread is rethrown by run() and the pool stays usable
+UTEST_FUNC_DEF(ThreadPoolRethrows) {
+    thread_pool pool(4);
+    for (unsigned failing = 0; failing < pool.size(); ++failing) {
+        std::atomic<int> finished(0);
+        bool thrown = false;
+        try {
+            pool.run([&](unsigned thread) {
+                if (thread == failing) {
+                    throw std::runtime_error("task failed");
+                }
+                ++finished;
+            });
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        UTEST_ASSERT_TRUE(thrown);
+        UTEST_ASSERT_EQUALS(3, finished.load());   // the other threads completed before run() returned
+    }
+
+    int calls = 0;
+    std::mutex lock;
+    pool.run([&](unsigned) { std::lock_guard<std::mutex> guard(lock); ++calls; });
+    UTEST_ASSERT_EQUALS(4, calls);
+}
+
+// Test first-touch initialization of odd-sized buffers
+UTEST_FUNC_DEF(FirstTouchParallel) {
+    thread_pool pool(3);
+    const size_t sizes[] = { 0, 1, 1000, 5 * CHUNK + 17 };
+    for (size_t size : sizes) {
+        std::vector<std::int32_t> buffer(size + 1, 7);
+        first_touch_parallel<std::int64_t>(buffer.data(), size, pool);
+        for (size_t i = 0; i < size; ++i) {
+            UTEST_ASSERT_EQUALS(0, buffer[i]);
+        }
+        UTEST_ASSERT_EQUALS(7, buffer[size]);
+    }
+}
+
+// =============================================================================
+// PARALLEL CONVERSION TESTS
+// =============================================================================
+
+// Test that every pool size converts like the sequential conversion
+UTEST_FUNC_DEF(ParallelMatchesSequential) {
+    std::vector<std::int64_t> values = ramp(37 * CHUNK + 123);
+    for (unsigned threads = 1; threads <= 5; ++threads) {
+        thread_pool pool(threads);
+        std::vector<std::int32_t> out(values.size() + 1, 9);
+        bulk_result r = try_numeric_cast_parallel(values.data(), values.size(), out.data(), pool);
+        UTEST_ASSERT_TRUE(r.ok());
+        UTEST_ASSERT_EQUALS(values.size(), r.index);
+        for (size_t i = 0; i < values.size(); ++i) {
+            UTEST_ASSERT_EQUALS(static_cast<std::int32_t>(values[i]), out[i]);
+        }
+        UTEST_ASSERT_EQUALS(9, out[values.size()]);
+    }
+
+    // Small arrays run on the calling thread
+    thread_pool pool(4);
+    std::vector<double> small(100, 2.5);
+    std::vector<std::int8_t> narrow(small.size());
+    UTEST_ASSERT_TRUE(try_numeric_cast_parallel(small.data(), small.size(), narrow.data(), pool).ok());
+    UTEST_ASSERT_EQUALS(2, narrow[99]);
+}
+
+// Test that the lowest failing index is reported regardless of scheduling
+UTEST_FUNC_DEF(ParallelLowestFailingIndex) {
+    const size_t count = 40 * CHUNK + 5;
+    const size_t first_failures[] = { 0, 1, CHUNK - 1, CHUNK, 17 * CHUNK + 3, count - 1 };
+    thread_pool pool(4);
+
+    for (size_t first : first_failures) {
+        std::vector<std::int64_t> values = ramp(count);
+        values[first] = -(std::int64_t(1) << 40);
+        // Later failures in the same and in other chunks, some in earlier-scheduled ranges of other threads
+        for (size_t later = first + 1; later < count; later += 3 * CHUNK + 11) {
+            values[later] = std::int64_t(1) << 40;
+        }
+        for (int round = 0; round < 5; ++round) {
+            std::vector<std::int32_t> out(count, 9);
+            bulk_result r = try_numeric_cast_parallel(values.data(), values.size(), out.data(), pool);
+            UTEST_ASSERT_EQUALS(first, r.index);
+            UTEST_ASSERT_TRUE(r.error == cast_error::negative_overflow);
+            for (size_t i = 0; i < first; ++i) {
+                UTEST_ASSERT_EQUALS(static_cast<std::int32_t>(values[i]), out[i]);
+            }
+        }
+    }
+
+    std::vector<double> doubles(20 * CHUNK, 1.0);
+    doubles[9 * CHUNK] = std::numeric_limits<double>::quiet_NaN();
+    doubles[3 * CHUNK + 1] = -1.0;
+    std::vector<std::uint16_t> out(doubles.size());
+    bool thrown = false;
+    try {
+        numeric_cast_parallel(doubles.data(), doubles.size(), out.data(), pool);
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::negative_overflow);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Thread pool tests
+    UTEST_FUNC(ThreadPoolRunsEveryThread);
+    UTEST_FUNC(ThreadPoolRethrows);
+    UTEST_FUNC(FirstTouchParallel);
+
+    // Parallel conversion tests
+    UTEST_FUNC(ParallelMatchesSequential);
+    UTEST_FUNC(ParallelLowestFailingIndex);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
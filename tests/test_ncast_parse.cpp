@@ -0,0 +1,496 @@
+#include "../include/ncast/ncast_parse.h"
+#include "../include/utest/utest.h"
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+template<typename T, int Base = 10>
+static parse_result<T> parse(const std::string& text) {
+    return parse_cast<T, Base>(text.data(), text.data() + text.size());
+}
+
+// Parse text and compare value, error kind and the number of consumed characters
+template<typename T>
+static bool parses_as(const std::string& text, T value, cast_error error, size_t consumed) {
+    parse_result<T> r = parse<T>(text);
+    return r.value == value && r.error == error && r.ptr == text.data() + consumed;
+}
+
+// Every value of a small type's neighbourhood against numeric_cast of the wide value
+template<typename T>
+static bool matches_numeric_cast(long long from, long long to) {
+    for (long long v = from; v <= to; ++v) {
+        std::string text = std::to_string(v);
+        parse_result<T> r = parse<T>(text);
+        cast_error expected = cast_error::none;
+        T expected_value = T();
+        try {
+            expected_value = numeric_cast<T>(v);
+        } catch (const cast_exception& e) {
+            expected = e.getError();
+        }
+        if (r.error != expected || r.value != expected_value || r.ptr != text.data() + text.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Value of c as a digit of base (letters in either case), or base when it is not one
+static unsigned reference_digit(char c, unsigned base) {
+    const char* digits = "0123456789abcdef";
+    const char lower = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    const char* found = lower != '\0' ? std::strchr(digits, lower) : nullptr;
+    const unsigned digit = found ? static_cast<unsigned>(found - digits) : base;
+    return digit < base ? digit : base;
+}
+
+// Per-digit reference parser: accumulate with a bound check on every digit
+template<typename T, int Base = 10>
+static parse_result<T> reference_parse(const std::string& text) {
+    const bool negative = !text.empty() && text[0] == '-';
+    const unsigned long long limit = negative
+        ? (std::is_signed<T>::value ? static_cast<unsigned long long>(std::numeric_limits<T>::max()) + 1u : 0u)
+        : static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    const unsigned base = static_cast<unsigned>(Base);
+    size_t i = negative ? 1 : 0;
+    unsigned long long magnitude = 0;
+    bool overflow = false;
+    for (; i < text.size() && reference_digit(text[i], base) < base; ++i) {
+        unsigned digit = reference_digit(text[i], base);
+        overflow = overflow || digit > limit || magnitude > (limit - digit) / base;
+        magnitude = overflow ? 0u : magnitude * base + digit;
+    }
+    parse_result<T> r = { T(), text.data() + i, cast_error::none };
+    if (i == (negative ? 1u : 0u)) {
+        r.ptr = text.data();
+        r.error = cast_error::invalid_format;
+    } else if (overflow) {
+        r.error = negative ? (std::is_signed<T>::value ? cast_error::negative_overflow : cast_error::negative_to_unsigned)
+                           : cast_error::positive_overflow;
+    } else if (negative) {
+        r.value = static_cast<T>(-static_cast<long long>(magnitude - 1u) - 1);
+    } else {
+        r.value = static_cast<T>(magnitude);
+    }
+    return r;
+}
+
+// Random digit runs of every length, alone (scalar loop near the end of the
+// text) and followed by padding (8-digit words), against the reference
+template<typename T>
+static bool matches_reference(unsigned seed) {
+    std::mt19937 gen(seed);
+    for (size_t length = 1; length <= 24; ++length) {
+        for (int sample = 0; sample < 200; ++sample) {
+            std::string number = (sample & 1) ? "-" : "";
+            for (size_t i = 0; i < length; ++i) {
+                number += static_cast<char>('0' + gen() % 10u);
+            }
+            const std::string padded[] = { number, number + ",12345678", number + "x" + number };
+            for (const std::string& text : padded) {
+                parse_result<T> r = parse<T>(text);
+                parse_result<T> expected = reference_parse<T>(text);
+                if (r.value != expected.value || r.error != expected.error || r.ptr != expected.ptr) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Values of T written in Base with 0 to 40 leading zeros, and random digit strings up to
+// 80 digits (mixed case), each alone and followed by padding, against the reference
+template<typename T, int Base>
+static bool matches_radix_reference(unsigned seed) {
+    const char* digits = Base == 16 ? "0123456789abcdefABCDEF" : "0123456789";
+    const unsigned digit_count = Base == 16 ? 22u : static_cast<unsigned>(Base);
+    std::mt19937_64 gen(seed);
+    for (int sample = 0; sample < 4000; ++sample) {
+        std::string number;
+        if (sample & 1) {
+            // Digits of a value of T, most significant first
+            unsigned long long magnitude = static_cast<unsigned long long>(static_cast<T>(gen()));
+            if (std::is_signed<T>::value && static_cast<T>(magnitude) < 0) {
+                magnitude = 0u - static_cast<unsigned long long>(static_cast<long long>(static_cast<T>(magnitude)));
+                number = "-";
+            }
+            std::string reversed;
+            do {
+                reversed += "0123456789abcdef"[magnitude % static_cast<unsigned>(Base)];
+                magnitude /= static_cast<unsigned>(Base);
+            } while (magnitude != 0);
+            number.append(gen() % 41u, '0');
+            number.append(reversed.rbegin(), reversed.rend());
+        } else {
+            number = (sample & 2) ? "-" : "";
+            for (size_t i = 0, length = 1 + gen() % 80u; i < length; ++i) {
+                number += digits[gen() % digit_count];
+            }
+        }
+        const std::string padded[] = { number, number + ",0123456789abcdef", number + "g" + number };
+        for (const std::string& text : padded) {
+            parse_result<T> r = parse<T, Base>(text);
+            parse_result<T> expected = reference_parse<T, Base>(text);
+            if (r.value != expected.value || r.error != expected.error || r.ptr != expected.ptr) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Bitwise equality, so signed zeros are told apart
+template<typename T>
+static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+static double reference_parse(const char* text, double) { return std::strtod(text, nullptr); }
+static float reference_parse(const char* text, float) { return std::strtof(text, nullptr); }
+
+// parse_cast<T> against strtod / strtof (correctly rounded in the C locale):
+// same value, an overflow error for infinity and underflow for a nonzero text read as zero
+template<typename T>
+static bool matches_strtod(const char* text) {
+    const T expected = reference_parse(text, T());
+    parse_result<T> r = parse_cast<T>(text, text + std::strlen(text));
+    if (r.ptr != text + std::strlen(text)) {
+        return false;
+    }
+    if (std::isinf(expected)) {
+        return r.error == (expected > 0 ? cast_error::positive_overflow : cast_error::negative_overflow);
+    }
+    if (expected == 0 && r.error == cast_error::underflow) {
+        return true;
+    }
+    return r.ok() && same_bits(r.value, expected);
+}
+
+// Random values printed with 1 to 25 significant digits, and float midpoints (exact in double)
+static bool matches_strtod_random(unsigned seed, int count) {
+    std::mt19937_64 gen(seed);
+    char text[128];
+    for (int i = 0; i < count; ++i) {
+        std::uint64_t bits = gen();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (std::isfinite(d)) {
+            std::snprintf(text, sizeof(text), "%.*g", 1 + static_cast<int>(gen() % 25u), d);
+            if (!matches_strtod<double>(text) || !matches_strtod<float>(text)) {
+                return false;
+            }
+        }
+        std::uint32_t narrow_bits = static_cast<std::uint32_t>(gen());
+        float f;
+        std::memcpy(&f, &narrow_bits, sizeof(f));
+        float next = std::nextafter(f, std::numeric_limits<float>::infinity());
+        if (std::isfinite(f) && std::isfinite(next)) {
+            std::snprintf(text, sizeof(text), "%.*g", 1 + static_cast<int>(gen() % 25u), static_cast<double>(f));
+            if (!matches_strtod<double>(text) || !matches_strtod<float>(text)) {
+                return false;
+            }
+            std::snprintf(text, sizeof(text), "%.60g", (static_cast<double>(f) + static_cast<double>(next)) / 2);
+            if (!matches_strtod<float>(text)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// PARSE TESTS
+// =============================================================================
+
+#if NCAST_HAS_CONSTEXPR_VALIDATION
+constexpr const char port_text[] = "8080";
+static_assert(parse_cast<std::uint16_t>(port_text, port_text + 4).value == 8080, "parsed at compile time");
+constexpr const char big_text[] = "65536";
+static_assert(parse_cast<std::uint16_t>(big_text, big_text + 5).error == cast_error::positive_overflow,
+              "overflow detected at compile time");
+constexpr const char timestamp_text[] = "1700000000123,42";
+static_assert(parse_cast<std::int64_t>(timestamp_text, timestamp_text + 16).value == 1700000000123LL,
+              "8-digit words at compile time");
+#endif
+
+// Test every value around the ranges of the narrow types
+UTEST_FUNC_DEF(ParseMatchesNumericCast) {
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::int8_t>(-1000, 1000)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::uint8_t>(-1000, 1000)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::int16_t>(-100000, 100000)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::uint16_t>(-1000, 100000)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::int32_t>(-2147484648LL, -2147482648LL)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::int32_t>(2147482648LL, 2147484648LL)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<std::uint32_t>(4294966296LL, 4294968296LL)));
+    UTEST_ASSERT_TRUE((matches_numeric_cast<char>(-300, 300)));
+}
+
+// Test 64-bit limits, leading zeros and long digit runs
+UTEST_FUNC_DEF(ParseLimits) {
+    const std::int64_t int64_max = std::numeric_limits<std::int64_t>::max();
+    const std::int64_t int64_min = std::numeric_limits<std::int64_t>::min();
+    UTEST_ASSERT_TRUE((parses_as<std::int64_t>("9223372036854775807", int64_max, cast_error::none, 19)));
+    UTEST_ASSERT_TRUE((parses_as<std::int64_t>("-9223372036854775808", int64_min, cast_error::none, 20)));
+    UTEST_ASSERT_TRUE((parses_as<std::int64_t>("9223372036854775808", 0, cast_error::positive_overflow, 19)));
+    UTEST_ASSERT_TRUE((parses_as<std::int64_t>("-9223372036854775809", 0, cast_error::negative_overflow, 20)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint64_t>("18446744073709551615", std::numeric_limits<std::uint64_t>::max(),
+                                                cast_error::none, 20)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint64_t>("18446744073709551616", 0u, cast_error::positive_overflow, 20)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint64_t>("99999999999999999999", 0u, cast_error::positive_overflow, 20)));
+
+    // Overflow consumes every digit of the number, like from_chars
+    UTEST_ASSERT_TRUE((parses_as<std::int16_t>("123456789012345678901234567890,7", 0, cast_error::positive_overflow, 30)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint8_t>("-123456789012345678901234567890", 0, cast_error::negative_to_unsigned, 31)));
+
+    // Leading zeros are not significant digits
+    UTEST_ASSERT_TRUE((parses_as<std::int8_t>("0000000000000000000000127", 127, cast_error::none, 25)));
+    UTEST_ASSERT_TRUE((parses_as<std::int8_t>("-0000000000000000000000128", -128, cast_error::none, 26)));
+    UTEST_ASSERT_TRUE((parses_as<std::int8_t>("0000000000000000000000128", 0, cast_error::positive_overflow, 25)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint64_t>("00000000000000000000000", 0u, cast_error::none, 23)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint32_t>("-0", 0u, cast_error::none, 2)));
+}
+
+// Test syntax: what is consumed and what is rejected
+UTEST_FUNC_DEF(ParseSyntax) {
+    UTEST_ASSERT_TRUE((parses_as<int>("42,17", 42, cast_error::none, 2)));
+    UTEST_ASSERT_TRUE((parses_as<int>("-7 ", -7, cast_error::none, 2)));
+    UTEST_ASSERT_TRUE((parses_as<int>("12abc", 12, cast_error::none, 2)));
+    UTEST_ASSERT_TRUE((parses_as<int>("", 0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<int>("-", 0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<int>("+5", 0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<int>(" 5", 0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<int>("--5", 0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<unsigned>("x1", 0u, cast_error::invalid_format, 0)));
+
+    // The end pointer bounds the number
+    const char* text = "123456";
+    parse_result<int> r = parse_cast<int>(text, text + 3);
+    UTEST_ASSERT_EQUALS(123, r.value);
+    UTEST_ASSERT_TRUE(r.ptr == text + 3 && r.ok());
+    parse_result<std::int8_t> clipped = parse_cast<std::int8_t>(text, text + 4);
+    UTEST_ASSERT_TRUE(clipped.error == cast_error::positive_overflow && clipped.ptr == text + 4);
+}
+
+// Test 8-digit words: every field length and target type, field boundaries
+UTEST_FUNC_DEF(ParseSwar) {
+    UTEST_ASSERT_TRUE((matches_reference<std::int8_t>(1)));
+    UTEST_ASSERT_TRUE((matches_reference<std::uint8_t>(2)));
+    UTEST_ASSERT_TRUE((matches_reference<std::int16_t>(3)));
+    UTEST_ASSERT_TRUE((matches_reference<std::uint16_t>(4)));
+    UTEST_ASSERT_TRUE((matches_reference<std::int32_t>(5)));
+    UTEST_ASSERT_TRUE((matches_reference<std::uint32_t>(6)));
+    UTEST_ASSERT_TRUE((matches_reference<std::int64_t>(7)));
+    UTEST_ASSERT_TRUE((matches_reference<std::uint64_t>(8)));
+
+    // Fixed-width fields and limits read through whole words
+    UTEST_ASSERT_TRUE((parses_as<std::int64_t>("1700000000123,1700000000124", 1700000000123LL, cast_error::none, 13)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint32_t>("12345678,00000000", 12345678u, cast_error::none, 8)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint32_t>("4294967295,0000000", 4294967295u, cast_error::none, 10)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint32_t>("4294967296,0000000", 0u, cast_error::positive_overflow, 10)));
+    UTEST_ASSERT_TRUE((parses_as<std::int16_t>("32767,32768,12345", 32767, cast_error::none, 5)));
+    UTEST_ASSERT_TRUE((parses_as<std::int16_t>("32768,32767,12345", 0, cast_error::positive_overflow, 5)));
+    UTEST_ASSERT_TRUE((parses_as<std::uint64_t>("18446744073709551615,12345678",
+                                                std::numeric_limits<std::uint64_t>::max(), cast_error::none, 20)));
+
+    // Every byte value that is not a digit ends the run, wherever it is in the word
+    for (int c = 0; c < 256; ++c) {
+        if (c >= '0' && c <= '9') {
+            continue;
+        }
+        for (size_t at = c == '-' ? 1 : 0; at < 8; ++at) {
+            std::string text = "98765432101234";
+            text[at] = static_cast<char>(c);
+            parse_result<std::int64_t> r = parse<std::int64_t>(text);
+            UTEST_ASSERT_TRUE(r.ptr == text.data() + at);
+        }
+    }
+}
+
+// Test bases 2, 8 and 16: values with leading zeros, long runs (SIMD blocks), overflow and syntax
+UTEST_FUNC_DEF(ParseRadix) {
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int8_t, 16>(21)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint16_t, 16>(22)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int32_t, 16>(23)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint64_t, 16>(24)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int64_t, 16>(25)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint8_t, 8>(26)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int32_t, 8>(27)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint64_t, 8>(28)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int64_t, 8>(29)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int16_t, 2>(30)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint32_t, 2>(31)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::uint64_t, 2>(32)));
+    UTEST_ASSERT_TRUE((matches_radix_reference<std::int64_t, 2>(33)));
+
+    // Limits: the leading digit decides digit counts at the width of T
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("DEADBEEF").value == 0xdeadbeefu));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("00000000ffffffff").value == 0xffffffffu));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("100000000").error == cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE((parse<std::int8_t, 16>("7f").value == 127));
+    UTEST_ASSERT_TRUE((parse<std::int8_t, 16>("80").error == cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE((parse<std::int8_t, 16>("-80").value == -128));
+    UTEST_ASSERT_TRUE((parse<std::int8_t, 16>("-81").error == cast_error::negative_overflow));
+    UTEST_ASSERT_TRUE((parse<std::uint64_t, 8>("1777777777777777777777").value == std::numeric_limits<std::uint64_t>::max()));
+    UTEST_ASSERT_TRUE((parse<std::uint64_t, 8>("2000000000000000000000").error == cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE((parse<std::uint64_t, 2>(std::string(64, '1')).value == std::numeric_limits<std::uint64_t>::max()));
+    UTEST_ASSERT_TRUE((parse<std::uint64_t, 2>("1" + std::string(64, '0')).error == cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE((parse<std::uint64_t, 2>(std::string(100, '0') + "101").value == 5u));
+
+    // Syntax: no prefix, digits of the base only, consumed count and error kinds as in base 10
+    UTEST_ASSERT_TRUE((parses_as<std::uint32_t>("ff", 0u, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("0x1f").value == 0u && parse<std::uint32_t, 16>("0x1f").ptr[0] == 'x'));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("x1f").error == cast_error::invalid_format));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("aBcDeFg").value == 0xabcdefu));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 8>("778").value == 63u));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 2>("1012").value == 5u));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 2>("-").error == cast_error::invalid_format));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("-0").ok()));
+    UTEST_ASSERT_TRUE((parse<std::uint32_t, 16>("-1").error == cast_error::negative_to_unsigned));
+    UTEST_ASSERT_TRUE((parse<std::uint8_t, 16>("1ff,").ptr[0] == ','));
+
+    // Every byte value that is not a hexadecimal digit ends the run, wherever it is in a block
+    for (int c = 0; c < 256; ++c) {
+        if (reference_digit(static_cast<char>(c), 16) < 16) {
+            continue;
+        }
+        for (size_t at = c == '-' ? 1 : 0; at < 16; ++at) {
+            std::string text = "0123456789abcdefABCDEF";
+            text[at] = static_cast<char>(c);
+            parse_result<std::uint64_t> r = parse<std::uint64_t, 16>(text);
+            UTEST_ASSERT_TRUE(r.ptr == text.data() + at);
+        }
+    }
+}
+
+// Test float and double against strtod / strtof: rounding, ties, limits, error kinds
+UTEST_FUNC_DEF(ParseFloat) {
+    UTEST_ASSERT_TRUE(matches_strtod_random(11, 20000));
+
+    const char* hard[] = {
+        "0", "1", "0.1", "3.14159265358979323846", "1e23", "8.589973e9", "1.00000005960464477539062500000000001",
+        "9007199254740993", "9007199254740995", "9007199254740993.0000000000000000001",
+        "9007199254740992.99999999999999999999", "2.2250738585072011e-308", "2.2250738585072012e-308",
+        "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+        "3.4028235e38", "3.4028236e38", "1.17549435e-38", "1.4e-45", "7e-46", "7.1e-46",
+        "123456789012345678901234567890e-10", "0.000000000000000000000000000000000000000000001e46",
+        "100000000000000000000000000000000000000000000001", "-1e39", "-1e-400", "1e400", "0e999999999999"
+    };
+    for (size_t i = 0; i < sizeof(hard) / sizeof(hard[0]); ++i) {
+        UTEST_ASSERT_TRUE(matches_strtod<double>(hard[i]));
+        UTEST_ASSERT_TRUE(matches_strtod<float>(hard[i]));
+    }
+
+    // Error kinds: the motivating case, underflow and a value T() on failure
+    UTEST_ASSERT_TRUE((parses_as<float>("1e39", 0.0f, cast_error::positive_overflow, 4)));
+    UTEST_ASSERT_TRUE((parses_as<float>("-1e39", 0.0f, cast_error::negative_overflow, 5)));
+    UTEST_ASSERT_TRUE((parses_as<double>("1e39", 1e39, cast_error::none, 4)));
+    UTEST_ASSERT_TRUE((parses_as<float>("1e-46", 0.0f, cast_error::underflow, 5)));
+    UTEST_ASSERT_TRUE((parses_as<float>("1e-45", std::numeric_limits<float>::denorm_min(), cast_error::none, 5)));
+    UTEST_ASSERT_TRUE((parses_as<double>("-1e-400", 0.0, cast_error::underflow, 7)));
+
+    // A long digit run past the 800 digits kept by the exact fallback still breaks a tie upward
+    std::string tie_up = "9007199254740993." + std::string(1000, '0') + "1";
+    UTEST_ASSERT_TRUE((parses_as<double>(tie_up, 9007199254740994.0, cast_error::none, tie_up.size())));
+    std::string tie = "9007199254740993." + std::string(1000, '0');
+    UTEST_ASSERT_TRUE((parses_as<double>(tie, 9007199254740992.0, cast_error::none, tie.size())));
+}
+
+// Test floating-point syntax: from_chars' general format, inf / nan, signed zero, locale
+UTEST_FUNC_DEF(ParseFloatSyntax) {
+    UTEST_ASSERT_TRUE((parses_as<double>(".5", 0.5, cast_error::none, 2)));
+    UTEST_ASSERT_TRUE((parses_as<double>("5.", 5.0, cast_error::none, 2)));
+    UTEST_ASSERT_TRUE((parses_as<double>("-.25e-1x", -0.025, cast_error::none, 7)));
+    UTEST_ASSERT_TRUE((parses_as<double>("1.5E+2,", 150.0, cast_error::none, 6)));
+    UTEST_ASSERT_TRUE((parses_as<double>("1e", 1.0, cast_error::none, 1)));
+    UTEST_ASSERT_TRUE((parses_as<double>("1e+", 1.0, cast_error::none, 1)));
+    UTEST_ASSERT_TRUE((parses_as<double>("2.5.1", 2.5, cast_error::none, 3)));
+    UTEST_ASSERT_TRUE((parses_as<double>("0x10", 0.0, cast_error::none, 1)));
+    UTEST_ASSERT_TRUE((parses_as<double>(".", 0.0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<double>("-", 0.0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<double>("+1", 0.0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<double>(" 1", 0.0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<double>("e5", 0.0, cast_error::invalid_format, 0)));
+    UTEST_ASSERT_TRUE((parses_as<float>("in", 0.0f, cast_error::invalid_format, 0)));
+
+    // Signed zero is not an underflow
+    parse_result<double> negative_zero = parse<double>("-0.000e-999");
+    UTEST_ASSERT_TRUE(negative_zero.ok() && negative_zero.value == 0.0 && std::signbit(negative_zero.value));
+
+    // Infinity and NaN are values, as in numeric_cast between floating-point types
+    parse_result<float> inf = parse<float>("-Infinity");
+    UTEST_ASSERT_TRUE(inf.ok() && std::isinf(inf.value) && inf.value < 0 && *inf.ptr == '\0');
+    UTEST_ASSERT_TRUE((parses_as<double>("INFINITE", std::numeric_limits<double>::infinity(), cast_error::none, 3)));
+    parse_result<double> nan = parse<double>("nan(0x1f),");
+    UTEST_ASSERT_TRUE(nan.ok() && std::isnan(nan.value) && *nan.ptr == ',');
+    parse_result<double> unclosed = parse<double>("NaN(abc");
+    UTEST_ASSERT_TRUE(unclosed.ok() && std::isnan(unclosed.value) && *unclosed.ptr == '(');
+
+    // The decimal point is always '.', whatever the C locale
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") != nullptr || std::setlocale(LC_NUMERIC, "fr_FR.UTF-8") != nullptr) {
+        UTEST_ASSERT_TRUE((parses_as<double>("1.5", 1.5, cast_error::none, 3)));
+        UTEST_ASSERT_TRUE((parses_as<double>("1,5", 1.0, cast_error::none, 1)));
+        std::setlocale(LC_NUMERIC, "C");
+    }
+}
+
+// Test half: every value, every midpoint (ties to even) and the floats around each midpoint
+UTEST_FUNC_DEF(ParseHalf) {
+    char text[256];
+    for (std::uint16_t bits = 0; bits < 0x7bff; ++bits) {
+        const float value = static_cast<float>(half::from_bits(bits));
+        const float midpoint = (value + static_cast<float>(half::from_bits(static_cast<std::uint16_t>(bits + 1)))) / 2;
+        const float inputs[] = { value, midpoint, std::nextafter(midpoint, 0.0f), std::nextafter(midpoint, 1e9f) };
+        for (float input : inputs) {
+            // Exact decimal expansion of the float
+            std::snprintf(text, sizeof(text), "%.150e", static_cast<double>(input));
+            parse_result<half> r = parse<half>(text);
+            const std::uint16_t expected = half(input).bits();
+            if (expected == 0 && input != 0) {
+                UTEST_ASSERT_TRUE(r.error == cast_error::underflow);
+            } else {
+                UTEST_ASSERT_TRUE(r.ok() && r.value.bits() == expected);
+            }
+        }
+    }
+    UTEST_ASSERT_TRUE((parse<half>("65504").value.bits() == 0x7bff));
+    UTEST_ASSERT_TRUE((parse<half>("65519.99").value.bits() == 0x7bff));
+    UTEST_ASSERT_TRUE((parse<half>("65520").error == cast_error::positive_overflow));
+    UTEST_ASSERT_TRUE((parse<half>("-1e5").error == cast_error::negative_overflow));
+    UTEST_ASSERT_TRUE((parse<half>("5.96e-8").value.bits() == 0x0001));
+    UTEST_ASSERT_TRUE((parse<half>("2.98e-8").error == cast_error::underflow));
+    UTEST_ASSERT_TRUE((parse<half>("-0.5").value.bits() == 0xb800));
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    UTEST_FUNC(ParseMatchesNumericCast);
+    UTEST_FUNC(ParseLimits);
+    UTEST_FUNC(ParseSyntax);
+    UTEST_FUNC(ParseSwar);
+    UTEST_FUNC(ParseRadix);
+    UTEST_FUNC(ParseFloat);
+    UTEST_FUNC(ParseFloatSyntax);
+    UTEST_FUNC(ParseHalf);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+#include "../include/ncast/ncast_policy.h"
+#include "../include/ncast/ncast_saturate.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Floating-point sentinel for replace::with_constant
+struct missing_reading {
+    static constexpr double value = -0.5;
+};
+
+// Sentinel policy: a distinct replacement for every error kind
+typedef replace_policy<replace::with_value<int, 101>, replace::with_value<int, -102>, replace::with_value<int, 103>,
+                       replace::with_value<int, -104>, replace::with_value<int, 105> > SentinelPolicy;
+
+// Replacement the policy should produce for the error reference_cast reports
+// (only the sentinels of kinds the pair can produce exist, see make_replacement_values)
+template<typename Policy, typename To, typename From>
+static To expected_replacement(From value, cast_error kind) {
+    const detail::replacement_values<To> r = detail::make_replacement_values<Policy, To, From>();
+    bool negative = value < From(0);
+    switch (kind) {
+    case cast_error::positive_overflow:
+        return r.positive_overflow;
+    case cast_error::negative_overflow:
+    case cast_error::negative_to_unsigned:
+        return r.below_min;
+    case cast_error::nan:
+        return r.nan;
+    case cast_error::infinity:
+        return negative ? r.negative_infinity : r.positive_infinity;
+    default:
+        return To();
+    }
+}
+
+static bool same_value(double a, double b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// Compare convert_with_policy with element-wise reference_cast plus the policy's replacement
+template<typename Policy, typename To, typename From>
+static bool check_policy(const std::vector<From>& values) {
+    std::vector<To> dst(values.size() + 1, To(3));
+    size_t replaced = convert_with_policy<Policy>(values.data(), values.size(), dst.data());
+
+    size_t expected_replaced = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        To expected;
+        try {
+            expected = reference_cast<To>(values[i]);
+        } catch (const cast_exception& e) {
+            expected = expected_replacement<Policy, To>(values[i], e.getError());
+            ++expected_replaced;
+        }
+        if (!same_value(static_cast<double>(dst[i]), static_cast<double>(expected))) {
+            return false;
+        }
+    }
+    return replaced == expected_replaced && dst[values.size()] == To(3);
+}
+
+// Mix of in-range and failing values, long enough to cross block boundaries
+template<typename From>
+static std::vector<From> mixed_values(const std::vector<From>& specials, From good) {
+    std::vector<From> values(700, good);
+    for (size_t i = 0; i < values.size(); i += 3) {
+        values[i] = specials[(i / 3) % specials.size()];
+    }
+    return values;
+}
+
+// =============================================================================
+// REPLACEMENT POLICY TESTS
+// =============================================================================
+
+// Test each error kind mapped to its own sentinel
+UTEST_FUNC_DEF(PolicySentinels) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> doubles;
+    doubles.push_back(nan);
+    doubles.push_back(inf);
+    doubles.push_back(-inf);
+    doubles.push_back(1.0e10);
+    doubles.push_back(-1.0e10);
+    doubles.push_back(-0.5);
+    doubles.push_back(2147483647.0);
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, std::int32_t>(mixed_values(doubles, 42.75))));
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, std::int16_t>(mixed_values(doubles, -42.75))));
+
+    std::vector<std::int64_t> integers;
+    integers.push_back(std::numeric_limits<std::int64_t>::min());
+    integers.push_back(std::numeric_limits<std::int64_t>::max());
+    integers.push_back(-1);
+    integers.push_back(40000);
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, std::int16_t>(mixed_values<std::int64_t>(integers, 7))));
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, std::uint16_t>(mixed_values<std::int64_t>(integers, 7))));
+
+    std::vector<std::uint32_t> unsigned_values(1, 4000000000u);
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, std::int8_t>(mixed_values<std::uint32_t>(unsigned_values, 100u))));
+
+    // Signed -> unsigned reports negative_to_unsigned, float -> unsigned negative_overflow
+    typedef replace_policy<>::on_negative_overflow<replace::with_value<int, 1> >
+                            ::on_negative_to_unsigned<replace::with_value<int, 2> > SignPolicy;
+    std::vector<std::int32_t> negative(1, -5);
+    std::vector<float> negative_float(1, -5.0f);
+    std::vector<std::uint8_t> narrow(1);
+    convert_with_policy<SignPolicy>(negative.data(), negative.size(), narrow.data());
+    UTEST_ASSERT_EQUALS(2, narrow[0]);
+    convert_with_policy<SignPolicy>(negative_float.data(), negative_float.size(), narrow.data());
+    UTEST_ASSERT_EQUALS(1, narrow[0]);
+}
+
+// Test the default policy against saturate_cast_n
+UTEST_FUNC_DEF(PolicyDefaultSaturates) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> doubles;
+    doubles.push_back(nan);
+    doubles.push_back(-inf);
+    doubles.push_back(3.0e9);
+    doubles.push_back(-3.0e9);
+    std::vector<double> values = mixed_values(doubles, 1.5);
+    std::vector<std::int32_t> policy(values.size());
+    std::vector<std::int32_t> saturated(values.size());
+    size_t replaced = convert_with_policy<replace_policy<> >(values.data(), values.size(), policy.data());
+    size_t clamped = 0;
+    saturate_cast_n(values.data(), values.size(), saturated.data(), &clamped);
+    UTEST_ASSERT_TRUE(policy == saturated);
+    UTEST_ASSERT_EQUALS(clamped, replaced);
+    UTEST_ASSERT_TRUE((check_policy<replace_policy<>, std::int32_t>(values)));
+
+    std::vector<std::int32_t> integers = mixed_values<std::int32_t>(std::vector<std::int32_t>(1, -70000), 300);
+    std::vector<std::int16_t> policy16(integers.size());
+    std::vector<std::int16_t> saturated16(integers.size());
+    convert_with_policy<replace_policy<> >(integers.data(), integers.size(), policy16.data());
+    saturate_cast_n(integers.data(), integers.size(), saturated16.data());
+    UTEST_ASSERT_TRUE(policy16 == saturated16);
+
+    // 2^31 and 2^63 are out of range, not the integer max
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int32_t>::max(), (replace_cast<replace_policy<>, std::int32_t>(2147483648.0f)));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int64_t>::max(),
+                        (replace_cast<replace_policy<>, std::int64_t>(9223372036854775808.0)));
+    typedef replace_policy<>::on_positive_overflow<replace::with_value<int, -7> > OverflowSentinel;
+    UTEST_ASSERT_EQUALS(-7, (replace_cast<OverflowSentinel, std::int32_t>(2147483648.0f)));
+    std::vector<float> bounds(21, 2147483520.0f);
+    bounds[20] = 2147483648.0f;
+    std::vector<std::int32_t> bounded(bounds.size());
+    UTEST_ASSERT_EQUALS(1u, (convert_with_policy<OverflowSentinel>(bounds.data(), bounds.size(), bounded.data())));
+    UTEST_ASSERT_EQUALS(-7, bounded[20]);
+    UTEST_ASSERT_EQUALS(2147483520, bounded[0]);
+}
+
+// Test floating-point targets: NaN and infinity pass, finite overflow is replaced
+UTEST_FUNC_DEF(PolicyFloatingPointTargets) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> doubles;
+    doubles.push_back(nan);
+    doubles.push_back(inf);
+    doubles.push_back(1.0e300);
+    doubles.push_back(-1.0e300);
+    std::vector<double> values = mixed_values(doubles, 0.25);
+    UTEST_ASSERT_TRUE((check_policy<replace_policy<>, float>(values)));
+    UTEST_ASSERT_TRUE((check_policy<replace_policy<>::on_overflow<replace::with_nan>, float>(values)));
+    UTEST_ASSERT_TRUE((check_policy<SentinelPolicy, float>(values)));
+
+    std::vector<float> out(values.size());
+    size_t replaced = convert_with_policy<replace_policy<>::on_overflow<replace::with_nan> >(
+        values.data(), values.size(), out.data());
+    UTEST_ASSERT_TRUE(std::isnan(out[6]));   // 1e300
+    UTEST_ASSERT_TRUE(std::isinf(out[3]));   // infinity passes
+    UTEST_ASSERT_EQUALS(116u, replaced);     // every other special is a finite overflow
+}
+
+// Test the on_* builders, sentinels of error kinds a pair cannot produce and typed sentinels
+UTEST_FUNC_DEF(PolicyBuildersAndTypedSentinels) {
+    typedef replace_policy<>::on_nan<replace::with_default>::on_infinity<replace::with_max>
+                            ::on_negative_overflow<replace::with_lowest> Policy;
+    std::vector<float> values;
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+    values.push_back(-std::numeric_limits<float>::infinity());
+    values.push_back(-1.0e6f);
+    values.push_back(1.0e6f);
+    values.push_back(12.5f);
+    std::vector<std::int16_t> out(values.size());
+    UTEST_ASSERT_EQUALS(4u, convert_with_policy<Policy>(values.data(), values.size(), out.data()));
+    UTEST_ASSERT_EQUALS(0, out[0]);
+    UTEST_ASSERT_EQUALS(32767, out[1]);
+    UTEST_ASSERT_EQUALS(-32768, out[2]);
+    UTEST_ASSERT_EQUALS(32767, out[3]);
+    UTEST_ASSERT_EQUALS(12, out[4]);
+
+    // A sentinel for a kind the pair cannot produce is never evaluated
+    std::vector<std::uint16_t> small(3, 9);
+    std::vector<std::uint8_t> narrow(small.size());
+    UTEST_ASSERT_EQUALS(0u, (convert_with_policy<replace_policy<>::on_nan<replace::with_value<int, -1> > >(
+        small.data(), small.size(), narrow.data())));
+
+    // The policy of a uint16 -> uint8 conversion instantiates only the positive overflow sentinel
+    UTEST_ASSERT_EQUALS(0u, (convert_with_policy<replace_policy<>::on_negative_overflow<replace::with_value<int, -1> > >(
+        small.data(), small.size(), narrow.data())));
+
+    // Widening pair: no overflow is possible, so an unfit overflow sentinel is never evaluated
+    std::vector<std::int8_t> bytes(3, -5);
+    std::vector<std::int32_t> wide(bytes.size());
+    UTEST_ASSERT_EQUALS(0u, (convert_with_policy<replace_policy<>::on_overflow<replace::with_value<long long, (1LL << 40)> > >(
+        bytes.data(), bytes.size(), wide.data())));
+    UTEST_ASSERT_EQUALS(-5, wide[2]);
+
+    // One-sided pair: uint8 -> int8 can exceed the maximum but never go below the minimum
+    std::vector<std::uint8_t> unsigned_bytes(3, 200);
+    std::vector<std::int8_t> signed_bytes(unsigned_bytes.size());
+    typedef replace_policy<>::on_negative_overflow<replace::with_value<int, -1000> > BelowMinSentinel;
+    UTEST_ASSERT_EQUALS(3u, convert_with_policy<BelowMinSentinel>(
+        unsigned_bytes.data(), unsigned_bytes.size(), signed_bytes.data()));
+    UTEST_ASSERT_EQUALS(127, signed_bytes[0]);
+    UTEST_ASSERT_EQUALS(127, (replace_cast<BelowMinSentinel, std::int8_t>(std::uint8_t(255))));
+
+
+    // Typed sentinels beyond long long, and floating-point sentinels through with_constant
+    const std::uint64_t marker = std::numeric_limits<std::uint64_t>::max() - 1;
+    std::vector<double> prices(4, 2.5);
+    prices[1] = -1.0;
+    prices[3] = std::numeric_limits<double>::quiet_NaN();
+    std::vector<std::uint64_t> ids(prices.size());
+    typedef replace_policy<>::on_negative_overflow<replace::with_value<std::uint64_t, 0xfffffffffffffffeull> >
+                            ::on_nan<replace::with_value<std::uint64_t, 0xfffffffffffffffeull> > MarkerPolicy;
+    UTEST_ASSERT_EQUALS(2u, convert_with_policy<MarkerPolicy>(prices.data(), prices.size(), ids.data()));
+    UTEST_ASSERT_EQUALS(marker, ids[1]);
+    UTEST_ASSERT_EQUALS(marker, ids[3]);
+    UTEST_ASSERT_EQUALS(2u, ids[0]);
+
+    std::vector<double> readings(3, 1.0e300);
+    readings[0] = 0.25;
+    std::vector<float> stored(readings.size());
+    UTEST_ASSERT_EQUALS(2u, convert_with_policy<replace_policy<>::on_overflow<replace::with_constant<missing_reading> > >(
+        readings.data(), readings.size(), stored.data()));
+    UTEST_ASSERT_EQUALS(0.25f, stored[0]);
+    UTEST_ASSERT_EQUALS(-0.5f, stored[2]);
+    UTEST_ASSERT_EQUALS(-0.5f, (replace_cast<replace_policy<>::on_overflow<replace::with_constant<missing_reading> >, float>(-1.0e300)));
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Replacement policy tests
+    UTEST_FUNC(PolicySentinels);
+    UTEST_FUNC(PolicyDefaultSaturates);
+    UTEST_FUNC(PolicyFloatingPointTargets);
+    UTEST_FUNC(PolicyBuildersAndTypedSentinels);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
@@ -0,0 +1,295 @@
+#include "../include/ncast/ncast_range.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Reference check: does every element pass reference_cast<To>?
+template<typename To, typename From>
+static bool all_pass_reference_cast(const std::vector<From>& data) {
+    for (size_t i = 0; i < data.size(); ++i) {
+        try {
+            To converted = reference_cast<To>(data[i]);
+            (void)converted;
+        } catch (const cast_exception&) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Does a single value pass numeric_cast<To> (the constexpr path in C++14+ builds)?
+template<typename To, typename From>
+static bool passes_numeric_cast(From value) {
+    try {
+        To converted = numeric_cast<To>(value);
+        (void)converted;
+        return true;
+    } catch (const cast_exception&) {
+        return false;
+    }
+}
+
+// Place the extremes at every position so SIMD lanes, unrolled blocks and
+// the scalar tail are all exercised; compare with a plain scalar reference
+template<typename T>
+static bool check_extremes_at_every_position(T fill, T low, T high) {
+    for (size_t size = 1; size < 140; size += 7) {
+        for (size_t pos = 0; pos < size; ++pos) {
+            std::vector<T> data(size, fill);
+            data[(pos * 5 + 3) % size] = high;
+            data[pos] = low;
+            T expected_min = data[0];
+            T expected_max = data[0];
+            for (size_t i = 1; i < size; ++i) {
+                expected_min = data[i] < expected_min ? data[i] : expected_min;
+                expected_max = data[i] > expected_max ? data[i] : expected_max;
+            }
+            range_stats<T> stats = analyze_range(data.data(), data.size());
+            if (stats.min != expected_min || stats.max != expected_max || stats.count != size ||
+                stats.has_negative != (expected_min < T(0))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// ANALYZE_RANGE TESTS
+// =============================================================================
+
+// Test min/max of every integer width at every position
+UTEST_FUNC_DEF(AnalyzeRangeIntegers) {
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::int8_t>(3, -128, 127));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::uint8_t>(100, 0, 255));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::int16_t>(-5, -32768, 32767));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::uint16_t>(7, 1, 65535));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::int32_t>(0, std::numeric_limits<std::int32_t>::min(), 12));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::uint32_t>(1u << 20, 3u, 0xffffffffu));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::int64_t>(-1, std::numeric_limits<std::int64_t>::min(),
+                                                                   std::numeric_limits<std::int64_t>::max()));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<std::uint64_t>(1ull << 40, 2ull, 0xffffffffffffffffull));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<char>('m', 'a', 'z'));
+
+    std::vector<std::int64_t> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(static_cast<std::int64_t>(i) * 1000003 - 7);
+    }
+    range_stats<std::int64_t> stats = analyze_range(values.data(), values.size());
+    UTEST_ASSERT_EQUALS(-7, stats.min);
+    UTEST_ASSERT_EQUALS(static_cast<std::int64_t>(999) * 1000003 - 7, stats.max);
+    UTEST_ASSERT_TRUE(stats.has_negative);
+    UTEST_ASSERT_FALSE(stats.has_nan);
+    UTEST_ASSERT_FALSE(stats.has_inf);
+    UTEST_ASSERT_FALSE(stats.empty());
+
+    range_stats<int> empty = analyze_range(static_cast<const int*>(nullptr), 0);
+    UTEST_ASSERT_TRUE(empty.empty());
+    UTEST_ASSERT_EQUALS(0u, empty.count);
+}
+
+// Test floating-point scans: finite min/max and special value flags
+UTEST_FUNC_DEF(AnalyzeRangeFloatingPoint) {
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<float>(0.5f, -3.0e38f, 1.0e-30f));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<double>(-2.0, -1.0e300, 1.0e300));
+    UTEST_ASSERT_TRUE(check_extremes_at_every_position<long double>(1.0L, -4.0L, 8.0L));
+
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (size_t pos = 0; pos < 37; ++pos) {
+        std::vector<float> data(37, 2.0f);
+        data[(pos + 11) % 37] = 1.0f;
+        data[pos] = nan;
+        range_stats<float> with_nan = analyze_range(data.data(), data.size());
+        UTEST_ASSERT_TRUE(with_nan.has_nan);
+        UTEST_ASSERT_FALSE(with_nan.has_inf);
+        UTEST_ASSERT_FALSE(with_nan.has_negative);
+        UTEST_ASSERT_EQUALS(1.0f, with_nan.min);
+        UTEST_ASSERT_EQUALS(2.0f, with_nan.max);
+
+        data[pos] = -inf;
+        range_stats<float> with_inf = analyze_range(data.data(), data.size());
+        UTEST_ASSERT_FALSE(with_inf.has_nan);
+        UTEST_ASSERT_TRUE(with_inf.has_inf);
+        UTEST_ASSERT_TRUE(with_inf.has_negative);
+        UTEST_ASSERT_EQUALS(1.0f, with_inf.min);
+        UTEST_ASSERT_EQUALS(2.0f, with_inf.max);
+    }
+
+    // -0.0 is not negative
+    std::vector<double> zeros(19, -0.0);
+    range_stats<double> zero_stats = analyze_range(zeros.data(), zeros.size());
+    UTEST_ASSERT_FALSE(zero_stats.has_negative);
+    UTEST_ASSERT_FALSE(zero_stats.empty());
+
+    // Only special values: no finite range
+    std::vector<double> specials(10, std::numeric_limits<double>::quiet_NaN());
+    specials[3] = std::numeric_limits<double>::infinity();
+    range_stats<double> special_stats = analyze_range(specials.data(), specials.size());
+    UTEST_ASSERT_TRUE(special_stats.empty());
+    UTEST_ASSERT_TRUE(special_stats.has_nan);
+    UTEST_ASSERT_TRUE(special_stats.has_inf);
+    UTEST_ASSERT_FALSE(special_stats.has_negative);
+}
+
+// =============================================================================
+// FITS_IN TESTS
+// =============================================================================
+
+// fits_in must agree with element-wise reference_cast
+UTEST_FUNC_DEF(FitsInMatchesNumericCast) {
+    std::vector<std::int64_t> ints;
+    ints.push_back(0);
+    ints.push_back(255);
+    UTEST_ASSERT_TRUE(fits_in<std::uint8_t>(analyze_range(ints.data(), ints.size())));
+    UTEST_ASSERT_FALSE(fits_in<std::int8_t>(analyze_range(ints.data(), ints.size())));
+    ints.push_back(-1);
+    UTEST_ASSERT_FALSE(fits_in<std::uint8_t>(analyze_range(ints.data(), ints.size())));
+    UTEST_ASSERT_FALSE(fits_in<std::uint64_t>(analyze_range(ints.data(), ints.size())));
+    UTEST_ASSERT_TRUE(fits_in<std::int16_t>(analyze_range(ints.data(), ints.size())));
+    UTEST_ASSERT_TRUE(fits_in<float>(analyze_range(ints.data(), ints.size())));
+
+    const std::int64_t int_edges[] = {
+        std::numeric_limits<std::int64_t>::min(), -2147483649LL, -2147483648LL, -32769, -32768, -129, -128, -1,
+        0, 127, 128, 255, 256, 32767, 32768, 65535, 65536, 2147483647LL, 2147483648LL, 4294967295LL,
+        4294967296LL, std::numeric_limits<std::int64_t>::max()
+    };
+    const size_t edge_count = sizeof(int_edges) / sizeof(int_edges[0]);
+    for (size_t lo = 0; lo < edge_count; ++lo) {
+        for (size_t hi = lo; hi < edge_count; ++hi) {
+            std::vector<std::int64_t> data(20, int_edges[lo]);
+            data[13] = int_edges[hi];
+            range_stats<std::int64_t> stats = analyze_range(data.data(), data.size());
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::int8_t>(data), fits_in<std::int8_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::uint8_t>(data), fits_in<std::uint8_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::int16_t>(data), fits_in<std::int16_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::uint16_t>(data), fits_in<std::uint16_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::int32_t>(data), fits_in<std::int32_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::uint32_t>(data), fits_in<std::uint32_t>(stats));
+            UTEST_ASSERT_EQUALS(all_pass_reference_cast<std::uint64_t>(data), fits_in<std::uint64_t>(stats));
+        }
+    }
+
+    // Floating-point sources
+    std::vector<double> doubles(30, 1.5);
+    doubles[4] = -1.0e10;
+    UTEST_ASSERT_EQUALS(all_pass_reference_cast<float>(doubles), fits_in<float>(analyze_range(doubles.data(), doubles.size())));
+    UTEST_ASSERT_EQUALS(all_pass_reference_cast<int>(doubles), fits_in<int>(analyze_range(doubles.data(), doubles.size())));
+    UTEST_ASSERT_TRUE(fits_in<long long>(analyze_range(doubles.data(), doubles.size())));
+    doubles[9] = 1.0e300;
+    UTEST_ASSERT_FALSE(fits_in<float>(analyze_range(doubles.data(), doubles.size())));
+    UTEST_ASSERT_EQUALS(all_pass_reference_cast<float>(doubles), fits_in<float>(analyze_range(doubles.data(), doubles.size())));
+
+    // NaN and infinity: pass to floating-point targets only, like the runtime validator
+    std::vector<double> specials(12, 3.0);
+    specials[2] = std::numeric_limits<double>::quiet_NaN();
+    specials[7] = -std::numeric_limits<double>::infinity();
+    range_stats<double> special_stats = analyze_range(specials.data(), specials.size());
+    UTEST_ASSERT_TRUE(fits_in<float>(special_stats));
+    UTEST_ASSERT_TRUE(fits_in<long double>(special_stats));
+    UTEST_ASSERT_FALSE(fits_in<int>(special_stats));
+    UTEST_ASSERT_FALSE(all_pass_reference_cast<int>(specials));
+    specials[2] = 3.0;
+    UTEST_ASSERT_FALSE(fits_in<long long>(analyze_range(specials.data(), specials.size())));
+}
+
+// Float -> integer bounds: 2^N (the rounded maximum) must fail, the largest integral float below it must fit
+// (integral, so that C++14+ numeric_cast does not reject it for precision loss)
+template<typename To, typename From>
+static bool check_power_of_two_bound() {
+    const From bound = std::ldexp(From(1), std::numeric_limits<To>::digits);
+    const From below = std::floor(std::nextafter(bound, From(0)));
+    std::vector<From> data(40, From(1));
+    data[21] = below;
+    if (!fits_in<To>(analyze_range(data.data(), data.size())) || !all_pass_reference_cast<To>(data) ||
+        !passes_numeric_cast<To>(below)) {
+        return false;
+    }
+    std::vector<To> out(data.size());
+    if (!convert_if_fits(data.data(), data.size(), out.data()) || out[21] != static_cast<To>(below)) {
+        return false;
+    }
+    data[21] = bound;
+    bulk_result r = try_numeric_cast_n(data.data(), data.size(), out.data());
+    return !fits_in<To>(analyze_range(data.data(), data.size())) && !all_pass_reference_cast<To>(data) &&
+           !passes_numeric_cast<To>(bound) && !convert_if_fits(data.data(), data.size(), out.data()) &&
+           r.index == 21 && r.error == cast_error::positive_overflow;
+}
+
+// Test that 2^31, 2^32, 2^63 and 2^64 are rejected although max() rounds up to them
+UTEST_FUNC_DEF(FloatBoundsArePowersOfTwo) {
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::int32_t, float>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::uint32_t, float>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::int64_t, float>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::uint64_t, float>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::int32_t, double>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::int64_t, double>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::uint64_t, double>()));
+    UTEST_ASSERT_TRUE((check_power_of_two_bound<std::int16_t, float>()));
+
+    // The lower bound -2^(N-1) is exact and fits
+    std::vector<float> lowest(10, -2147483648.0f);
+    UTEST_ASSERT_TRUE(fits_in<std::int32_t>(analyze_range(lowest.data(), lowest.size())));
+    lowest[3] = std::nextafter(-2147483648.0f, -3e9f);
+    UTEST_ASSERT_FALSE(fits_in<std::int32_t>(analyze_range(lowest.data(), lowest.size())));
+}
+
+// =============================================================================
+// CONVERT_IF_FITS TESTS
+// =============================================================================
+
+// Test that convert_if_fits converts everything or nothing
+UTEST_FUNC_DEF(ConvertIfFits) {
+    std::vector<std::uint64_t> src;
+    for (std::uint64_t i = 0; i < 101; ++i) {
+        src.push_back(i * 40000u);
+    }
+    std::vector<std::uint32_t> dst(src.size(), 7u);
+    UTEST_ASSERT_TRUE(convert_if_fits(src.data(), src.size(), dst.data()));
+    for (size_t i = 0; i < src.size(); ++i) {
+        UTEST_ASSERT_EQUALS(src[i], dst[i]);
+    }
+
+    std::vector<std::uint16_t> narrow(src.size(), 7u);
+    UTEST_ASSERT_FALSE(convert_if_fits(src.data(), src.size(), narrow.data()));
+    for (size_t i = 0; i < narrow.size(); ++i) {
+        UTEST_ASSERT_EQUALS(7u, narrow[i]);
+    }
+
+    std::vector<float> floats(50, -2.75f);
+    std::vector<int> ints(floats.size());
+    UTEST_ASSERT_TRUE(convert_if_fits(floats.data(), floats.size(), ints.data()));
+    UTEST_ASSERT_EQUALS(-2, ints[49]);
+    std::vector<unsigned> unsigneds(floats.size(), 1u);
+    UTEST_ASSERT_FALSE(convert_if_fits(floats.data(), floats.size(), unsigneds.data()));
+    UTEST_ASSERT_EQUALS(1u, unsigneds[0]);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // analyze_range tests
+    UTEST_FUNC(AnalyzeRangeIntegers);
+    UTEST_FUNC(AnalyzeRangeFloatingPoint);
+
+    // fits_in tests
+    UTEST_FUNC(FitsInMatchesNumericCast);
+    UTEST_FUNC(FloatBoundsArePowersOfTwo);
+
+    // convert_if_fits tests
+    UTEST_FUNC(ConvertIfFits);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
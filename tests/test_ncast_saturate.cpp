@@ -0,0 +1,202 @@
+#include "../include/ncast/ncast_saturate.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Source values around every narrowing boundary, repeated so that each one
+// lands in every SIMD lane and in the scalar tail
+template<typename From>
+static std::vector<From> boundary_values(size_t size, size_t shift) {
+    const long long edges[] = {
+        -2147483647LL - 1, -65536, -32769, -32768, -32767, -256, -129, -128, -127, -1,
+        0, 1, 126, 127, 128, 254, 255, 256, 32766, 32767, 32768, 65535, 65536, 2147483647LL
+    };
+    const size_t edge_count = sizeof(edges) / sizeof(edges[0]);
+    std::vector<From> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        long long value = edges[(i * 7 + shift) % edge_count];
+        if (value > static_cast<long long>(std::numeric_limits<From>::max())) {
+            value = std::numeric_limits<From>::max();
+        }
+        if (value < static_cast<long long>(std::numeric_limits<From>::lowest())) {
+            value = std::numeric_limits<From>::lowest();
+        }
+        data[i] = static_cast<From>(value);
+    }
+    return data;
+}
+
+// Compare saturate_cast_n with element-wise saturate_cast, including the clamped count
+template<typename To, typename From>
+static bool matches_scalar(const std::vector<From>& src) {
+    std::vector<To> dst(src.size() + 1, To(42));
+    std::size_t clamped = 12345;
+    saturate_cast_n(src.data(), src.size(), dst.data(), &clamped);
+
+    std::size_t expected_clamped = 0;
+    for (size_t i = 0; i < src.size(); ++i) {
+        To expected = saturate_cast<To>(src[i]);
+        if (dst[i] != expected) {
+            return false;
+        }
+        bool is_clamped = false;
+        try {
+            To converted = reference_cast<To>(src[i]);
+            (void)converted;
+        } catch (const cast_exception&) {
+            is_clamped = true;
+        }
+        expected_clamped += is_clamped ? 1u : 0u;
+    }
+    if (dst[src.size()] != To(42) || clamped != expected_clamped) {
+        return false;
+    }
+
+    // Without a counter the output is the same
+    std::vector<To> uncounted(src.size());
+    saturate_cast_n(src.data(), src.size(), uncounted.data());
+    for (size_t i = 0; i < src.size(); ++i) {
+        if (uncounted[i] != dst[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename To, typename From>
+static bool matches_scalar_all_sizes() {
+    for (size_t size = 0; size < 100; ++size) {
+        for (size_t shift = 0; shift < 3; ++shift) {
+            if (!matches_scalar<To>(boundary_values<From>(size, shift * 5 + size))) {
+                return false;
+            }
+        }
+    }
+    return matches_scalar<To>(boundary_values<From>(4099, 1));
+}
+
+// =============================================================================
+// SATURATE_CAST TESTS
+// =============================================================================
+
+// Test clamping of integral values
+UTEST_FUNC_DEF(SaturateCastIntegers) {
+    UTEST_ASSERT_EQUALS(127, saturate_cast<std::int8_t>(1000));
+    UTEST_ASSERT_EQUALS(-128, saturate_cast<std::int8_t>(-1000));
+    UTEST_ASSERT_EQUALS(-5, saturate_cast<std::int8_t>(-5));
+    UTEST_ASSERT_EQUALS(0u, saturate_cast<std::uint8_t>(-1));
+    UTEST_ASSERT_EQUALS(255u, saturate_cast<std::uint8_t>(256));
+    UTEST_ASSERT_EQUALS(32767, saturate_cast<std::int16_t>(std::numeric_limits<std::uint64_t>::max()));
+    UTEST_ASSERT_EQUALS(0u, saturate_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::min()));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int64_t>::max(),
+                        saturate_cast<std::int64_t>(std::numeric_limits<std::uint64_t>::max()));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::uint32_t>::max(),
+                        saturate_cast<std::uint32_t>(std::numeric_limits<std::uint32_t>::max()));
+}
+
+// Test clamping of floating-point values
+UTEST_FUNC_DEF(SaturateCastFloatingPoint) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    UTEST_ASSERT_EQUALS(0, saturate_cast<int>(nan));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<int>::max(), saturate_cast<int>(inf));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<int>::min(), saturate_cast<int>(-inf));
+    UTEST_ASSERT_EQUALS(255u, saturate_cast<std::uint8_t>(300.7));
+    UTEST_ASSERT_EQUALS(0u, saturate_cast<std::uint8_t>(-0.5));
+    UTEST_ASSERT_EQUALS(12, saturate_cast<int>(12.9));
+
+    // 2^31 and 2^63 are the first values above the integer max; they must clamp, not wrap
+    const float two_31 = 2147483648.0f;
+    const double two_63 = 9223372036854775808.0;
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int32_t>::max(), saturate_cast<std::int32_t>(two_31));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int64_t>::max(), saturate_cast<std::int64_t>(two_63));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int32_t>::min(), saturate_cast<std::int32_t>(-two_31));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int64_t>::min(), saturate_cast<std::int64_t>(-two_63));
+
+    std::vector<float> floats(37, std::nextafter(two_31, 0.0f));
+    floats[3] = two_31;
+    floats[36] = two_31;
+    std::vector<std::int32_t> ints(floats.size());
+    size_t clamped = 0;
+    saturate_cast_n(floats.data(), floats.size(), ints.data(), &clamped);
+    UTEST_ASSERT_EQUALS(2u, clamped);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int32_t>::max(), ints[3]);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int32_t>::max(), ints[36]);
+    UTEST_ASSERT_EQUALS(2147483520, ints[0]);
+
+    std::vector<double> doubles(19, std::nextafter(two_63, 0.0));
+    doubles[18] = two_63;
+    std::vector<std::int64_t> longs(doubles.size());
+    saturate_cast_n(doubles.data(), doubles.size(), longs.data(), &clamped);
+    UTEST_ASSERT_EQUALS(1u, clamped);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<std::int64_t>::max(), longs[18]);
+    UTEST_ASSERT_EQUALS(9223372036854774784LL, longs[0]);
+
+    // Floating-point targets: finite values clamp, NaN and infinity pass through
+    UTEST_ASSERT_EQUALS(std::numeric_limits<float>::max(), saturate_cast<float>(1.0e300));
+    UTEST_ASSERT_EQUALS(std::numeric_limits<float>::lowest(), saturate_cast<float>(-1.0e300));
+    UTEST_ASSERT_TRUE(std::isinf(saturate_cast<float>(-inf)));
+    UTEST_ASSERT_TRUE(std::isnan(saturate_cast<float>(nan)));
+    UTEST_ASSERT_EQUALS(2.5f, saturate_cast<float>(2.5));
+}
+
+// =============================================================================
+// SATURATE_CAST_N TESTS
+// =============================================================================
+
+// Pack-kernel pairs must match the scalar saturate_cast at every position
+UTEST_FUNC_DEF(SaturateCastNPackPairs) {
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::int16_t, std::int32_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::uint16_t, std::int32_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::int8_t, std::int32_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::uint8_t, std::int32_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::int8_t, std::int16_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::uint8_t, std::int16_t>()));
+}
+
+// Other pairs use the scalar loop with the same semantics
+UTEST_FUNC_DEF(SaturateCastNGenericPairs) {
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::uint8_t, std::uint32_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::int32_t, std::int64_t>()));
+    UTEST_ASSERT_TRUE((matches_scalar_all_sizes<std::uint16_t, std::int64_t>()));
+
+    std::vector<double> doubles(37, 1.0e12);
+    doubles[3] = std::numeric_limits<double>::quiet_NaN();
+    doubles[5] = -7.5;
+    doubles[8] = -1.0e12;
+    std::vector<int> ints(doubles.size());
+    std::size_t clamped = 0;
+    saturate_cast_n(doubles.data(), doubles.size(), ints.data(), &clamped);
+    UTEST_ASSERT_EQUALS(0, ints[3]);
+    UTEST_ASSERT_EQUALS(-7, ints[5]);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<int>::min(), ints[8]);
+    UTEST_ASSERT_EQUALS(std::numeric_limits<int>::max(), ints[0]);
+    UTEST_ASSERT_EQUALS(doubles.size() - 1, clamped);
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // saturate_cast tests
+    UTEST_FUNC(SaturateCastIntegers);
+    UTEST_FUNC(SaturateCastFloatingPoint);
+
+    // saturate_cast_n tests
+    UTEST_FUNC(SaturateCastNPackPairs);
+    UTEST_FUNC(SaturateCastNGenericPairs);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
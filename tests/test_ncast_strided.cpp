@@ -0,0 +1,180 @@
+#include "../include/ncast/ncast_strided.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+struct Trade {
+    std::int64_t id;
+    double price;
+    std::uint32_t quantity;
+    std::int16_t venue;
+    char padding[42];
+};
+
+// Store values at an arbitrary byte offset and stride, convert them into a
+// strided destination and compare with element-wise numeric_cast
+template<typename To, typename From>
+static bool check_strided(const std::vector<From>& values, size_t src_offset, size_t src_stride,
+                          size_t dst_offset, size_t dst_stride) {
+    std::vector<unsigned char> src_bytes(src_offset + values.size() * src_stride + sizeof(From), 0xab);
+    for (size_t i = 0; i < values.size(); ++i) {
+        std::memcpy(&src_bytes[src_offset + i * src_stride], &values[i], sizeof(From));
+    }
+    std::vector<unsigned char> dst_bytes(dst_offset + values.size() * dst_stride + sizeof(To), 0xcd);
+    std::vector<unsigned char> untouched = dst_bytes;
+
+    bulk_result result = try_numeric_cast_strided(reinterpret_cast<const From*>(&src_bytes[src_offset]), src_stride,
+                                                  values.size(), reinterpret_cast<To*>(&dst_bytes[dst_offset]),
+                                                  dst_stride);
+    bulk_result expected = reference_result<To>(values);
+    if (result.index != expected.index || result.error != expected.error) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        const unsigned char* slot = &dst_bytes[dst_offset + i * dst_stride];
+        if (i < expected.index) {
+            To converted;
+            std::memcpy(&converted, slot, sizeof(To));
+            if (converted != static_cast<To>(values[i])) {
+                return false;
+            }
+        } else if (std::memcmp(slot, &untouched[dst_offset + i * dst_stride], sizeof(To)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Dense destination, failure injected at several positions (block and SIMD boundaries)
+template<typename To, typename From>
+static bool check_failure_positions(From fill, From bad, size_t src_stride) {
+    const size_t size = 700;
+    const size_t positions[] = { 0, 3, 7, 255, 256, 257, 511, 512, 699 };
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); ++p) {
+        std::vector<From> values(size, fill);
+        values[positions[p]] = bad;
+        values[(positions[p] + 100) % size] = bad;
+        if (!check_strided<To>(values, 8, src_stride, 0, sizeof(To))) {
+            return false;
+        }
+    }
+    std::vector<From> valid(size, fill);
+    return check_strided<To>(valid, 8, src_stride, 0, sizeof(To));
+}
+
+// =============================================================================
+// STRIDED CONVERSION TESTS
+// =============================================================================
+
+// Test narrowing a field of an array of structs into a dense column
+UTEST_FUNC_DEF(StridedFieldToDense) {
+    std::vector<Trade> trades(1000);
+    for (size_t i = 0; i < trades.size(); ++i) {
+        trades[i].id = static_cast<std::int64_t>(i);
+        trades[i].price = static_cast<double>(i) * 10.25 - 300.0;
+        trades[i].quantity = static_cast<std::uint32_t>(i * 3);
+        trades[i].venue = static_cast<std::int16_t>(i % 7);
+    }
+
+    std::vector<std::int32_t> prices(trades.size(), -1);
+    bulk_result result = try_numeric_cast_strided(&trades[0].price, sizeof(Trade), trades.size(), prices.data());
+    UTEST_ASSERT_TRUE(result.ok());
+    UTEST_ASSERT_EQUALS(trades.size(), result.index);
+    for (size_t i = 0; i < trades.size(); ++i) {
+        UTEST_ASSERT_EQUALS(static_cast<std::int32_t>(trades[i].price), prices[i]);
+    }
+
+    // Unsigned target: the first negative price fails
+    std::vector<std::uint16_t> unsigned_prices(trades.size(), 7u);
+    result = try_numeric_cast_strided(&trades[0].price, sizeof(Trade), trades.size(), unsigned_prices.data());
+    UTEST_ASSERT_EQUALS(0u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::negative_overflow);
+    UTEST_ASSERT_EQUALS(7u, unsigned_prices[0]);
+
+    std::vector<std::uint8_t> quantities(trades.size(), 0);
+    result = try_numeric_cast_strided(&trades[0].quantity, sizeof(Trade), trades.size(), quantities.data());
+    UTEST_ASSERT_EQUALS(86u, result.index);  // 86 * 3 = 258
+    UTEST_ASSERT_TRUE(result.error == cast_error::positive_overflow);
+    UTEST_ASSERT_EQUALS(255u, quantities[85]);
+    UTEST_ASSERT_EQUALS(0u, quantities[86]);
+
+    bool thrown = false;
+    try {
+        numeric_cast_strided(&trades[0].quantity, sizeof(Trade), trades.size(), quantities.data());
+    } catch (const cast_exception& e) {
+        thrown = true;
+        UTEST_ASSERT_TRUE(e.getError() == cast_error::positive_overflow);
+    }
+    UTEST_ASSERT_TRUE(thrown);
+}
+
+// Test writing a dense column into a struct field (strided destination)
+UTEST_FUNC_DEF(StridedDenseToField) {
+    std::vector<std::int32_t> venues(300);
+    for (size_t i = 0; i < venues.size(); ++i) {
+        venues[i] = static_cast<std::int32_t>(i) - 150;
+    }
+    std::vector<Trade> trades(venues.size());
+    for (size_t i = 0; i < trades.size(); ++i) {
+        trades[i].id = 99;
+    }
+    numeric_cast_strided(venues.data(), sizeof(std::int32_t), venues.size(), &trades[0].venue, sizeof(Trade));
+    for (size_t i = 0; i < trades.size(); ++i) {
+        UTEST_ASSERT_EQUALS(static_cast<std::int16_t>(venues[i]), trades[i].venue);
+        UTEST_ASSERT_EQUALS(99, trades[i].id);
+    }
+
+    venues[123] = 40000;
+    bulk_result result = try_numeric_cast_strided(venues.data(), sizeof(std::int32_t), venues.size(),
+                                                  &trades[0].venue, sizeof(Trade));
+    UTEST_ASSERT_EQUALS(123u, result.index);
+    UTEST_ASSERT_TRUE(result.error == cast_error::positive_overflow);
+}
+
+// Test every gathered source type, unaligned fields and odd strides against numeric_cast
+UTEST_FUNC_DEF(StridedMatchesNumericCast) {
+    UTEST_ASSERT_TRUE((check_failure_positions<std::int32_t, double>(12.5, 3.0e9, 64)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::int32_t, double>(-1.0, std::nan(""), 24)));
+    UTEST_ASSERT_TRUE((check_failure_positions<float, double>(1.0e10, -1.0e300, 16)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::int16_t, float>(-3.75f, std::numeric_limits<float>::infinity(), 12)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::uint8_t, std::int32_t>(200, -1, 20)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::int8_t, std::uint32_t>(100u, 128u, 8)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::uint32_t, std::int64_t>(4000000000LL, 4294967296LL, 40)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::int32_t, std::uint64_t>(5u, 2147483648ull, 32)));
+    UTEST_ASSERT_TRUE((check_failure_positions<std::uint8_t, std::int16_t>(17, 256, 6)));
+
+    // Unaligned source and destination, odd strides, sizes around the block length
+    for (size_t size = 0; size < 600; size += 37) {
+        std::vector<double> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = static_cast<double>(i % 200) - 100.5;
+        }
+        UTEST_ASSERT_TRUE((check_strided<std::int8_t>(values, 3, 13, 1, 5)));
+        UTEST_ASSERT_TRUE((check_strided<std::int32_t>(values, 1, 9, 2, 7)));
+        UTEST_ASSERT_TRUE((check_strided<float>(values, 0, 8, 0, 4)));
+    }
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Strided conversion tests
+    UTEST_FUNC(StridedFieldToDense);
+    UTEST_FUNC(StridedDenseToField);
+    UTEST_FUNC(StridedMatchesNumericCast);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
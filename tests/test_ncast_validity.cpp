@@ -0,0 +1,140 @@
+#include "../include/ncast/ncast_validity.h"
+#include "../include/utest/utest.h"
+#include "test_utils.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace ncast;
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+// Compare convert_with_validity with element-wise reference_cast: output values,
+// every bitmap bit (including the cleared padding bits) and the failure count
+template<typename To, typename From>
+static bool check_validity(const std::vector<From>& values, To replacement) {
+    const size_t bitmap_bytes = validity_bitmap_bytes(values.size());
+    std::vector<To> dst(values.size() + 1, To(3));
+    std::vector<std::uint8_t> bitmap(bitmap_bytes + 1, 0x5a);
+
+    size_t failures = convert_with_validity(values.data(), values.size(), dst.data(), bitmap.data(), replacement);
+
+    size_t expected_failures = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        bool valid = passes_reference_cast<To>(values[i]);
+        expected_failures += valid ? 0u : 1u;
+        if (is_valid(bitmap.data(), i) != valid) {
+            return false;
+        }
+        To expected = valid ? static_cast<To>(values[i]) : replacement;
+        if (dst[i] != expected) {
+            return false;
+        }
+    }
+    for (size_t bit = values.size(); bit < bitmap_bytes * 8; ++bit) {
+        if (is_valid(bitmap.data(), bit)) {
+            return false;
+        }
+    }
+    return failures == expected_failures && dst[values.size()] == To(3) && bitmap[bitmap_bytes] == 0x5a;
+}
+
+// Failures at every position of small arrays and scattered through large ones
+template<typename To, typename From>
+static bool check_failure_patterns(From good, From bad, To replacement) {
+    for (size_t size = 0; size < 90; ++size) {
+        for (size_t pos = 0; pos < size; pos += 3) {
+            std::vector<From> values(size, good);
+            values[pos] = bad;
+            if (!check_validity(values, replacement)) {
+                return false;
+            }
+        }
+    }
+    std::vector<From> values(3000, good);
+    if (!check_validity(values, replacement)) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); i += 17) {
+        values[i] = bad;
+    }
+    for (size_t i = 512; i < 800; ++i) {
+        values[i] = bad;
+    }
+    return check_validity(values, replacement);
+}
+
+// =============================================================================
+// VALIDITY BITMAP TESTS
+// =============================================================================
+
+// Test the bitmap helpers and a small ingestion batch
+UTEST_FUNC_DEF(ValidityBitmapBasics) {
+    UTEST_ASSERT_EQUALS(0u, validity_bitmap_bytes(0));
+    UTEST_ASSERT_EQUALS(1u, validity_bitmap_bytes(1));
+    UTEST_ASSERT_EQUALS(1u, validity_bitmap_bytes(8));
+    UTEST_ASSERT_EQUALS(2u, validity_bitmap_bytes(9));
+
+    std::vector<std::int64_t> amounts(40, 1000);
+    amounts[17] = 5000000000LL;
+    amounts[30] = -5000000000LL;
+    std::vector<std::int32_t> narrow(amounts.size());
+    std::vector<std::uint8_t> valid(validity_bitmap_bytes(amounts.size()));
+
+    size_t failures = convert_with_validity(amounts.data(), amounts.size(), narrow.data(), valid.data(), -1);
+    UTEST_ASSERT_EQUALS(2u, failures);
+    UTEST_ASSERT_FALSE(is_valid(valid.data(), 17));
+    UTEST_ASSERT_FALSE(is_valid(valid.data(), 30));
+    UTEST_ASSERT_TRUE(is_valid(valid.data(), 16));
+    UTEST_ASSERT_EQUALS(-1, narrow[17]);
+    UTEST_ASSERT_EQUALS(-1, narrow[30]);
+    UTEST_ASSERT_EQUALS(1000, narrow[39]);
+    UTEST_ASSERT_EQUALS(0xffu, valid[0]);
+    UTEST_ASSERT_EQUALS(0xfdu, valid[2]);  // element 17 is bit 1 of byte 2
+    UTEST_ASSERT_EQUALS(0xbfu, valid[3]);  // element 30 is bit 6 of byte 3
+    UTEST_ASSERT_EQUALS(0xffu, valid[4]);
+}
+
+// Test integral pairs against numeric_cast
+UTEST_FUNC_DEF(ValidityMatchesNumericCastIntegers) {
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::int32_t, std::int64_t>(7, 1LL << 40, -1)));
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::uint8_t, std::int32_t>(200, -1, 0)));
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::int16_t, std::uint64_t>(12345u, 32768u, std::int16_t(-32768))));
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::uint32_t, std::int16_t>(100, -100, 0xffffffffu)));
+}
+
+// Test floating-point sources, including NaN and infinity
+UTEST_FUNC_DEF(ValidityMatchesNumericCastFloatingPoint) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::int32_t, double>(-12.75, nan, std::numeric_limits<std::int32_t>::min())));
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::int32_t, double>(1.0e9, -inf, 0)));
+    UTEST_ASSERT_TRUE((check_failure_patterns<std::uint16_t, float>(65535.0f, 65536.0f, 0)));
+    UTEST_ASSERT_TRUE((check_failure_patterns<float, double>(0.5, 1.0e300, -1.0f)));
+
+    // NaN and infinity are valid for floating-point targets
+    std::vector<double> specials(20, nan);
+    specials[3] = -inf;
+    std::vector<float> floats(specials.size());
+    std::vector<std::uint8_t> valid(validity_bitmap_bytes(specials.size()));
+    UTEST_ASSERT_EQUALS(0u, convert_with_validity(specials.data(), specials.size(), floats.data(), valid.data()));
+    UTEST_ASSERT_TRUE(std::isnan(floats[0]));
+    UTEST_ASSERT_TRUE(std::isinf(floats[3]));
+}
+
+int main() {
+    UTEST_PROLOG();
+    UTEST_ENABLE_VERBOSE_MODE();
+
+    // Validity bitmap tests
+    UTEST_FUNC(ValidityBitmapBasics);
+    UTEST_FUNC(ValidityMatchesNumericCastIntegers);
+    UTEST_FUNC(ValidityMatchesNumericCastFloatingPoint);
+
+    UTEST_EPILOG();
+
+    return 0;
+}
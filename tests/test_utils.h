@@ -0,0 +1,58 @@
+/**
+ * @file test_utils.h
+ * @brief Reference helpers shared by the ncast tests
+ */
+
+#ifndef TEST_UTILS_H
+#define TEST_UTILS_H
+
+#include "../include/ncast/ncast_bulk.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief numeric_cast<To> with the runtime rules the bulk conversions follow
+ *
+ * The same in every language standard: fractions truncate and NaN / infinity
+ * pass into floating-point targets (C++14+ numeric_cast of built-in types
+ * rejects both).
+ */
+template<typename To, typename From>
+To reference_cast(From value) {
+    return ncast::detail::numeric_cast_impl<To>(value, "unknown", 0, "unknown");
+}
+
+/// True if reference_cast<To> accepts the value
+template<typename To, typename From>
+bool passes_reference_cast(From value) {
+    try {
+        To converted = reference_cast<To>(value);
+        (void)converted;
+        return true;
+    } catch (const ncast::cast_exception&) {
+        return false;
+    }
+}
+
+/**
+ * @brief Index and kind of the first element failing reference_cast<To>
+ *
+ * Element-wise reference for the bulk conversions; {values.size(), none}
+ * when every element converts.
+ */
+template<typename To, typename From>
+ncast::bulk_result reference_result(const std::vector<From>& values) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        try {
+            To converted = reference_cast<To>(values[i]);
+            (void)converted;
+        } catch (const ncast::cast_exception& e) {
+            ncast::bulk_result failure = { i, e.getError() };
+            return failure;
+        }
+    }
+    ncast::bulk_result success = { values.size(), ncast::cast_error::none };
+    return success;
+}
+
+#endif // TEST_UTILS_H